@@ -0,0 +1,66 @@
+#include "FrameClock.h"
+
+#include <algorithm>
+
+namespace Inertia
+{
+	FrameClock::Tick FrameClock::Advance(std::uint32_t a_frame, float a_engineDelta)
+	{
+		Tick tick;
+		tick.rawDelta = a_engineDelta;
+
+		// Same engine frame as the last call - the game state hasn't moved on
+		if (hasFrame && a_frame == lastFrame) {
+			return tick;
+		}
+		hasFrame = true;
+		lastFrame = a_frame;
+
+		// Paused / frozen timer: nothing to integrate, and not a sample of the frame rate
+		if (!(a_engineDelta > 0.0f)) {
+			return tick;
+		}
+
+		tick.update = true;
+		float typical = GetTypicalDelta();
+		if (typical > 0.0f && a_engineDelta > kHitchRatio * typical && a_engineDelta > kHitchMinDelta) {
+			if (++hitchRun <= kMaxHitchRun) {
+				// Hitch - step one typical frame and keep it out of the history
+				tick.hitch = true;
+				tick.delta = typical;
+				return tick;
+			}
+			// Still this slow - the frame rate itself dropped, start over from here
+			historyCount = 0;
+			historyNext = 0;
+			typical = 0.0f;
+		}
+		hitchRun = 0;
+
+		history[static_cast<std::size_t>(historyNext)] = a_engineDelta;
+		historyNext = (historyNext + 1) % kHistorySize;
+		historyCount = std::min(historyCount + 1, kHistorySize);
+
+		tick.delta = typical > 0.0f ? a_engineDelta : std::min(a_engineDelta, kMaxDelta);
+		return tick;
+	}
+
+	float FrameClock::GetTypicalDelta() const
+	{
+		if (historyCount < kMinHistory) {
+			return 0.0f;
+		}
+		std::array<float, kHistorySize> sorted = history;
+		auto middle = sorted.begin() + historyCount / 2;
+		std::nth_element(sorted.begin(), middle, sorted.begin() + historyCount);
+		return *middle;
+	}
+
+	void FrameClock::Reset()
+	{
+		historyCount = 0;
+		historyNext = 0;
+		hitchRun = 0;
+		hasFrame = false;
+	}
+}
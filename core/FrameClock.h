@@ -0,0 +1,49 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace Inertia
+{
+	// Turns the engine's per-frame timer into the delta Update() integrates
+	//
+	// Calls are identified by the engine's frame counter, so a second call within one engine frame
+	// (frame generation, hook re-entry) is a duplicate whatever the wall-clock gap. A ring of recent
+	// frame times gives the typical frame length: a frame far longer than that (loading screen,
+	// alt-tab, save) is a hitch and advances the springs by one typical frame instead of the spike.
+	class FrameClock
+	{
+	public:
+		static constexpr int kHistorySize = 16;        // Recent frame times kept
+		static constexpr int kMinHistory = 4;          // Frames needed before hitches are detected
+		static constexpr float kHitchRatio = 4.0f;     // Hitch: longer than this many typical frames...
+		static constexpr float kHitchMinDelta = 0.05f; // ...and longer than this (seconds)
+		static constexpr float kMaxDelta = 0.1f;       // Cap while there is no history yet
+		static constexpr int kMaxHitchRun = 3;         // Longer runs of long frames are a new frame rate
+
+		struct Tick
+		{
+			bool update{ false };     // False for duplicates and paused (zero delta) frames
+			bool hitch{ false };      // rawDelta was replaced by the typical frame time
+			float delta{ 0.0f };      // Seconds to advance
+			float rawDelta{ 0.0f };   // Engine delta as read
+		};
+
+		// One hook call: a_frame is the engine frame counter, a_engineDelta its frame time (seconds)
+		Tick Advance(std::uint32_t a_frame, float a_engineDelta);
+
+		// Median of the recent frame times (0 until kMinHistory frames were seen)
+		float GetTypicalDelta() const;
+
+		// Forget the history (e.g. after a load, where the frame rate may differ)
+		void Reset();
+
+	private:
+		std::array<float, kHistorySize> history{};
+		int historyCount{ 0 };
+		int historyNext{ 0 };
+		int hitchRun{ 0 };
+		std::uint32_t lastFrame{ 0 };
+		bool hasFrame{ false };
+	};
+}
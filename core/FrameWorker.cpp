@@ -0,0 +1,112 @@
+#include "FrameWorker.h"
+#include "TraceZones.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+#	include <immintrin.h>
+#endif
+
+namespace Inertia
+{
+	namespace
+	{
+		// Busy-wait step; after a short burst it yields so a worker sharing this core can finish
+		inline void SpinPause(std::uint32_t a_spins)
+		{
+			constexpr std::uint32_t kSpinsBeforeYield = 64;
+#if defined(_M_X64) || defined(__x86_64__)
+			if (a_spins < kSpinsBeforeYield) {
+				_mm_pause();
+				return;
+			}
+#endif
+			std::this_thread::yield();
+		}
+	}
+
+	FrameWorker::~FrameWorker()
+	{
+		// Process exit: the worker is already gone
+		if (workThread.joinable()) {
+			workThread.detach();
+		}
+	}
+
+	void FrameWorker::Submit(Core::FrameState& a_state, const Job& a_job)
+	{
+		Wait();
+		if (!workThread.joinable()) {
+			workThread = std::thread(&FrameWorker::WorkLoop, this);
+		}
+		state = &a_state;
+		job = a_job;
+		submitted.store(joined + 1, std::memory_order_release);
+		submitted.notify_one();
+	}
+
+	bool FrameWorker::TryJoin(std::chrono::nanoseconds a_deadline)
+	{
+		const std::uint32_t target = submitted.load(std::memory_order_relaxed);
+		if (joined == target) {
+			return true;
+		}
+		const auto start = std::chrono::steady_clock::now();
+		for (std::uint32_t spins = 0; completed.load(std::memory_order_acquire) != target; ++spins) {
+			if (std::chrono::steady_clock::now() - start >= a_deadline) {
+				return false;
+			}
+			SpinPause(spins);
+		}
+		joined = target;
+		return true;
+	}
+
+	void FrameWorker::Wait()
+	{
+		const std::uint32_t target = submitted.load(std::memory_order_relaxed);
+		for (std::uint32_t done = completed.load(std::memory_order_acquire); done != target;
+			 done = completed.load(std::memory_order_acquire)) {
+			completed.wait(done, std::memory_order_acquire);
+		}
+		joined = target;
+	}
+
+	void FrameWorker::Stop()
+	{
+		if (!workThread.joinable()) {
+			return;
+		}
+		Wait();
+		stopping = true;
+		submitted.store(joined + 1, std::memory_order_release);
+		submitted.notify_one();
+		workThread.join();
+		stopping = false;
+		joined = submitted.load(std::memory_order_relaxed);
+		completed.store(joined, std::memory_order_relaxed);
+	}
+
+	void FrameWorker::WorkLoop()
+	{
+		Perf::SetZoneThreadName("FPInertia worker");
+		std::uint32_t seen = completed.load(std::memory_order_relaxed);
+		for (;;) {
+			submitted.wait(seen, std::memory_order_acquire);
+			const std::uint32_t target = submitted.load(std::memory_order_acquire);
+			if (target == seen) {
+				continue;  // Spurious wake
+			}
+			if (stopping) {
+				return;
+			}
+
+			FPI_TRACE_ZONE("FrameWorker job");
+			stageTimes = {};
+			Core::StepSprings(*state, job.inputs, job.settings, job.profile, output, &stageTimes);
+			pose = Core::MakePose(output, job.pivotPoint);
+
+			seen = target;
+			completed.store(target, std::memory_order_release);
+			completed.notify_all();
+		}
+	}
+}
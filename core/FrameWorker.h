@@ -0,0 +1,78 @@
+#pragma once
+
+#include "InertiaFrame.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+namespace Inertia
+{
+	// Runs the spring half of a frame (StepSprings + MakePose) on a worker thread
+	//
+	// Submit() lends the owner's FrameState to the worker together with a copy of everything the
+	// step reads, so the integration overlaps whatever the caller does next (the game's animation
+	// update). TryJoin() spins for the result for at most a deadline; Wait() blocks until the state
+	// is handed back. The owner must not touch the submitted FrameState until one of them returns
+	// true / returns, and calls Submit, TryJoin and Wait from one thread at a time.
+	class FrameWorker
+	{
+	public:
+		// Plain copy of the step's inputs - nothing in it points back into game or owner state
+		struct Job
+		{
+			Core::FrameInputs inputs;
+			Core::CoreSettings settings;
+			CompiledWeaponProfile profile;
+			std::int32_t pivotPoint{ 0 };
+		};
+
+		FrameWorker() = default;
+		~FrameWorker();
+		FrameWorker(const FrameWorker&) = delete;
+		FrameWorker(FrameWorker&&) = delete;
+		FrameWorker& operator=(const FrameWorker&) = delete;
+		FrameWorker& operator=(FrameWorker&&) = delete;
+
+		// Step a_state with a_job on the worker (started on first use); waits for the previous job first
+		void Submit(Core::FrameState& a_state, const Job& a_job);
+
+		// A job was submitted and its result not joined yet
+		bool IsPending() const { return joined != submitted.load(std::memory_order_relaxed); }
+
+		// Spin until the pending job finishes or a_deadline passes; true once its result is ready
+		// (also true when nothing is pending). A late job stays pending for the next join.
+		bool TryJoin(std::chrono::nanoseconds a_deadline);
+
+		// Block until the pending job finishes (state is the owner's again)
+		void Wait();
+
+		// Result of the last joined job
+		const Core::FrameOutput& GetOutput() const { return output; }
+		const Core::Pose& GetPose() const { return pose; }
+		const Core::StageTimes& GetStageTimes() const { return stageTimes; }
+
+		// Finish the pending job and join the thread (tools; the plugin leaves it to process exit)
+		void Stop();
+
+	private:
+		void WorkLoop();
+
+		std::thread workThread;
+
+		// Written by the owner before publishing `submitted`, read by the worker after seeing it
+		Core::FrameState* state{ nullptr };
+		Job job;
+		bool stopping{ false };
+
+		// Written by the worker before publishing `completed`, read by the owner after joining
+		Core::FrameOutput output;
+		Core::Pose pose;
+		Core::StageTimes stageTimes;
+
+		alignas(64) std::atomic<std::uint32_t> submitted{ 0 };  // Jobs handed over
+		alignas(64) std::atomic<std::uint32_t> completed{ 0 };  // Jobs finished by the worker
+		alignas(64) std::uint32_t joined{ 0 };                  // Owner only - last job whose result was taken
+	};
+}
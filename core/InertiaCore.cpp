@@ -0,0 +1,614 @@
+#include "InertiaCore.h"
+#include "RotationMath.h"
+#include "TraceZones.h"
+
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+
+namespace Inertia::Core
+{
+	Vec3 ClampVector(const Vec3& a_vec, float a_max)
+	{
+		return {
+			std::clamp(a_vec.x, -a_max, a_max),
+			std::clamp(a_vec.y, -a_max, a_max),
+			std::clamp(a_vec.z, -a_max, a_max)
+		};
+	}
+
+	Vec3 LerpVector(const Vec3& a_from, const Vec3& a_to, float a_t)
+	{
+		return {
+			a_from.x + (a_to.x - a_from.x) * a_t,
+			a_from.y + (a_to.y - a_from.y) * a_t,
+			a_from.z + (a_to.z - a_from.z) * a_t
+		};
+	}
+
+	float Length(const Vec3& a_vec)
+	{
+		return std::sqrt(a_vec.x * a_vec.x + a_vec.y * a_vec.y + a_vec.z * a_vec.z);
+	}
+
+	float MoveTowards(float a_current, float a_target, float a_maxStep)
+	{
+		if (a_current < a_target) {
+			return std::min(a_target, a_current + a_maxStep);
+		}
+		if (a_current > a_target) {
+			return std::max(a_target, a_current - a_maxStep);
+		}
+		return a_current;
+	}
+
+	Vec3 FilterCameraVelocity(const CameraAngles& a_current, CameraAngles& a_last, Vec3& a_prevVelocity, float a_delta)
+	{
+		if (a_delta <= 0.0f) {
+			return { 0.0f, 0.0f, 0.0f };
+		}
+
+		// Calculate angular velocity (radians per second)
+		Vec3 velocity;
+
+		// Handle yaw wraparound (0 to 2*PI)
+		float yawDiff = a_current.yaw - a_last.yaw;
+		if (yawDiff > kPi) {
+			yawDiff -= 2.0f * kPi;
+		} else if (yawDiff < -kPi) {
+			yawDiff += 2.0f * kPi;
+		}
+
+		velocity.z = yawDiff / a_delta;                              // Yaw velocity
+		velocity.x = (a_current.pitch - a_last.pitch) / a_delta;     // Pitch velocity
+		velocity.y = (a_current.roll - a_last.roll) / a_delta;       // Roll velocity
+
+		// Store current values for next frame
+		a_last = a_current;
+
+		// === FRAMERATE INDEPENDENCE FIX ===
+		// Clamp maximum velocity to prevent extreme spikes from frame drops or sudden input
+		constexpr float MAX_ANGULAR_VELOCITY = 25.0f;  // radians/sec - very fast turn
+		velocity = ClampVector(velocity, MAX_ANGULAR_VELOCITY);
+
+		// Clamp velocity CHANGE per frame to prevent sudden jumps
+		constexpr float MAX_VELOCITY_CHANGE_PER_SEC = 50.0f;  // radians/sec^2
+		float maxChange = MAX_VELOCITY_CHANGE_PER_SEC * a_delta;
+
+		Vec3 velocityDelta = ClampVector(velocity - a_prevVelocity, maxChange);
+		velocity = a_prevVelocity + velocityDelta;
+
+		a_prevVelocity = velocity;
+
+		return velocity;
+	}
+
+	void UpdateSettling(const CoreSettings& a_settings, float a_cameraSpeed, float a_delta,
+		float& a_settlingFactor, float& a_timeSinceMovement)
+	{
+		constexpr float MOVEMENT_THRESHOLD = 0.1f;  // Minimum velocity to count as "moving"
+
+		if (a_cameraSpeed > MOVEMENT_THRESHOLD) {
+			// Camera is moving - reset settling
+			a_timeSinceMovement = 0.0f;
+			a_settlingFactor = 0.0f;
+		} else {
+			// Camera stopped - start settling after delay
+			a_timeSinceMovement += a_delta;
+
+			if (a_timeSinceMovement > a_settings.settleDelay) {
+				// Gradually increase settling factor
+				float settleTime = a_timeSinceMovement - a_settings.settleDelay;
+				a_settlingFactor = std::min(1.0f, settleTime * a_settings.settleSpeed);
+			}
+		}
+	}
+
+	EquipBlendStep StepEquipBlend(float& a_equipBlendFactor, bool a_weaponDrawn, float a_delta)
+	{
+		// Cap delta time to prevent instant blends from frame rate spikes or loading
+		constexpr float MAX_BLEND_DELTA = 0.05f;        // 50ms max
+		constexpr float EQUIP_BLEND_IN_SPEED = 3.0f;    // Speed when drawing weapon (blend in)
+		constexpr float EQUIP_BLEND_OUT_SPEED = 4.0f;   // Speed when sheathing weapon (blend out, slightly faster)
+
+		EquipBlendStep step;
+		step.cappedDelta = std::min(a_delta, MAX_BLEND_DELTA);
+		step.target = a_weaponDrawn ? 1.0f : 0.0f;
+
+		// Use appropriate speed based on direction
+		step.speed = (a_equipBlendFactor < step.target) ? EQUIP_BLEND_IN_SPEED : EQUIP_BLEND_OUT_SPEED;
+		a_equipBlendFactor = MoveTowards(a_equipBlendFactor, step.target, step.speed * step.cappedDelta);
+		return step;
+	}
+
+	void StepAirBlends(const CompiledWeaponProfile& a_profile, bool a_inAir, float a_delta,
+		float& a_movementAirBlend, float& a_cameraAirBlend)
+	{
+		constexpr float AIR_BLEND_SPEED = 8.0f;  // How fast to blend in/out
+		float airBlendDelta = AIR_BLEND_SPEED * a_delta;
+
+		// Blend movement inertia out while in air, back in when grounded
+		a_movementAirBlend = MoveTowards(a_movementAirBlend, a_inAir ? 0.0f : 1.0f, airBlendDelta);
+
+		// Blend camera inertia to configurable multiplier while in air
+		a_cameraAirBlend = MoveTowards(a_cameraAirBlend, a_inAir ? a_profile.cameraAirMult : 1.0f, airBlendDelta);
+	}
+
+	Vec3 SmoothMovementInput(Vec3& a_smoothed, float a_inputX, float a_inputY)
+	{
+		// Scale input to approximate velocity (input is -1 to 1, scale to reasonable speed)
+		// Normal walk speed is ~100-150 units/sec, run is ~300+
+		constexpr float INPUT_TO_VELOCITY = 200.0f;
+
+		Vec3 localVelocity = {
+			a_inputX * INPUT_TO_VELOCITY,   // Local right (strafe)
+			a_inputY * INPUT_TO_VELOCITY,   // Local forward
+			0.0f                            // No vertical from input
+		};
+
+		// Smooth the movement input to reduce jitter
+		constexpr float MOVEMENT_SMOOTHING = 0.3f;
+		a_smoothed = LerpVector(a_smoothed, localVelocity, 1.0f - MOVEMENT_SMOOTHING);
+
+		return a_smoothed;
+	}
+
+	void StageCameraSpring(SpringBank& a_bank, SpringSlot a_slot, const CoreSettings& a_settings,
+		const CompiledWeaponProfile& a_profile, const Vec3& a_cameraVelocity, float a_multiplier,
+		float a_settlingFactor, Stance a_stance)
+	{
+		FPI_TRACE_ZONE("Camera spring");
+		float intensity = a_settings.globalIntensity * a_multiplier;
+
+		if (intensity <= 0.0f) {
+			a_bank.Reset(a_slot);
+			return;
+		}
+
+		// Separate invert factors for pitch (up/down) and yaw (left/right), stance override already applied
+		const auto& stance = a_profile.stances[static_cast<std::size_t>(a_stance)];
+		float invertPitch = stance.cameraInvertPitch;
+		float invertYaw = stance.cameraInvertYaw;
+
+		// Apply settling - increase damping when camera stops
+		float dampingMultiplier = 1.0f + (a_settlingFactor * (a_settings.settleDampingMult - 1.0f));
+
+		// Position offset - CAMERA ONLY (global pitch mult folded into cameraPitchPosScale)
+		Vec3 targetOffset = {
+			invertYaw * -a_cameraVelocity.z * 2.0f * intensity,  // Yaw -> X offset
+			0.0f,
+			invertPitch * a_cameraVelocity.x * intensity * a_profile.cameraPitchPosScale  // Pitch -> Z offset
+		};
+		targetOffset = ClampVector(targetOffset, a_profile.cameraTargetMaxOffset);
+
+		// Rotation offset - CAMERA ONLY
+		Vec3 targetRotation = {
+			invertPitch * a_cameraVelocity.x * intensity * a_profile.cameraPitchRotScale,  // Pitch rotation (both mults)
+			invertYaw * -a_cameraVelocity.z * 0.06f * intensity,  // Yaw rotation
+			invertYaw * -a_cameraVelocity.z * intensity * a_profile.cameraRollRotScale  // Roll (driven by yaw)
+		};
+		targetRotation = ClampVector(targetRotation, a_profile.cameraTargetMaxRotation);
+
+		// F = -k * offset - c * velocity + target * k * 0.5, i.e. the spring rests at half the target
+		// Velocity limits come from SpringTraits<SpringCategory::kCamera>
+		float damping = a_profile.cameraDamping * dampingMultiplier;
+		SpringBank::GroupParams posParams{ a_profile.cameraStiffness, damping, a_profile.cameraMaxOffset };
+		SpringBank::GroupParams rotParams{ a_profile.cameraStiffness, damping, a_profile.cameraMaxRotation };
+		a_bank.Stage(a_slot,
+			{ targetOffset.x * 0.5f, 0.0f, targetOffset.z * 0.5f }, posParams, a_settings.enablePosition,
+			{ targetRotation.x * 0.5f, targetRotation.y * 0.5f, targetRotation.z * 0.5f }, rotParams, a_settings.enableRotation);
+	}
+
+	void StageMovementSpring(SpringBank& a_bank, SpringSlot a_slot, const CoreSettings& a_settings,
+		const CompiledWeaponProfile& a_profile, const Vec3& a_localMovement, float a_delta, float a_intensity,
+		Stance a_stance)
+	{
+		FPI_TRACE_ZONE("Movement spring");
+		// Check per-weapon enable AND global enable
+		if (!a_settings.movementInertiaEnabled || !a_profile.movementEnabled || a_intensity <= 0.0f) {
+			// Decay to zero when disabled
+			a_bank.Decay(a_slot, std::min(1.0f, a_delta * 5.0f));
+			return;
+		}
+
+		// Spring parameters from PER-WEAPON settings
+		float k = a_profile.movementStiffness;
+		float c = a_profile.movementDamping;
+
+		// Separate invert factors for lateral (left/right) and forward/back movement
+		const auto& stance = a_profile.stances[static_cast<std::size_t>(a_stance)];
+		float invertLateral = stance.movementInvertLateral;
+		float invertForwardBack = stance.movementInvertForwardBack;
+
+		// Calculate TARGET position based on movement
+		Vec3 targetPos = { 0.0f, 0.0f, 0.0f };
+		Vec3 targetRot = { 0.0f, 0.0f, 0.0f };
+
+		float lateralSpeed = std::abs(a_localMovement.x);
+		float forwardSpeed = std::abs(a_localMovement.y);
+		float totalHorizontalSpeed = lateralSpeed + forwardSpeed;
+
+		// === LATERAL (LEFT/RIGHT) MOVEMENT ===
+		if (lateralSpeed > a_settings.movementInertiaThreshold) {
+			float strength = a_settings.movementInertiaStrength * a_intensity;
+			float speedFactor = std::min(1.0f, lateralSpeed / 200.0f);
+
+			// Calculate blend factor - reduce effect when moving diagonally
+			float lateralBlend = (totalHorizontalSpeed > 0.1f) ? (lateralSpeed / totalHorizontalSpeed) : 0.0f;
+			float blendedStrength = strength * lateralBlend * speedFactor * 1.5f;
+
+			float normalizedInput = std::clamp(a_localMovement.x / 200.0f, -1.0f, 1.0f);
+
+			// Blend multipliers based on direction
+			float rightBlend = std::max(0.0f, normalizedInput);
+			float leftBlend = std::max(0.0f, -normalizedInput);
+			float effectiveMult = rightBlend * a_profile.movementRightMult +
+			                      leftBlend * a_profile.movementLeftMult;
+
+			targetPos.x = invertLateral * -normalizedInput * effectiveMult * blendedStrength;
+			targetRot.z = invertLateral * -normalizedInput * effectiveMult * blendedStrength * 0.033f;
+		}
+
+		// === FORWARD/BACK MOVEMENT ===
+		// Uses per-weapon forward/back multipliers (only if global forward/back is enabled)
+		if (a_settings.forwardBackInertia && forwardSpeed > a_settings.movementInertiaThreshold) {
+			float strength = a_settings.movementInertiaStrength * a_intensity;
+			float speedFactor = std::min(1.0f, forwardSpeed / 200.0f);
+
+			// Calculate blend factor - reduce effect when moving diagonally
+			float forwardBlend = (totalHorizontalSpeed > 0.1f) ? (forwardSpeed / totalHorizontalSpeed) : 0.0f;
+			float blendedStrength = strength * forwardBlend * speedFactor;
+
+			float normalizedInput = std::clamp(a_localMovement.y / 200.0f, -1.0f, 1.0f);
+
+			// Use per-weapon forward/back multipliers
+			float forwardBlendMult = std::max(0.0f, normalizedInput);
+			float backwardBlendMult = std::max(0.0f, -normalizedInput);
+			float effectiveMult = forwardBlendMult * a_profile.movementForwardMult +
+			                      backwardBlendMult * a_profile.movementBackwardMult;
+
+			// Forward -> arms move toward camera (negative Y in local space)
+			// Backward -> arms move away from camera (positive Y in local space)
+			targetPos.y = invertForwardBack * -normalizedInput * effectiveMult * blendedStrength;
+			// Slight Z adjustment for natural feel
+			targetPos.z += invertForwardBack * -normalizedInput * effectiveMult * blendedStrength * 0.3f;
+		}
+
+		// Clamp targets using per-weapon max values
+		targetPos = ClampVector(targetPos, a_profile.movementMaxOffset);
+		float maxRotRad = a_profile.movementMaxRotation;
+		targetRot = ClampVector(targetRot, maxRotRad);
+
+		// F = -k * (current - target) - c * velocity (mass = 1)
+		// Velocity limits come from SpringTraits<SpringCategory::kMovement>
+		a_bank.Stage(a_slot,
+			targetPos, { k, c, a_profile.movementMaxOffset }, true,
+			targetRot, { k, c, maxRotRad }, true);
+	}
+
+	void StageSprintSpring(SpringBank& a_bank, SpringSlot a_slot, const CompiledWeaponProfile& a_profile,
+		bool a_isSprinting, bool a_wasSprinting, SprintImpulseState& a_state, float a_delta)
+	{
+		FPI_TRACE_ZONE("Sprint spring");
+		if (!a_profile.sprintEnabled) {
+			// Quickly decay to zero when disabled
+			a_bank.Decay(a_slot, std::min(1.0f, a_delta * 10.0f));
+			a_state.blendProgress = 0.0f;
+			a_state.pendingPos = { 0.0f, 0.0f, 0.0f };
+			a_state.pendingRot = { 0.0f, 0.0f, 0.0f };
+			return;
+		}
+
+		// Detect sprint state transitions and set up impulse
+		if (a_isSprinting != a_wasSprinting) {
+			// Starting sprint - arms lag behind; stopping sprint - arms overshoot forward
+			a_state.pendingPos = a_isSprinting ? a_profile.sprintStartPosImpulse : a_profile.sprintStopPosImpulse;
+			a_state.pendingRot = a_isSprinting ? a_profile.sprintStartRotImpulse : a_profile.sprintStopRotImpulse;
+
+			// Set up blend
+			a_state.blendDuration = a_profile.sprintBlendTime;
+			a_state.blendProgress = 0.0f;
+
+			// If blend time is 0, apply instantly
+			if (a_state.blendDuration <= 0.001f) {
+				a_bank.AddVelocity(a_slot, a_state.pendingPos, a_state.pendingRot);
+				a_state.pendingPos = { 0.0f, 0.0f, 0.0f };
+				a_state.pendingRot = { 0.0f, 0.0f, 0.0f };
+				a_state.blendProgress = 1.0f;
+			}
+		}
+
+		// Apply pending impulse gradually if blending
+		if (a_state.IsBlending()) {
+			float prevProgress = a_state.blendProgress;
+			a_state.blendProgress = std::min(1.0f, a_state.blendProgress + a_delta / a_state.blendDuration);
+
+			// Apply the portion of impulse for this frame
+			float deltaProgress = a_state.blendProgress - prevProgress;
+			a_bank.AddVelocity(a_slot, a_state.pendingPos * deltaProgress, a_state.pendingRot * deltaProgress);
+
+			// Clear pending when done
+			if (a_state.blendProgress >= 1.0f) {
+				a_state.pendingPos = { 0.0f, 0.0f, 0.0f };
+				a_state.pendingRot = { 0.0f, 0.0f, 0.0f };
+			}
+		}
+
+		// Spring physics to settle back to zero (target is always neutral)
+		float k = a_profile.sprintStiffness;
+		float c = a_profile.sprintDamping;
+
+		// Velocity and offset limits come from SpringTraits<SpringCategory::kSprint>
+		using Traits = SpringTraits<SpringCategory::kSprint>;
+		a_bank.Stage(a_slot,
+			{ 0.0f, 0.0f, 0.0f }, { k, c, Traits::kMaxPosOffset }, true,
+			{ 0.0f, 0.0f, 0.0f }, { k, c, Traits::kMaxRotOffset }, true);
+	}
+
+	void StageJumpSpring(SpringBank& a_bank, SpringSlot a_slot, const CompiledWeaponProfile& a_profile,
+		const JumpInputs& a_inputs, JumpSpringState& a_state, float a_delta)
+	{
+		FPI_TRACE_ZONE("Jump spring");
+		if (!a_profile.jumpEnabled) {
+			// Quickly decay to zero when disabled
+			a_bank.Decay(a_slot, std::min(1.0f, a_delta * 10.0f));
+			return;
+		}
+
+		// Detect state transitions
+		if (a_inputs.isInAir && !a_inputs.wasInAir) {
+			// Just left the ground (jump or fall)
+			// Use airborne spring parameters
+			a_state.stiffness = a_profile.jumpStiffness;
+			a_state.damping = a_profile.jumpDamping;
+
+			if (a_inputs.didJump) {
+				// Player actually jumped - arms dip down and back as player pushes off
+				a_bank.AddVelocity(a_slot, a_profile.jumpPosImpulse, a_profile.jumpRotImpulse);
+			} else {
+				// Player fell off a ledge - slight downward/forward motion as arms follow momentum
+				a_bank.AddVelocity(a_slot, a_profile.fallPosImpulse, a_profile.fallRotImpulse);
+			}
+		} else if (a_inputs.landingDetected) {
+			// Just landed - switch to landing spring parameters (tighter)
+			a_state.stiffness = a_profile.landStiffness;
+			a_state.damping = a_profile.landDamping;
+
+			// Calculate how "settled" the spring currently is (0 = max energy, 1 = fully settled)
+			// This allows smooth blending if landing before jump spring has settled
+			float posEnergy = Length(a_bank.GetPositionOffset(a_slot));
+			float velEnergy = Length(a_bank.GetPositionVelocity(a_slot));
+
+			// Normalize energy (rough estimate based on typical max values)
+			float normalizedEnergy = std::clamp((posEnergy / 20.0f) + (velEnergy / 200.0f), 0.0f, 1.0f);
+
+			// Settled factor: 1 when spring is idle, 0 when spring has max energy
+			float settledFactor = 1.0f - normalizedEnergy;
+
+			// Calculate landing impulse scale based on air time
+			// Minimum 0.3 sec to register as significant landing, caps at ~2 sec
+			float normalizedAirTime = std::clamp((a_inputs.airTime - 0.1f) / 1.5f, 0.0f, 1.0f);
+
+			// If player didn't jump (just fell), use a different base scale
+			float baseScale = a_inputs.didJump ? 1.0f : 0.7f;
+
+			// Apply air time scaling with configurable exponent
+			float impulseScale = baseScale * (0.3f + normalizedAirTime * a_profile.airTimeImpulseScale);
+
+			// Blend landing impulse based on how settled the spring is
+			// If spring has lots of energy (unsettled), reduce landing impulse to avoid stacking
+			// Minimum 30% of landing impulse always applies to ensure landing feels responsive
+			float blendedScale = impulseScale * (0.3f + 0.7f * settledFactor);
+
+			// If spring is unsettled, also dampen existing velocity to transition smoothly
+			// This prevents the jump spring momentum from fighting the landing impulse
+			if (normalizedEnergy > 0.3f) {
+				float dampFactor = 0.5f + 0.5f * settledFactor;  // 0.5 to 1.0
+				a_bank.ScaleVelocity(a_slot, dampFactor);
+			}
+
+			// Landing impulse - arms compress down then bounce back
+			a_bank.AddVelocity(a_slot,
+				{ 0.0f, -a_profile.landImpulseY * blendedScale * 20.0f, -a_profile.landImpulseZ * blendedScale * 25.0f },
+				{ a_profile.landRotImpulse * blendedScale * 10.0f, 0.0f, 0.0f });
+		}
+
+		// Spring physics with current stiffness/damping
+		// Velocity and offset limits come from SpringTraits<SpringCategory::kJump>
+		using Traits = SpringTraits<SpringCategory::kJump>;
+		a_bank.Stage(a_slot,
+			{ 0.0f, 0.0f, 0.0f }, { a_state.stiffness, a_state.damping, Traits::kMaxPosOffset }, true,
+			{ 0.0f, 0.0f, 0.0f }, { a_state.stiffness, a_state.damping, Traits::kMaxRotOffset }, true);
+	}
+
+	float Advance(SpringBank& a_bank, SpringBank& a_previousTick, float& a_accumulator, float a_delta,
+		const SpringBank::IntegratorSet& a_integrators, const SpringBank::SubstepSet& a_maxSubsteps,
+		const TimestepConfig& a_config)
+	{
+		FPI_TRACE_ZONE("Integrate springs");
+		if (!a_config.fixed) {
+			a_bank.Integrate(a_delta, a_integrators, a_maxSubsteps);
+			a_previousTick = a_bank;
+			a_accumulator = 0.0f;
+			return 1.0f;
+		}
+
+		// Fixed timestep: step the bank at a constant rate regardless of framerate, then
+		// interpolate between the last two ticks by the leftover time when applying
+		const float fixedDelta = 1.0f / static_cast<float>(a_config.rateHz);
+		a_accumulator += a_delta;
+
+		int steps = static_cast<int>(a_accumulator / fixedDelta);
+		if (steps > a_config.maxSteps) {
+			// Hitch - drop the backlog instead of spiralling
+			steps = a_config.maxSteps;
+			a_accumulator = fixedDelta * static_cast<float>(steps);
+		}
+		a_accumulator -= fixedDelta * static_cast<float>(steps);
+
+		a_bank.Integrate(fixedDelta, a_integrators, a_maxSubsteps, steps, &a_previousTick);
+		return std::clamp(a_accumulator / fixedDelta, 0.0f, 1.0f);
+	}
+
+	void CompileStability(CompiledWeaponProfile& a_profile, float a_settleDampingMult)
+	{
+		struct Params
+		{
+			float stiffness;
+			float damping;
+		};
+
+		// Keep the parameter set with the smallest limit per integrator; report w/zeta of the stiffest
+		auto compile = [](SpringCategory a_category, std::initializer_list<Params> a_sets, CompiledWeaponProfile& a_out) {
+			auto& entry = a_out.stability[static_cast<std::size_t>(a_category)];
+			entry = {};
+			entry.maxSubstep.fill(std::numeric_limits<float>::infinity());
+			for (const Params& set : a_sets) {
+				const float w = std::sqrt(std::max(set.stiffness, 0.0f));
+				if (w >= entry.naturalFrequency) {
+					entry.naturalFrequency = w;
+					entry.dampingRatio = w > 0.0f ? set.damping / (2.0f * w) : 0.0f;
+				}
+				for (int i = 0; i < SpringBank::kIntegratorCount; ++i) {
+					const float limit = SpringBank::StableSubstep(static_cast<SpringIntegrator>(i), set.stiffness, set.damping);
+					entry.maxSubstep[i] = std::min(entry.maxSubstep[i], limit);
+				}
+			}
+		};
+
+		const JumpSpringState initialJump;
+		const float settledDamping = a_profile.cameraDamping * std::max(1.0f, a_settleDampingMult);
+		compile(SpringCategory::kCamera, { { a_profile.cameraStiffness, a_profile.cameraDamping }, { a_profile.cameraStiffness, settledDamping } }, a_profile);
+		compile(SpringCategory::kMovement, { { a_profile.movementStiffness, a_profile.movementDamping } }, a_profile);
+		compile(SpringCategory::kSprint, { { a_profile.sprintStiffness, a_profile.sprintDamping } }, a_profile);
+		compile(SpringCategory::kJump, { { a_profile.jumpStiffness, a_profile.jumpDamping }, { a_profile.landStiffness, a_profile.landDamping },
+			{ initialJump.stiffness, initialJump.damping } }, a_profile);
+		a_profile.stabilitySettleDampingMult = a_settleDampingMult;
+	}
+
+	SpringBank::SubstepSet SelectSubsteps(const CompiledWeaponProfile& a_profile, const SpringBank::IntegratorSet& a_integrators)
+	{
+		SpringBank::SubstepSet substeps;
+		for (std::size_t i = 0; i < substeps.size(); ++i) {
+			const auto integrator = std::clamp(static_cast<int>(a_integrators[i]), 0, SpringBank::kIntegratorCount - 1);
+			substeps[i] = a_profile.stability[i].maxSubstep[static_cast<std::size_t>(integrator)];
+		}
+		return substeps;
+	}
+
+	float StabilityReferenceDelta(const TimestepConfig& a_config)
+	{
+		return a_config.fixed ? 1.0f / static_cast<float>(std::max(a_config.rateHz, 1)) : kStabilityReferenceDelta;
+	}
+
+	SpringState ReadSpring(const SpringBank& a_bank, SpringSlot a_slot)
+	{
+		SpringState state;
+		state.positionOffset = a_bank.GetPositionOffset(a_slot);
+		state.positionVelocity = a_bank.GetPositionVelocity(a_slot);
+		state.rotationOffset = a_bank.GetRotationOffset(a_slot);
+		state.rotationVelocity = a_bank.GetRotationVelocity(a_slot);
+		return state;
+	}
+
+	SimultaneousScale ComputeSimultaneousScale(const SpringBank& a_bank, const HandSlots& a_slots,
+		const CompiledWeaponProfile& a_profile)
+	{
+		const Vec3 camPos = a_bank.GetPositionOffset(a_slots.camera);
+		const Vec3 camRot = a_bank.GetRotationOffset(a_slots.camera);
+		const Vec3 movPos = a_bank.GetPositionOffset(a_slots.movement);
+		const Vec3 movRot = a_bank.GetRotationOffset(a_slots.movement);
+
+		float camMagnitude = std::sqrt(camPos.x * camPos.x + camPos.z * camPos.z + camRot.x * camRot.x + camRot.z * camRot.z);
+		float movMagnitude = std::sqrt(movPos.x * movPos.x + movPos.y * movPos.y + movRot.z * movRot.z);
+
+		// Blend range: how far above threshold before full scaling applies
+		constexpr float BLEND_RANGE = 1.0f;  // Units above threshold for full blend
+
+		// Calculate how far above threshold each is (0 = at/below threshold, 1 = fully above blend range)
+		float camAboveThreshold = std::clamp((camMagnitude - a_profile.simultaneousThreshold) / BLEND_RANGE, 0.0f, 1.0f);
+		float movAboveThreshold = std::clamp((movMagnitude - a_profile.simultaneousThreshold) / BLEND_RANGE, 0.0f, 1.0f);
+
+		// Scaling only applies when BOTH are active, and blends based on the lesser one
+		float simultaneousBlend = camAboveThreshold * movAboveThreshold;
+
+		// Smoothstep for more natural feel (ease in/out)
+		simultaneousBlend = simultaneousBlend * simultaneousBlend * (3.0f - 2.0f * simultaneousBlend);
+
+		// Interpolate from 1.0 (no scaling) toward target mult based on blend
+		return {
+			1.0f + (a_profile.simultaneousCameraMult - 1.0f) * simultaneousBlend,
+			1.0f + (a_profile.simultaneousMovementMult - 1.0f) * simultaneousBlend
+		};
+	}
+
+	SpringState CombineSprings(const SpringBank& a_bank, const HandSlots& a_slots, float a_cameraWeight, float a_movementWeight)
+	{
+		FPI_TRACE_ZONE("Combine springs");
+		SpringState state;
+		state.positionOffset = a_bank.GetPositionOffset(a_slots.camera) * a_cameraWeight +
+			a_bank.GetPositionOffset(a_slots.movement) * a_movementWeight +
+			a_bank.GetPositionOffset(a_slots.sprint) + a_bank.GetPositionOffset(a_slots.jump);
+		state.rotationOffset = a_bank.GetRotationOffset(a_slots.camera) * a_cameraWeight +
+			a_bank.GetRotationOffset(a_slots.movement) * a_movementWeight +
+			a_bank.GetRotationOffset(a_slots.sprint) + a_bank.GetRotationOffset(a_slots.jump);
+		return state;
+	}
+
+	void ApplyOffset(Vec3& a_translate, Mat3& a_rotate, const SpringState& a_state,
+		bool a_enablePosition, bool a_enableRotation, int a_pivotPoint, bool a_expMapRotation)
+	{
+		const Vec3& positionOffset = a_state.positionOffset;
+		const Vec3& rotationOffset = a_state.rotationOffset;
+
+		// Apply position offset (ADDITIVE from both camera and movement springs)
+		if (a_enablePosition) {
+			a_translate.x += positionOffset.x;
+			a_translate.y += positionOffset.y;
+			a_translate.z += positionOffset.z;
+		}
+
+		if (!a_enableRotation ||
+			(std::abs(rotationOffset.x) <= 0.0001f &&
+			 std::abs(rotationOffset.y) <= 0.0001f &&
+			 std::abs(rotationOffset.z) <= 0.0001f)) {
+			return;
+		}
+
+		// Pivot compensation adds a translation so the rotation APPEARS to be around a different point
+		if (a_pivotPoint != 0) {  // 0 = Chest, no compensation needed
+			// Pivot offset is the approximate distance from spine to the pivot point
+			float pivotDistance = 0.0f;
+			switch (a_pivotPoint) {
+			case 1:  // Right hand
+			case 2:  // Left hand
+				pivotDistance = 35.0f;
+				break;
+			case 3:  // Weapon
+				pivotDistance = 50.0f;
+				break;
+			case 4:  // Both Clavicles (no compensation, applied at clavicle level)
+				pivotDistance = 0.0f;
+				break;
+			case 5:  // Both Clavicles with Offset - distance from clavicle to approximate hand position
+				pivotDistance = 35.0f;
+				break;
+			default:
+				break;
+			}
+
+			// Yaw rotation (around Z) causes X displacement at the pivot
+			a_translate.x += -pivotDistance * rotationOffset.z;
+			// Pitch rotation (around X) causes Y displacement at the pivot
+			a_translate.y += -pivotDistance * rotationOffset.x * 0.5f;
+		}
+
+		if (a_expMapRotation) {
+			// Small-angle exp map -> quaternion -> matrix (no trig calls)
+			RotationMath::ApplyExpMap(a_rotate, rotationOffset);
+		} else {
+			a_rotate = a_rotate * RotationMath::EulerToMatrix(rotationOffset);
+		}
+	}
+}
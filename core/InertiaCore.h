@@ -0,0 +1,303 @@
+#pragma once
+
+#include "Mat3.h"
+#include "SpringBank.h"
+#include "Vec3.h"
+
+#include <array>
+#include <cstddef>
+
+namespace Inertia
+{
+	// Spring state for tracking inertia
+	struct SpringState
+	{
+		// Position offset (local space)
+		Vec3 positionOffset{ 0.0f, 0.0f, 0.0f };
+		Vec3 positionVelocity{ 0.0f, 0.0f, 0.0f };
+
+		// Rotation offset (euler angles in radians)
+		Vec3 rotationOffset{ 0.0f, 0.0f, 0.0f };
+		Vec3 rotationVelocity{ 0.0f, 0.0f, 0.0f };
+
+		void Reset()
+		{
+			positionOffset = { 0.0f, 0.0f, 0.0f };
+			positionVelocity = { 0.0f, 0.0f, 0.0f };
+			rotationOffset = { 0.0f, 0.0f, 0.0f };
+			rotationVelocity = { 0.0f, 0.0f, 0.0f };
+		}
+	};
+
+	// Combat stance types (from Dynamic Weapon Movesets or Stances NG)
+	enum class Stance : int
+	{
+		Neutral = 0,
+		Low = 1,
+		Mid = 2,
+		High = 3,
+		COUNT = 4  // For array sizing
+	};
+
+	// Coefficients derived from the resolved weapon settings, in the form the spring updaters consume
+	// Rebuilt only when the weapon, preset version or menu edit generation changes - never per substep
+	// Holds everything the core reads from a weapon, so the core never sees WeaponInertiaSettings
+	struct CompiledWeaponProfile
+	{
+		// Camera spring (mass folded in; damping is scaled by the settling multiplier per frame)
+		float cameraStiffness{ 0.0f };          // stiffness / mass
+		float cameraDamping{ 0.0f };            // damping / mass
+		float cameraMaxOffset{ 0.0f };          // maxOffset
+		float cameraMaxRotation{ 0.0f };        // maxRotation in radians
+		float cameraTargetMaxOffset{ 0.0f };    // Target clamp: maxOffset * 2
+		float cameraTargetMaxRotation{ 0.0f };  // Target clamp: maxRotation * 2 (radians)
+		float cameraPitchPosScale{ 0.0f };      // 1.5 * cameraPitchMult
+		float cameraPitchRotScale{ 0.0f };      // 0.08 * pitchMultiplier * cameraPitchMult
+		float cameraRollRotScale{ 0.0f };       // 0.04 * rollMultiplier
+		float cameraAirMult{ 1.0f };            // cameraInertiaAirMult
+
+		// Movement spring
+		bool movementEnabled{ false };          // Per-weapon movementInertiaEnabled
+		float movementStiffness{ 0.0f };
+		float movementDamping{ 0.0f };
+		float movementMaxOffset{ 0.0f };
+		float movementMaxRotation{ 0.0f };      // movementMaxRotation in radians
+		float movementLeftMult{ 1.0f };
+		float movementRightMult{ 1.0f };
+		float movementForwardMult{ 1.0f };
+		float movementBackwardMult{ 1.0f };
+
+		// Sprint spring (impulses pre-scaled to velocity units, rotations in radians)
+		bool sprintEnabled{ false };
+		Vec3 sprintStartPosImpulse{ 0.0f, 0.0f, 0.0f };
+		Vec3 sprintStartRotImpulse{ 0.0f, 0.0f, 0.0f };
+		Vec3 sprintStopPosImpulse{ 0.0f, 0.0f, 0.0f };
+		Vec3 sprintStopRotImpulse{ 0.0f, 0.0f, 0.0f };
+		float sprintBlendTime{ 0.0f };
+		float sprintStiffness{ 0.0f };
+		float sprintDamping{ 0.0f };
+
+		// Jump spring (jump/fall impulses pre-scaled; landing is scaled by air time per landing)
+		bool jumpEnabled{ false };
+		Vec3 jumpPosImpulse{ 0.0f, 0.0f, 0.0f };
+		Vec3 jumpRotImpulse{ 0.0f, 0.0f, 0.0f };
+		Vec3 fallPosImpulse{ 0.0f, 0.0f, 0.0f };
+		Vec3 fallRotImpulse{ 0.0f, 0.0f, 0.0f };
+		float jumpStiffness{ 0.0f };
+		float jumpDamping{ 0.0f };
+		float landStiffness{ 0.0f };
+		float landDamping{ 0.0f };
+		float landImpulseY{ 0.0f };
+		float landImpulseZ{ 0.0f };
+		float landRotImpulse{ 0.0f };           // Radians
+		float airTimeImpulseScale{ 0.0f };
+
+		// Simultaneous camera + movement scaling
+		float simultaneousThreshold{ 0.0f };
+		float simultaneousCameraMult{ 1.0f };
+		float simultaneousMovementMult{ 1.0f };
+
+		// Per-stance lookups with the stance invert overrides already XORed into the base settings
+		struct StanceCoefficients
+		{
+			float multiplier{ 1.0f };
+			float cameraInvertPitch{ 1.0f };        // -1 = inverted
+			float cameraInvertYaw{ 1.0f };
+			float movementInvertLateral{ 1.0f };
+			float movementInvertForwardBack{ 1.0f };
+		};
+		std::array<StanceCoefficients, static_cast<std::size_t>(Stance::COUNT)> stances;
+
+		// Stability of each category's stiffest/most damped parameter set, built by Core::CompileStability
+		struct SpringStability
+		{
+			float naturalFrequency{ 0.0f };  // w = sqrt(k), rad/s
+			float dampingRatio{ 0.0f };      // zeta = c / (2 * w)
+			std::array<float, SpringBank::kIntegratorCount> maxSubstep{};  // SpringBank::StableSubstep per integrator
+		};
+		std::array<SpringStability, SpringBank::kCategoryCount> stability;
+		float stabilitySettleDampingMult{ 1.0f };  // settleDampingMult the camera entry was built with
+	};
+
+	// Game-independent inertia math
+	// Everything Update() does between reading the game state and storing the deferred offsets:
+	// camera velocity filtering, settling, blends, staging the springs and combining them.
+	// Builds without game headers (see Vec3.h) so it can be benchmarked and replayed off-line.
+	namespace Core
+	{
+		constexpr float kPi = 3.14159265358979323846f;
+		constexpr float kDegToRad = kPi / 180.0f;
+
+		struct TimestepConfig
+		{
+			bool fixed{ true };
+			int rateHz{ 120 };
+			int maxSteps{ 8 };
+
+			bool operator==(const TimestepConfig&) const = default;
+		};
+
+		// Global settings the core reads (a copy of the matching Settings fields)
+		struct CoreSettings
+		{
+			float globalIntensity{ 1.0f };
+			float smoothingFactor{ 0.5f };
+			float settleDelay{ 0.3f };
+			float settleSpeed{ 2.0f };
+			float settleDampingMult{ 3.0f };
+			bool enablePosition{ true };
+			bool enableRotation{ true };
+			bool movementInertiaEnabled{ true };
+			float movementInertiaStrength{ 3.0f };
+			float movementInertiaThreshold{ 30.0f };
+			bool forwardBackInertia{ false };
+			float actionBlendSpeed{ 5.0f };
+			float actionMinIntensity{ 0.2f };
+			SpringBank::IntegratorSet integrators{};
+			TimestepConfig timestep;
+
+			bool operator==(const CoreSettings&) const = default;
+		};
+
+		// The four slots one hand's springs live in
+		struct HandSlots
+		{
+			SpringSlot camera;
+			SpringSlot movement;
+			SpringSlot sprint;
+			SpringSlot jump;
+		};
+		constexpr HandSlots kRightHandSlots{ SpringSlot::kCamera, SpringSlot::kMovement, SpringSlot::kSprint, SpringSlot::kJump };
+		constexpr HandSlots kLeftHandSlots{ SpringSlot::kCameraLeft, SpringSlot::kMovementLeft, SpringSlot::kSprintLeft, SpringSlot::kJumpLeft };
+
+		// === VECTOR HELPERS ===
+		Vec3 ClampVector(const Vec3& a_vec, float a_max);
+		Vec3 LerpVector(const Vec3& a_from, const Vec3& a_to, float a_t);
+		float Length(const Vec3& a_vec);
+
+		// Step a_current towards a_target by at most a_maxStep
+		float MoveTowards(float a_current, float a_target, float a_maxStep);
+
+		// === CAMERA ===
+		struct CameraAngles
+		{
+			float yaw{ 0.0f };
+			float pitch{ 0.0f };
+			float roll{ 0.0f };
+		};
+
+		// Angular velocity from this frame's camera angles (yaw wrapped), clamped in magnitude and in
+		// change per second so frame drops don't spike the springs. Updates a_last and a_prevVelocity
+		Vec3 FilterCameraVelocity(const CameraAngles& a_current, CameraAngles& a_last, Vec3& a_prevVelocity, float a_delta);
+
+		// Settling - increased damping once the camera has stopped for settleDelay seconds
+		void UpdateSettling(const CoreSettings& a_settings, float a_cameraSpeed, float a_delta,
+			float& a_settlingFactor, float& a_timeSinceMovement);
+
+		// === BLENDS ===
+		// Equip/holster blend; returns the step it took so the caller can log it
+		struct EquipBlendStep
+		{
+			float target{ 0.0f };
+			float speed{ 0.0f };
+			float cappedDelta{ 0.0f };
+		};
+		EquipBlendStep StepEquipBlend(float& a_equipBlendFactor, bool a_weaponDrawn, float a_delta);
+
+		// Movement blends out while airborne, camera blends to the profile's air multiplier
+		void StepAirBlends(const CompiledWeaponProfile& a_profile, bool a_inAir, float a_delta,
+			float& a_movementAirBlend, float& a_cameraAirBlend);
+
+		// Movement input (-1..1 per axis, local space) scaled to a velocity and smoothed into a_smoothed
+		Vec3 SmoothMovementInput(Vec3& a_smoothed, float a_inputX, float a_inputY);
+
+		// === SPRING STAGING ===
+		// Each stager only sets targets/parameters (or applies impulses); SpringBank::Integrate advances them
+
+		// Camera spring - responds to camera rotation
+		void StageCameraSpring(SpringBank& a_bank, SpringSlot a_slot, const CoreSettings& a_settings,
+			const CompiledWeaponProfile& a_profile, const Vec3& a_cameraVelocity, float a_multiplier,
+			float a_settlingFactor, Stance a_stance = Stance::Neutral);
+
+		// Movement spring - target-based, responds to strafing and forward/back input
+		void StageMovementSpring(SpringBank& a_bank, SpringSlot a_slot, const CoreSettings& a_settings,
+			const CompiledWeaponProfile& a_profile, const Vec3& a_localMovement, float a_delta, float a_intensity,
+			Stance a_stance = Stance::Neutral);
+
+		// Sprint transition impulse, spread over sprintBlendTime
+		struct SprintImpulseState
+		{
+			float blendProgress{ 0.0f };   // Current blend progress (0-1)
+			float blendDuration{ 0.0f };   // Total blend duration for current impulse
+			Vec3 pendingPos{ 0.0f, 0.0f, 0.0f };  // Pending position impulse to blend
+			Vec3 pendingRot{ 0.0f, 0.0f, 0.0f };  // Pending rotation impulse to blend
+
+			bool IsBlending() const { return blendProgress < 1.0f && blendDuration > 0.001f; }
+		};
+		void StageSprintSpring(SpringBank& a_bank, SpringSlot a_slot, const CompiledWeaponProfile& a_profile,
+			bool a_isSprinting, bool a_wasSprinting, SprintImpulseState& a_state, float a_delta);
+
+		// Jump/landing impulses with air-time scaling and a stiffer spring after landing
+		struct JumpInputs
+		{
+			bool isInAir{ false };
+			bool wasInAir{ false };
+			bool didJump{ false };         // Jumped rather than fell
+			float airTime{ 0.0f };
+			bool landingDetected{ false };
+		};
+		struct JumpSpringState
+		{
+			float stiffness{ 40.0f };      // Current spring stiffness (changes on land)
+			float damping{ 3.0f };         // Current spring damping (changes on land)
+		};
+		void StageJumpSpring(SpringBank& a_bank, SpringSlot a_slot, const CompiledWeaponProfile& a_profile,
+			const JumpInputs& a_inputs, JumpSpringState& a_state, float a_delta);
+
+		// === TIMESTEP ===
+		// Integrate the staged bank for this frame and return the interpolation alpha (1 = latest tick)
+		// Fixed: whole ticks from the accumulator, a_previousTick = bank one tick earlier
+		// Variable: one a_delta step, a_previousTick = result
+		float Advance(SpringBank& a_bank, SpringBank& a_previousTick, float& a_accumulator, float a_delta,
+			const SpringBank::IntegratorSet& a_integrators, const SpringBank::SubstepSet& a_maxSubsteps,
+			const TimestepConfig& a_config);
+
+		// === STABILITY ===
+		// Longest frame a variable timestep has to stay stable through (the fixed timestep steps one tick)
+		constexpr float kStabilityReferenceDelta = 0.1f;
+
+		// Fill a_profile.stability from its spring parameters, once per profile
+		// Camera assumes fully settled damping (a_settleDampingMult); jump covers its airborne,
+		// landing and initial (JumpSpringState) parameters
+		void CompileStability(CompiledWeaponProfile& a_profile, float a_settleDampingMult);
+
+		// Per-category substep limits for the selected integrators
+		SpringBank::SubstepSet SelectSubsteps(const CompiledWeaponProfile& a_profile, const SpringBank::IntegratorSet& a_integrators);
+
+		// Longest single step Advance() integrates with a_config
+		float StabilityReferenceDelta(const TimestepConfig& a_config);
+
+		// === COMBINE ===
+		// Snapshot one slot of the spring bank
+		SpringState ReadSpring(const SpringBank& a_bank, SpringSlot a_slot);
+
+		// Camera/movement scaling when both are active at once (smoothstep above simultaneousThreshold)
+		struct SimultaneousScale
+		{
+			float camera{ 1.0f };
+			float movement{ 1.0f };
+		};
+		SimultaneousScale ComputeSimultaneousScale(const SpringBank& a_bank, const HandSlots& a_slots,
+			const CompiledWeaponProfile& a_profile);
+
+		// Sum one hand's four slots (camera and movement weighted, sprint and jump as-is)
+		SpringState CombineSprings(const SpringBank& a_bank, const HandSlots& a_slots, float a_cameraWeight, float a_movementWeight);
+
+		// === APPLY ===
+		// Add a combined offset to a node transform: translation, pivot compensation for the weapon's
+		// pivot point (0 = chest ... 5 = both clavicles with offset), then the rotation as Euler XYZ
+		// angles, or as an exp map with a_expMapRotation (Settings::expMapRotation, see RotationMath.h)
+		void ApplyOffset(Vec3& a_translate, Mat3& a_rotate, const SpringState& a_state,
+			bool a_enablePosition, bool a_enableRotation, int a_pivotPoint, bool a_expMapRotation);
+	}
+}
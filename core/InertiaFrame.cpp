@@ -0,0 +1,333 @@
+#include "InertiaFrame.h"
+#include "PerfHistogram.h"
+#include "TraceZones.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Inertia::Core
+{
+	namespace
+	{
+		// Wake a slot if its input crossed the wake threshold; returns true if the slot should update
+		bool WakeSlot(FrameState& a_state, SpringSlot a_slot, bool a_wake)
+		{
+			auto& asleep = a_state.slotAsleep[static_cast<int>(a_slot)];
+			if (a_wake) {
+				asleep = false;
+			} else if (asleep) {
+				a_state.avoidedUpdates++;
+			}
+			return !asleep;
+		}
+
+		// Put slots that were updated this frame to sleep once their energy is negligible
+		void SleepSettledSlots(FrameState& a_state, bool a_dualClavicle)
+		{
+			// Same thresholds OnFirstPersonUpdate uses to skip negligible offsets (squared)
+			constexpr float SLEEP_POS_ENERGY = 0.01f * 0.01f;
+			constexpr float SLEEP_ROT_ENERGY = 0.0001f * 0.0001f;
+
+			for (int i = 0; i < SpringBank::kSlotCount; ++i) {
+				auto slot = static_cast<SpringSlot>(i);
+				bool isLeftSlot = (i % 2) == 1;
+				if (a_state.slotAsleep[i] || (isLeftSlot && !a_dualClavicle)) {
+					continue;
+				}
+
+				if (a_state.springBank.IsAtRest(slot, SLEEP_POS_ENERGY, SLEEP_ROT_ENERGY)) {
+					// Snap to exact rest so the combine and interpolation see zeros
+					a_state.springBank.Reset(slot);
+					a_state.previousTickBank.Reset(slot);
+					a_state.slotAsleep[i] = true;
+				}
+			}
+		}
+
+		// Laps a steady clock into StageTimes; does nothing without a StageTimes to fill
+		class StageClock
+		{
+		public:
+			explicit StageClock(StageTimes* a_times) :
+				times(a_times)
+			{
+				if (times) {
+					last = Perf::Now();
+				}
+			}
+
+			void Lap(StageTimes::Stage StageTimes::*a_stage)
+			{
+				if (!times) {
+					return;
+				}
+				const std::uint64_t now = Perf::Now();
+				auto& stage = times->*a_stage;
+				stage.ns += Perf::TicksToNs(now - last);
+				stage.laps++;
+				last = now;
+			}
+
+		private:
+			StageTimes* times;
+			std::uint64_t last{ 0 };
+		};
+
+		bool AnyAwake(const FrameState& a_state, const HandSlots& a_slots)
+		{
+			return !a_state.slotAsleep[static_cast<int>(a_slots.camera)] || !a_state.slotAsleep[static_cast<int>(a_slots.movement)] ||
+				!a_state.slotAsleep[static_cast<int>(a_slots.sprint)] || !a_state.slotAsleep[static_cast<int>(a_slots.jump)];
+		}
+	}
+
+	void FrameState::ResetSprings()
+	{
+		springBank.ResetAll();
+		previousTickBank.ResetAll();
+		physicsAccumulator = 0.0f;
+		slotAsleep.fill(false);
+		initialized = false;
+		prevCameraVelocity = { 0.0f, 0.0f, 0.0f };
+		smoothedCameraVelocity = { 0.0f, 0.0f, 0.0f };
+		smoothedLocalMovement = { 0.0f, 0.0f, 0.0f };
+
+		isSprinting = false;
+		wasSprinting = false;
+		sprintImpulse = {};
+
+		isInAir = false;
+		wasInAir = false;
+		didJump = false;
+		airTime = 0.0f;
+		landingCooldown = 0.0f;
+		movementAirBlend = 1.0f;
+		cameraAirBlend = 1.0f;
+		jumpSpring = {};
+	}
+
+	bool StepCamera(FrameState& a_state, const FrameInputs& a_inputs, const CoreSettings& a_settings)
+	{
+		FPI_TRACE_ZONE("StepCamera");
+		// Calculate camera velocity, then smooth it to reduce jitter
+		Vec3 rawCameraVelocity = FilterCameraVelocity(a_inputs.camera, a_state.lastCameraAngles, a_state.prevCameraVelocity, a_inputs.delta);
+		a_state.smoothedCameraVelocity = LerpVector(a_state.smoothedCameraVelocity, rawCameraVelocity, 1.0f - a_settings.smoothingFactor);
+
+		// Skip first frame to initialize camera tracking
+		if (!a_state.initialized) {
+			a_state.initialized = true;
+			a_state.settlingFactor = 0.0f;
+			a_state.timeSinceMovement = 0.0f;
+			return false;
+		}
+
+		// Calculate settling factor based on camera movement
+		// When camera is moving, reset settling. When stopped, gradually increase damping.
+		a_state.cameraSpeed = Length(a_state.smoothedCameraVelocity);
+		UpdateSettling(a_settings, a_state.cameraSpeed, a_inputs.delta, a_state.settlingFactor, a_state.timeSinceMovement);
+
+		// Action blending - reduce intensity during attacks/bow draw/spells
+		float targetBlend = a_inputs.inAction ? a_settings.actionMinIntensity : 1.0f;
+		a_state.actionBlendFactor = MoveTowards(a_state.actionBlendFactor, targetBlend, a_inputs.delta * a_settings.actionBlendSpeed);
+		return true;
+	}
+
+	void StepSprings(FrameState& a_state, const FrameInputs& a_inputs, const CoreSettings& a_settings,
+		const CompiledWeaponProfile& a_profile, FrameOutput& a_output, StageTimes* a_times)
+	{
+		FPI_TRACE_ZONE("StepSprings");
+		const float delta = a_inputs.delta;
+		FrameState& s = a_state;
+		StageClock clock(a_times);
+
+		// Movement input must be smoothed before the springs are staged
+		SmoothMovementInput(s.smoothedLocalMovement, a_inputs.moveInputX, a_inputs.moveInputY);
+
+		// Sprint state
+		s.wasSprinting = s.isSprinting;
+		s.isSprinting = a_inputs.sprinting;
+
+		// Jump/air state
+		s.wasInAir = s.isInAir;
+		bool currentlyInAir = a_inputs.inMidair;
+
+		if (s.landingCooldown > 0.0f) {
+			s.landingCooldown -= delta;
+		}
+
+		// Just left the ground - jumped (bInJumpState) or fell; reset air time
+		if (currentlyInAir && !s.wasInAir) {
+			s.didJump = a_inputs.inJumpState;
+			s.airTime = 0.0f;
+		}
+
+		if (currentlyInAir) {
+			s.airTime += delta;
+		}
+
+		// Air -> ground transition counts as a landing (cooldown prevents multiple triggers)
+		s.landingDetected = false;
+		if (!currentlyInAir && s.wasInAir && s.landingCooldown <= 0.0f) {
+			s.landingDetected = true;
+			s.landingCooldown = 0.25f;
+		}
+
+		s.isInAir = currentlyInAir;
+
+		// Blend movement inertia out while in air (back in when grounded), camera to its air multiplier
+		StepAirBlends(a_profile, s.isInAir, delta, s.movementAirBlend, s.cameraAirBlend);
+
+		// Stance affects the intensity multiplier for all inertia
+		s.previousStance = s.currentStance;
+		s.currentStance = a_inputs.stance;
+		float stanceMultiplier = a_profile.stances[static_cast<std::size_t>(s.currentStance)].multiplier;
+
+		// *** SLEEP / WAKE ***
+		// Settled springs sleep and skip staging/integration until their own input wakes them
+		// A stance change wakes everything since it changes every spring's intensity
+		constexpr float CAMERA_WAKE_THRESHOLD = 0.05f;  // Smoothed camera speed
+		bool stanceChanged = s.currentStance != s.previousStance;
+		bool wakeCamera = stanceChanged || s.cameraSpeed > CAMERA_WAKE_THRESHOLD;
+		bool wakeMovement = stanceChanged ||
+			std::abs(s.smoothedLocalMovement.x) > a_settings.movementInertiaThreshold ||
+			std::abs(s.smoothedLocalMovement.y) > a_settings.movementInertiaThreshold;
+		bool wakeSprint = stanceChanged || s.isSprinting != s.wasSprinting || s.sprintImpulse.IsBlending();
+		bool wakeJump = stanceChanged || s.isInAir != s.wasInAir || s.landingDetected;
+
+		// Camera and movement intensity fade with the equip blend so built-up spring state
+		// doesn't suddenly appear when drawing a weapon
+		s.cameraIntensity = s.actionBlendFactor * s.equipBlendFactor * stanceMultiplier;
+		s.movementIntensity = s.actionBlendFactor * s.equipBlendFactor * stanceMultiplier;
+
+		const bool dual = a_inputs.dualClavicle;
+		clock.Lap(&StageTimes::state);
+
+		if (WakeSlot(s, SpringSlot::kCamera, wakeCamera)) {
+			StageCameraSpring(s.springBank, SpringSlot::kCamera, a_settings, a_profile, s.smoothedCameraVelocity,
+				s.cameraIntensity, s.settlingFactor, s.currentStance);
+		}
+		clock.Lap(&StageTimes::camera);
+		if (WakeSlot(s, SpringSlot::kMovement, wakeMovement)) {
+			StageMovementSpring(s.springBank, SpringSlot::kMovement, a_settings, a_profile, s.smoothedLocalMovement,
+				delta, s.movementIntensity, s.currentStance);
+		}
+		clock.Lap(&StageTimes::movement);
+
+		// Left hand springs use the same input but keep separate state for natural asymmetry
+		if (dual) {
+			if (WakeSlot(s, SpringSlot::kCameraLeft, wakeCamera)) {
+				StageCameraSpring(s.springBank, SpringSlot::kCameraLeft, a_settings, a_profile, s.smoothedCameraVelocity,
+					s.cameraIntensity, s.settlingFactor, s.currentStance);
+			}
+			clock.Lap(&StageTimes::camera);
+			if (WakeSlot(s, SpringSlot::kMovementLeft, wakeMovement)) {
+				StageMovementSpring(s.springBank, SpringSlot::kMovementLeft, a_settings, a_profile, s.smoothedLocalMovement,
+					delta, s.movementIntensity, s.currentStance);
+			}
+			clock.Lap(&StageTimes::movement);
+		}
+
+		if (WakeSlot(s, SpringSlot::kSprint, wakeSprint)) {
+			StageSprintSpring(s.springBank, SpringSlot::kSprint, a_profile, s.isSprinting, s.wasSprinting, s.sprintImpulse, delta);
+		}
+		clock.Lap(&StageTimes::sprint);
+
+		const JumpInputs jumpInputs{ s.isInAir, s.wasInAir, s.didJump, s.airTime, s.landingDetected };
+		if (WakeSlot(s, SpringSlot::kJump, wakeJump)) {
+			StageJumpSpring(s.springBank, SpringSlot::kJump, a_profile, jumpInputs, s.jumpSpring, delta);
+		}
+		clock.Lap(&StageTimes::jump);
+
+		// Left hand sprint/jump share the right hand's progress (after its update) but not its spring state
+		if (dual) {
+			SprintImpulseState sprintImpulseLeft = s.sprintImpulse;
+			if (WakeSlot(s, SpringSlot::kSprintLeft, wakeSprint)) {
+				StageSprintSpring(s.springBank, SpringSlot::kSprintLeft, a_profile, s.isSprinting, s.wasSprinting, sprintImpulseLeft, delta);
+			}
+			clock.Lap(&StageTimes::sprint);
+
+			JumpSpringState jumpSpringLeft = s.jumpSpring;
+			if (WakeSlot(s, SpringSlot::kJumpLeft, wakeJump)) {
+				StageJumpSpring(s.springBank, SpringSlot::kJumpLeft, a_profile, jumpInputs, jumpSpringLeft, delta);
+			}
+			clock.Lap(&StageTimes::jump);
+		}
+
+		// Nothing awake - every spring is at rest, so there is nothing to integrate, combine or apply
+		if (!AnyAwake(s, kRightHandSlots) && !(dual && AnyAwake(s, kLeftHandSlots))) {
+			s.physicsAccumulator = 0.0f;
+			a_output.hasOffsets = false;
+			return;
+		}
+
+		// Every slot staged above is advanced together; unstaged slots (e.g. left hand outside
+		// dual clavicle mode, or disabled spring types) keep their current state
+		const float interpolationAlpha = Advance(s.springBank, s.previousTickBank, s.physicsAccumulator, delta,
+			a_settings.integrators, SelectSubsteps(a_profile, a_settings.integrators), a_settings.timestep);
+
+		SleepSettledSlots(s, dual);
+		clock.Lap(&StageTimes::integrate);
+
+		// Camera (blended by air mult), movement (blended out in air), sprint and jump all contribute
+		// Camera and movement are scaled down when both are active at once
+		const SimultaneousScale simultaneous = ComputeSimultaneousScale(s.springBank, kRightHandSlots, a_profile);
+		const float camWeight = s.cameraAirBlend * s.equipBlendFactor * simultaneous.camera;
+		const float movWeight = s.movementAirBlend * s.equipBlendFactor * simultaneous.movement;
+
+		// Latest tick and, when interpolating, the previous one - weighted identically
+		a_output.combinedState = CombineSprings(s.springBank, kRightHandSlots, camWeight, movWeight);
+		a_output.previousState = a_output.combinedState;
+		if (interpolationAlpha < 1.0f) {
+			a_output.previousState = CombineSprings(s.previousTickBank, kRightHandSlots, camWeight, movWeight);
+		}
+
+		a_output.combinedStateLeft = {};
+		a_output.previousStateLeft = {};
+		if (dual) {
+			a_output.combinedStateLeft = CombineSprings(s.springBank, kLeftHandSlots, camWeight, movWeight);
+			a_output.previousStateLeft = a_output.combinedStateLeft;
+			if (interpolationAlpha < 1.0f) {
+				a_output.previousStateLeft = CombineSprings(s.previousTickBank, kLeftHandSlots, camWeight, movWeight);
+			}
+		}
+
+		a_output.hasOffsets = true;
+		a_output.useDualClaviclePivot = dual;
+		a_output.interpolationAlpha = interpolationAlpha;
+		clock.Lap(&StageTimes::combine);
+	}
+
+	void StepFrame(FrameState& a_state, const FrameInputs& a_inputs, const CoreSettings& a_settings,
+		const CompiledWeaponProfile& a_profile, FrameOutput& a_output)
+	{
+		if (!StepCamera(a_state, a_inputs, a_settings)) {
+			return;
+		}
+		StepSprings(a_state, a_inputs, a_settings, a_profile, a_output);
+	}
+
+	Pose MakePose(const FrameOutput& a_output, int a_pivotPoint)
+	{
+		FPI_TRACE_ZONE("MakePose");
+		// Same blend OnFirstPersonUpdate used to do: alpha 1 (per-frame stepping) is the latest tick as-is
+		const float alpha = a_output.interpolationAlpha;
+		auto interpolate = [alpha](const SpringState& a_previous, const SpringState& a_current) {
+			return Pose::Offset{
+				a_previous.positionOffset + (a_current.positionOffset - a_previous.positionOffset) * alpha,
+				a_previous.rotationOffset + (a_current.rotationOffset - a_previous.rotationOffset) * alpha
+			};
+		};
+
+		Pose pose;
+		pose.hasOffsets = a_output.hasOffsets;
+		pose.useDualClaviclePivot = a_output.useDualClaviclePivot;
+		pose.pivotPoint = a_pivotPoint;
+		pose.right = interpolate(a_output.previousState, a_output.combinedState);
+		pose.left = interpolate(a_output.previousStateLeft, a_output.combinedStateLeft);
+		return pose;
+	}
+
+	int CountSleepingSlots(const FrameState& a_state)
+	{
+		return static_cast<int>(std::count(a_state.slotAsleep.begin(), a_state.slotAsleep.end(), true));
+	}
+}
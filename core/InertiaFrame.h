@@ -0,0 +1,150 @@
+#pragma once
+
+#include "InertiaCore.h"
+
+#include <cstdint>
+
+namespace Inertia::Core
+{
+	// Everything Update() reads from the game for one frame, after the weapon has been resolved
+	struct FrameInputs
+	{
+		float delta{ 0.0f };
+		CameraAngles camera;             // Player AngleZ (yaw), AngleX (pitch), roll
+		float moveInputX{ 0.0f };        // PlayerControls moveInputVec (-1..1, local space)
+		float moveInputY{ 0.0f };
+		bool inAction{ false };          // Attacking, drawing a bow or casting
+		bool sprinting{ false };
+		bool inMidair{ false };
+		bool inJumpState{ false };       // bInJumpState - jumped rather than fell (read on leaving the ground)
+		Stance stance{ Stance::Neutral };
+		bool dualClavicle{ false };      // Left hand slots in use (dual clavicle pivot while dual wielding)
+	};
+
+	// What Update() hands to OnFirstPersonUpdate
+	struct FrameOutput
+	{
+		bool hasOffsets{ false };        // False while every spring sleeps (nothing to apply)
+		bool useDualClaviclePivot{ false };
+		SpringState combinedState;       // Right hand / main spine offsets
+		SpringState combinedStateLeft;   // Left hand offsets (for dual clavicle)
+		SpringState previousState;       // combinedState one physics tick earlier (fixed timestep)
+		SpringState previousStateLeft;   // combinedStateLeft one physics tick earlier (fixed timestep)
+		float interpolationAlpha{ 1.0f };  // 0 = previous tick, 1 = latest tick
+	};
+
+	// Compact pose OnFirstPersonUpdate applies: FrameOutput with the two physics ticks already
+	// blended by the interpolation alpha, and only the offsets (handed over in a TripleBuffer)
+	struct Pose
+	{
+		struct Offset
+		{
+			Vec3 position;
+			Vec3 rotation;
+		};
+
+		bool hasOffsets{ false };        // False when there is nothing to apply
+		bool useDualClaviclePivot{ false };
+		std::int32_t pivotPoint{ 0 };    // Per-weapon pivot point ApplyOffset compensates for
+		Offset right;                    // Right hand / main spine
+		Offset left;                     // Left hand (dual clavicle)
+	};
+
+	// Time spent in each stage of one or more StepSprings calls (bench only - see core/bench)
+	// Left hand stages add to the matching right hand stage; laps counts the timed sections
+	struct StageTimes
+	{
+		struct Stage
+		{
+			double ns{ 0.0 };
+			int laps{ 0 };
+		};
+		Stage state;      // Movement/sprint/air/stance state and wake flags
+		Stage camera;     // Camera spring staging
+		Stage movement;   // Movement spring staging
+		Stage sprint;     // Sprint spring staging
+		Stage jump;       // Jump spring staging
+		Stage integrate;  // Advance + sleeping settled slots
+		Stage combine;    // Simultaneous scale + CombineSprings for both ticks
+	};
+
+	// Everything Update() carries from one frame to the next
+	struct FrameState
+	{
+		// Spring states - camera, movement, sprint and jump (plus left hand twins) in one SoA bank
+		// previousTickBank holds the bank one physics tick earlier for fixed timestep interpolation
+		SpringBank springBank;
+		SpringBank previousTickBank;
+		float physicsAccumulator{ 0.0f };
+
+		// Sleep/wake - a slot sleeps once settled at rest and is skipped until its input wakes it
+		std::array<bool, SpringBank::kSlotCount> slotAsleep{};
+		int avoidedUpdates{ 0 };         // Slot updates skipped since the owner last cleared it
+
+		// Camera velocity tracking
+		bool initialized{ false };       // First frame only primes the camera angles
+		CameraAngles lastCameraAngles;
+		Vec3 prevCameraVelocity{ 0.0f, 0.0f, 0.0f };     // Unsmoothed, for the change-per-second clamp
+		Vec3 smoothedCameraVelocity{ 0.0f, 0.0f, 0.0f };
+
+		// Settling system - increased damping when camera stops moving
+		float settlingFactor{ 0.0f };    // 0 = full spring, 1 = heavily damped (settling)
+		float timeSinceMovement{ 0.0f }; // How long since camera was moving
+
+		// Blends
+		float actionBlendFactor{ 1.0f }; // 1 = full intensity, actionMinIntensity during attacks/casting
+		float equipBlendFactor{ 0.0f };  // 0 = sheathed, 1 = fully drawn (stepped by the owner)
+		float movementAirBlend{ 1.0f };  // 0 = in air, 1 = grounded
+		float cameraAirBlend{ 1.0f };    // Blends to cameraAirMult when in air
+
+		// Movement input
+		Vec3 smoothedLocalMovement{ 0.0f, 0.0f, 0.0f };
+
+		// Sprint transition inertia
+		bool isSprinting{ false };
+		bool wasSprinting{ false };
+		SprintImpulseState sprintImpulse;  // Shared by both hands
+
+		// Jump/landing inertia
+		bool isInAir{ false };
+		bool wasInAir{ false };
+		bool didJump{ false };           // True if player jumped (vs just falling)
+		float airTime{ 0.0f };           // Time spent in air (for landing impulse scaling)
+		float landingCooldown{ 0.0f };   // Cooldown to prevent multiple landing impulses
+		JumpSpringState jumpSpring;
+
+		// Stance
+		Stance currentStance{ Stance::Neutral };
+		Stance previousStance{ Stance::Neutral };
+
+		// Last frame's derived values (read by the owner's debug logging)
+		float cameraSpeed{ 0.0f };
+		float cameraIntensity{ 0.0f };
+		float movementIntensity{ 0.0f };
+		bool landingDetected{ false };
+
+		// Clear the springs and the per-spring input state (camera angles, stance and the
+		// settling/action/equip blends are left to the owner, which resets them case by case)
+		void ResetSprings();
+	};
+
+	// Camera half of the frame: velocity filtering and smoothing, settling and the action blend
+	// Runs even while the weapon's inertia is disabled. Returns false on the priming frame.
+	bool StepCamera(FrameState& a_state, const FrameInputs& a_inputs, const CoreSettings& a_settings);
+
+	// Spring half of the frame: movement/sprint/air/stance state, sleep/wake, staging every awake
+	// slot, integration and the combine. a_output.hasOffsets is false when every spring sleeps.
+	// a_times (optional) accumulates per-stage timings; the plugin passes nullptr.
+	void StepSprings(FrameState& a_state, const FrameInputs& a_inputs, const CoreSettings& a_settings,
+		const CompiledWeaponProfile& a_profile, FrameOutput& a_output, StageTimes* a_times = nullptr);
+
+	// Both halves, for tools that have no weapon master switch to honour
+	void StepFrame(FrameState& a_state, const FrameInputs& a_inputs, const CoreSettings& a_settings,
+		const CompiledWeaponProfile& a_profile, FrameOutput& a_output);
+
+	// Pose for a_output (interpolated between its previous and latest tick)
+	Pose MakePose(const FrameOutput& a_output, int a_pivotPoint);
+
+	// Number of slots currently asleep
+	int CountSleepingSlots(const FrameState& a_state);
+}
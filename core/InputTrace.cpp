@@ -0,0 +1,243 @@
+#include "InputTrace.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace Inertia::Trace
+{
+	namespace
+	{
+		void Store(Offsets& a_offsets, const SpringState& a_state)
+		{
+			a_offsets.position[0] = a_state.positionOffset.x;
+			a_offsets.position[1] = a_state.positionOffset.y;
+			a_offsets.position[2] = a_state.positionOffset.z;
+			a_offsets.rotation[0] = a_state.rotationOffset.x;
+			a_offsets.rotation[1] = a_state.rotationOffset.y;
+			a_offsets.rotation[2] = a_state.rotationOffset.z;
+		}
+
+		SpringState Load(const Offsets& a_offsets)
+		{
+			SpringState state;
+			state.positionOffset = { a_offsets.position[0], a_offsets.position[1], a_offsets.position[2] };
+			state.rotationOffset = { a_offsets.rotation[0], a_offsets.rotation[1], a_offsets.rotation[2] };
+			return state;
+		}
+	}
+
+	FileHeader MakeHeader()
+	{
+		FileHeader header;
+		header.headerSize = static_cast<std::uint16_t>(sizeof(FileHeader));
+		header.settingsSize = static_cast<std::uint32_t>(sizeof(Core::CoreSettings));
+		header.profileSize = static_cast<std::uint32_t>(sizeof(ProfileRecord));
+		header.frameSize = static_cast<std::uint32_t>(sizeof(FrameRecord));
+		header.stateSize = static_cast<std::uint32_t>(sizeof(Core::FrameState));
+		return header;
+	}
+
+	bool IsCompatible(const FileHeader& a_header)
+	{
+		const FileHeader expected = MakeHeader();
+		return a_header.magic == expected.magic &&
+			a_header.version == expected.version &&
+			a_header.headerSize == expected.headerSize &&
+			a_header.settingsSize == expected.settingsSize &&
+			a_header.profileSize == expected.profileSize &&
+			a_header.frameSize == expected.frameSize &&
+			a_header.stateSize == expected.stateSize;
+	}
+
+	Core::FrameInputs ToFrameInputs(const FrameRecord& a_record)
+	{
+		Core::FrameInputs inputs;
+		inputs.delta = a_record.delta;
+		inputs.camera = { a_record.yaw, a_record.pitch, 0.0f };
+		inputs.moveInputX = a_record.moveInputX;
+		inputs.moveInputY = a_record.moveInputY;
+		inputs.inAction = (a_record.flags & kInAction) != 0;
+		inputs.sprinting = (a_record.flags & kSprinting) != 0;
+		inputs.inMidair = (a_record.flags & kInMidair) != 0;
+		inputs.inJumpState = (a_record.flags & kInJumpState) != 0;
+		inputs.stance = static_cast<Stance>(a_record.stance);
+		inputs.dualClavicle = (a_record.flags & kDualClavicle) != 0;
+		return inputs;
+	}
+
+	void StoreInputs(FrameRecord& a_record, const Core::FrameInputs& a_inputs)
+	{
+		a_record.delta = a_inputs.delta;
+		a_record.yaw = a_inputs.camera.yaw;
+		a_record.pitch = a_inputs.camera.pitch;
+		a_record.moveInputX = a_inputs.moveInputX;
+		a_record.moveInputY = a_inputs.moveInputY;
+		a_record.stance = static_cast<std::uint8_t>(a_inputs.stance);
+
+		std::uint16_t flags = 0;
+		if (a_inputs.inAction) flags |= kInAction;
+		if (a_inputs.sprinting) flags |= kSprinting;
+		if (a_inputs.inMidair) flags |= kInMidair;
+		if (a_inputs.inJumpState) flags |= kInJumpState;
+		if (a_inputs.dualClavicle) flags |= kDualClavicle;
+		a_record.flags |= flags;
+	}
+
+	void StoreOutput(FrameRecord& a_record, const Core::FrameOutput& a_output)
+	{
+		if (!a_output.hasOffsets) {
+			a_record.flags &= static_cast<std::uint16_t>(~kHasOffsets);
+			return;
+		}
+		a_record.flags |= kHasOffsets;
+		a_record.interpolationAlpha = a_output.interpolationAlpha;
+		Store(a_record.combined, a_output.combinedState);
+		Store(a_record.previous, a_output.previousState);
+		Store(a_record.combinedLeft, a_output.combinedStateLeft);
+		Store(a_record.previousLeft, a_output.previousStateLeft);
+	}
+
+	Core::FrameOutput ToFrameOutput(const FrameRecord& a_record)
+	{
+		Core::FrameOutput output;
+		output.hasOffsets = (a_record.flags & kHasOffsets) != 0;
+		output.useDualClaviclePivot = (a_record.flags & kDualClavicle) != 0;
+		if (output.hasOffsets) {
+			output.interpolationAlpha = a_record.interpolationAlpha;
+			output.combinedState = Load(a_record.combined);
+			output.previousState = Load(a_record.previous);
+			output.combinedStateLeft = Load(a_record.combinedLeft);
+			output.previousStateLeft = Load(a_record.previousLeft);
+		}
+		return output;
+	}
+
+	bool ReadTrace(const std::filesystem::path& a_path, TraceData& a_trace, std::string& a_error)
+	{
+		std::ifstream file(a_path, std::ios::binary);
+		if (!file) {
+			a_error = "cannot open file";
+			return false;
+		}
+		const std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+		FileHeader header;
+		if (data.size() < sizeof(header)) {
+			a_error = "file too short for a trace header";
+			return false;
+		}
+		std::memcpy(&header, data.data(), sizeof(header));
+		if (header.magic != kMagic) {
+			a_error = "not an FPInertia trace";
+			return false;
+		}
+		if (!IsCompatible(header)) {
+			a_error = "trace was recorded by a build with a different record layout";
+			return false;
+		}
+
+		a_trace = TraceData{};
+		std::size_t pos = sizeof(header);
+		bool hasSettings = false;
+		while (pos < data.size()) {
+			const auto type = static_cast<RecordType>(data[pos]);
+			std::size_t size = 0;
+			switch (type) {
+			case RecordType::kSettings:
+				size = sizeof(Core::CoreSettings);
+				break;
+			case RecordType::kProfile:
+				size = sizeof(ProfileRecord);
+				break;
+			case RecordType::kFrame:
+				size = sizeof(FrameRecord);
+				break;
+			case RecordType::kState:
+				size = sizeof(Core::FrameState);
+				break;
+			default:
+				a_error = "unknown record type at offset " + std::to_string(pos);
+				return false;
+			}
+
+			if (pos + 1 + size > data.size()) {
+				a_trace.truncated = true;
+				break;
+			}
+			const char* payload = data.data() + pos + 1;
+			pos += 1 + size;
+
+			switch (type) {
+			case RecordType::kSettings:
+				std::memcpy(&a_trace.settings.emplace_back(), payload, size);
+				hasSettings = true;
+				break;
+			case RecordType::kProfile:
+				std::memcpy(&a_trace.profiles.emplace_back(), payload, size);
+				break;
+			case RecordType::kState:
+				std::memcpy(&a_trace.initialState, payload, size);
+				a_trace.hasState = true;
+				break;
+			case RecordType::kFrame:
+				{
+					TraceData::Frame frame;
+					std::memcpy(&frame.record, payload, size);
+					if (!hasSettings) {
+						a_error = "frame recorded before any settings";
+						return false;
+					}
+					frame.settingsIndex = static_cast<std::uint32_t>(a_trace.settings.size() - 1);
+
+					// Latest profile with the frame's id
+					auto it = std::find_if(a_trace.profiles.rbegin(), a_trace.profiles.rend(),
+						[&](const ProfileRecord& a_profile) { return a_profile.id == frame.record.profileId; });
+					if (it == a_trace.profiles.rend()) {
+						a_error = "frame references unknown profile " + std::to_string(frame.record.profileId);
+						return false;
+					}
+					frame.profileIndex = static_cast<std::uint32_t>(std::distance(it, a_trace.profiles.rend()) - 1);
+					a_trace.frames.push_back(frame);
+				}
+				break;
+			}
+		}
+		return true;
+	}
+
+	bool ReplayFrame(Core::FrameState& a_state, const FrameRecord& a_record, const Core::CoreSettings& a_settings,
+		const CompiledWeaponProfile& a_profile, Core::FrameOutput& a_output)
+	{
+		a_output.hasOffsets = false;
+
+		// Reset() / OnEnterFirstPerson()
+		if (a_record.flags & kReset) {
+			a_state.ResetSprings();
+			a_state.settlingFactor = 0.0f;
+			a_state.timeSinceMovement = 0.0f;
+			a_state.actionBlendFactor = 1.0f;
+		}
+		a_state.equipBlendFactor = a_record.equipBlendFactor;
+
+		const Core::FrameInputs inputs = ToFrameInputs(a_record);
+		const bool primed = Core::StepCamera(a_state, inputs, a_settings);
+		if (primed != ((a_record.flags & kCameraPrimed) != 0)) {
+			return false;
+		}
+
+		// Weapon inertia switched off - springs cleared on the first disabled frame
+		if (a_record.flags & kBankReset) {
+			a_state.springBank.ResetAll();
+			a_state.previousTickBank.ResetAll();
+			a_state.physicsAccumulator = 0.0f;
+			a_state.slotAsleep.fill(false);
+		}
+
+		if (a_record.flags & kSpringsStepped) {
+			Core::StepSprings(a_state, inputs, a_settings, a_profile, a_output);
+		}
+		return true;
+	}
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "InertiaFrame.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Binary input trace (.fpit) - every per-frame input InertiaManager::Update consumes plus the
+// deferred offsets it produced, so a session can be replayed through the core off-line.
+//
+// Layout: FileHeader, then a stream of records, each a RecordType byte followed by its payload.
+// A kState record (the manager's Core::FrameState when recording started) comes first so replay
+// starts from the exact mid-session state. A kSettings record precedes the first frame and is
+// repeated whenever the global settings change; a kProfile record is written whenever the resolved
+// weapon profile changes, and frames reference it by id. Records are raw little-endian structs;
+// the header carries their sizes so a trace from a build with a different layout is rejected
+// instead of misread.
+namespace Inertia::Trace
+{
+	constexpr std::uint32_t kMagic = 0x54495046;  // "FPIT"
+	constexpr std::uint16_t kVersion = 1;
+	constexpr const char* kExtension = ".fpit";
+
+	enum class RecordType : std::uint8_t
+	{
+		kSettings = 1,  // Core::CoreSettings
+		kProfile = 2,   // ProfileRecord
+		kFrame = 3,     // FrameRecord
+		kState = 4      // Core::FrameState
+	};
+
+	struct FileHeader
+	{
+		std::uint32_t magic{ kMagic };
+		std::uint16_t version{ kVersion };
+		std::uint16_t headerSize{ 0 };
+		std::uint32_t settingsSize{ 0 };
+		std::uint32_t profileSize{ 0 };
+		std::uint32_t frameSize{ 0 };
+		std::uint32_t stateSize{ 0 };
+	};
+
+	// Resolved weapon profile (what CompileWeaponProfile built), plus what identifies it in game
+	struct ProfileRecord
+	{
+		std::uint32_t id{ 0 };            // Referenced by FrameRecord::profileId
+		std::int32_t weaponType{ 0 };     // WeaponType the settings were resolved for
+		std::uint32_t formID{ 0 };        // Equipped weapon (0 if none)
+		std::int32_t pivotPoint{ 0 };     // Per-weapon pivot used by ApplyOffset
+		char editorID[64]{};              // Specific weapon preset key, empty if type-based
+		CompiledWeaponProfile profile;
+	};
+
+	enum FrameFlags : std::uint16_t
+	{
+		kSprinting = 1 << 0,
+		kInMidair = 1 << 1,
+		kInJumpState = 1 << 2,      // bInJumpState
+		kReadyStart = 1 << 3,       // SBF_ReadyStart
+		kWeaponDrawn = 1 << 4,      // After the requireWeaponDrawn override
+		kAttacking = 1 << 5,        // Attack state other than none (includes bow states)
+		kCasting = 1 << 6,
+		kInAction = 1 << 7,         // What IsPlayerInAction returned (respects the blendDuring* toggles)
+		kDualClavicle = 1 << 8,
+		kReset = 1 << 9,            // Manager reset the springs (Reset / entering first person) since the last frame
+		kBankReset = 1 << 10,       // Weapon inertia disabled this frame - springs cleared
+		kCameraPrimed = 1 << 11,    // StepCamera ran past its priming frame
+		kSpringsStepped = 1 << 12,  // StepSprings ran (weapon inertia enabled)
+		kHasOffsets = 1 << 13       // Deferred offsets were produced
+	};
+
+	// One side's applied offset (SpringState position/rotation only)
+	struct Offsets
+	{
+		float position[3]{};
+		float rotation[3]{};
+	};
+
+	struct FrameRecord
+	{
+		float delta{ 0.0f };
+		float yaw{ 0.0f };
+		float pitch{ 0.0f };
+		float moveInputX{ 0.0f };
+		float moveInputY{ 0.0f };
+		float equipBlendFactor{ 0.0f };   // Equip blend the springs saw (stepped by the manager)
+		std::uint16_t flags{ 0 };
+		std::uint8_t stance{ 0 };
+		std::uint8_t reserved{ 0 };
+		std::uint32_t profileId{ 0 };
+
+		// Deferred offsets (valid with kHasOffsets)
+		float interpolationAlpha{ 1.0f };
+		Offsets combined;
+		Offsets previous;
+		Offsets combinedLeft;
+		Offsets previousLeft;
+	};
+
+	static_assert(std::is_trivially_copyable_v<Core::FrameState>);
+	static_assert(std::is_trivially_copyable_v<Core::CoreSettings>);
+	static_assert(std::is_trivially_copyable_v<ProfileRecord>);
+	static_assert(std::is_trivially_copyable_v<FrameRecord>);
+
+	// Header for traces written by this build
+	FileHeader MakeHeader();
+
+	// True if a_header was written by a build with this build's record layout
+	bool IsCompatible(const FileHeader& a_header);
+
+	// FrameRecord <-> core types
+	Core::FrameInputs ToFrameInputs(const FrameRecord& a_record);
+	void StoreInputs(FrameRecord& a_record, const Core::FrameInputs& a_inputs);
+	void StoreOutput(FrameRecord& a_record, const Core::FrameOutput& a_output);
+	Core::FrameOutput ToFrameOutput(const FrameRecord& a_record);
+
+	// A whole trace in memory, with each frame resolved to the settings/profile it was recorded under
+	struct TraceData
+	{
+		struct Frame
+		{
+			FrameRecord record;
+			std::uint32_t settingsIndex{ 0 };  // Into settings
+			std::uint32_t profileIndex{ 0 };   // Into profiles
+		};
+
+		bool hasState{ false };
+		bool truncated{ false };               // Ended mid-record (game closed while recording)
+		Core::FrameState initialState;
+		std::vector<Core::CoreSettings> settings;
+		std::vector<ProfileRecord> profiles;
+		std::vector<Frame> frames;
+	};
+
+	// Read a trace; false with a_error set if the file is unreadable, from an incompatible build or malformed
+	bool ReadTrace(const std::filesystem::path& a_path, TraceData& a_trace, std::string& a_error);
+
+	// Run one recorded frame through the core the way InertiaManager::Update did: the manager's
+	// resets, the recorded equip blend, StepCamera and, if the weapon's inertia was enabled,
+	// StepSprings. a_output.hasOffsets is false unless the springs ran and produced offsets.
+	// Returns false if StepCamera's priming disagrees with the recording (state diverged).
+	bool ReplayFrame(Core::FrameState& a_state, const FrameRecord& a_record, const Core::CoreSettings& a_settings,
+		const CompiledWeaponProfile& a_profile, Core::FrameOutput& a_output);
+}
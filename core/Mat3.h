@@ -0,0 +1,41 @@
+#pragma once
+
+// 3x3 rotation matrix used by the physics core
+// RE::NiMatrix3 inside the DLL (see Vec3.h), otherwise a stand-in with the same entry[row][col] layout.
+
+#if defined(FPINERTIA_CORE_NIPOINT3)
+
+namespace Inertia
+{
+	using Mat3 = RE::NiMatrix3;
+}
+
+#else
+
+namespace Inertia
+{
+	struct Mat3
+	{
+		float entry[3][3]{
+			{ 1.0f, 0.0f, 0.0f },
+			{ 0.0f, 1.0f, 0.0f },
+			{ 0.0f, 0.0f, 1.0f }
+		};
+
+		Mat3 operator*(const Mat3& a_rhs) const
+		{
+			Mat3 result;
+			for (int row = 0; row < 3; ++row) {
+				for (int col = 0; col < 3; ++col) {
+					result.entry[row][col] =
+						entry[row][0] * a_rhs.entry[0][col] +
+						entry[row][1] * a_rhs.entry[1][col] +
+						entry[row][2] * a_rhs.entry[2][col];
+				}
+			}
+			return result;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,129 @@
+#include "PerfHistogram.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#	define FPINERTIA_PERF_TSC
+#	if defined(_MSC_VER)
+#		include <intrin.h>
+#	else
+#		include <x86intrin.h>
+#	endif
+#endif
+
+namespace Inertia::Perf
+{
+	namespace
+	{
+		double Calibrate()
+		{
+#ifdef FPINERTIA_PERF_TSC
+			// Invariant TSC: one rate for the whole session, measured once against steady_clock
+			using Clock = std::chrono::steady_clock;
+			const auto clockStart = Clock::now();
+			const std::uint64_t ticksStart = Now();
+			auto clockNow = clockStart;
+			while (clockNow - clockStart < std::chrono::milliseconds(2)) {
+				clockNow = Clock::now();
+			}
+			const std::uint64_t ticks = Now() - ticksStart;
+			const double ns = std::chrono::duration<double, std::nano>(clockNow - clockStart).count();
+			return ticks > 0 ? ns / static_cast<double>(ticks) : 1.0;
+#else
+			return 1.0;
+#endif
+		}
+	}
+
+	std::uint64_t Now()
+	{
+#ifdef FPINERTIA_PERF_TSC
+		return __rdtsc();
+#else
+		return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+	}
+
+	double NsPerTick()
+	{
+		static const double nsPerTick = Calibrate();
+		return nsPerTick;
+	}
+
+	int Histogram::BucketFor(std::uint64_t a_ns)
+	{
+		if (a_ns < kLinearBuckets) {
+			return static_cast<int>(a_ns);
+		}
+		// Power of two (>= 4 here) picks the group, the next three bits the bucket within it
+		const int exponent = static_cast<int>(std::bit_width(a_ns)) - 1;
+		const int sub = static_cast<int>((a_ns >> (exponent - 3)) & (kSubBuckets - 1));
+		return kLinearBuckets + (exponent - 4) * kSubBuckets + sub;
+	}
+
+	std::uint64_t Histogram::BucketUpperBound(int a_bucket)
+	{
+		if (a_bucket < kLinearBuckets) {
+			return static_cast<std::uint64_t>(a_bucket);
+		}
+		const int exponent = (a_bucket - kLinearBuckets) / kSubBuckets + 4;
+		const std::uint64_t sub = static_cast<std::uint64_t>((a_bucket - kLinearBuckets) % kSubBuckets);
+		return ((kSubBuckets + sub + 1) << (exponent - 3)) - 1;
+	}
+
+	void Histogram::Record(std::uint64_t a_ns)
+	{
+		buckets[static_cast<std::size_t>(BucketFor(a_ns))].fetch_add(1, std::memory_order_relaxed);
+		sum.fetch_add(a_ns, std::memory_order_relaxed);
+		std::uint64_t previous = max.load(std::memory_order_relaxed);
+		while (a_ns > previous && !max.compare_exchange_weak(previous, a_ns, std::memory_order_relaxed)) {}
+	}
+
+	Histogram::Summary Histogram::Summarize() const
+	{
+		std::array<std::uint64_t, kBucketCount> counts;
+		std::uint64_t total = 0;
+		for (std::size_t i = 0; i < counts.size(); ++i) {
+			counts[i] = buckets[i].load(std::memory_order_relaxed);
+			total += counts[i];
+		}
+
+		Summary summary;
+		summary.count = total;
+		if (total == 0) {
+			return summary;
+		}
+		const std::uint64_t maxNs = max.load(std::memory_order_relaxed);
+		summary.maxUs = static_cast<double>(maxNs) / 1000.0;
+		summary.meanUs = static_cast<double>(sum.load(std::memory_order_relaxed)) / static_cast<double>(total) / 1000.0;
+
+		// Each percentile is the upper edge of the bucket holding it (never above the recorded max)
+		auto percentile = [&](double a_fraction) {
+			const auto rank = static_cast<std::uint64_t>(a_fraction * static_cast<double>(total - 1)) + 1;
+			std::uint64_t seen = 0;
+			for (int i = 0; i < kBucketCount; ++i) {
+				seen += counts[static_cast<std::size_t>(i)];
+				if (seen >= rank) {
+					return static_cast<double>(std::min(BucketUpperBound(i), maxNs)) / 1000.0;
+				}
+			}
+			return summary.maxUs;
+		};
+		summary.p50Us = percentile(0.50);
+		summary.p95Us = percentile(0.95);
+		summary.p99Us = percentile(0.99);
+		return summary;
+	}
+
+	void Histogram::Reset()
+	{
+		for (auto& bucket : buckets) {
+			bucket.store(0, std::memory_order_relaxed);
+		}
+		sum.store(0, std::memory_order_relaxed);
+		max.store(0, std::memory_order_relaxed);
+	}
+}
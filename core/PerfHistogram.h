@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace Inertia::Perf
+{
+	// Timestamp counter: rdtsc on x64 (tens of cycles, no syscall), steady_clock elsewhere
+	std::uint64_t Now();
+
+	// Nanoseconds per Now() tick (calibrated against steady_clock on first use, ~2ms - the plugin
+	// calls it at install so no frame pays for it)
+	double NsPerTick();
+
+	inline double TicksToNs(std::uint64_t a_ticks) { return static_cast<double>(a_ticks) * NsPerTick(); }
+
+	// Distribution of durations, recorded from any thread without locks
+	//
+	// Log-linear buckets: exact below 16ns, then 8 buckets per power of two, so percentiles are
+	// within 12.5% of the true value across nanoseconds to seconds in a fixed 4KB. Readers see a
+	// consistent enough picture for display while samples keep coming in.
+	class Histogram
+	{
+	public:
+		struct Summary
+		{
+			std::uint64_t count{ 0 };
+			double meanUs{ 0.0 };
+			double p50Us{ 0.0 };
+			double p95Us{ 0.0 };
+			double p99Us{ 0.0 };
+			double maxUs{ 0.0 };
+		};
+
+		void Record(std::uint64_t a_ns);
+		Summary Summarize() const;
+		void Reset();
+
+	private:
+		static constexpr int kLinearBuckets = 16;
+		static constexpr int kSubBuckets = 8;
+		static constexpr int kBucketCount = kLinearBuckets + (64 - 4) * kSubBuckets;
+
+		static int BucketFor(std::uint64_t a_ns);
+		static std::uint64_t BucketUpperBound(int a_bucket);
+
+		std::array<std::atomic<std::uint64_t>, kBucketCount> buckets{};
+		std::atomic<std::uint64_t> sum{ 0 };
+		std::atomic<std::uint64_t> max{ 0 };
+	};
+
+	// Records the time from construction to destruction into a histogram
+	class ScopedTimer
+	{
+	public:
+		explicit ScopedTimer(Histogram& a_histogram) :
+			histogram(a_histogram),
+			start(Now())
+		{}
+
+		~ScopedTimer() { histogram.Record(static_cast<std::uint64_t>(TicksToNs(Now() - start))); }
+
+		ScopedTimer(const ScopedTimer&) = delete;
+		ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+	private:
+		Histogram& histogram;
+		std::uint64_t start;
+	};
+
+	// Adds the Now() ticks from construction to destruction to a running total
+	class ScopedTicks
+	{
+	public:
+		explicit ScopedTicks(std::uint64_t& a_total) :
+			total(a_total),
+			start(Now())
+		{}
+
+		~ScopedTicks() { total += Now() - start; }
+
+		ScopedTicks(const ScopedTicks&) = delete;
+		ScopedTicks& operator=(const ScopedTicks&) = delete;
+
+	private:
+		std::uint64_t& total;
+		std::uint64_t start;
+	};
+}
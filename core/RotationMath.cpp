@@ -0,0 +1,166 @@
+#include "RotationMath.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace Inertia::RotationMath
+{
+	namespace
+	{
+		// Quaternion from the exact half-angle sin/cos (fallback and reference for the polynomial)
+		Quaternion FromExpMapExact(const Vec3& a_rotation, float a_angle)
+		{
+			if (a_angle <= 0.0f) {
+				return {};
+			}
+			const float half = 0.5f * a_angle;
+			const float scale = std::sin(half) / a_angle;
+			return { std::cos(half), a_rotation.x * scale, a_rotation.y * scale, a_rotation.z * scale };
+		}
+
+		float MaxEntryError(const Mat3& a_lhs, const Mat3& a_rhs)
+		{
+			float error = 0.0f;
+			for (int row = 0; row < 3; ++row) {
+				for (int col = 0; col < 3; ++col) {
+					error = std::max(error, std::abs(a_lhs.entry[row][col] - a_rhs.entry[row][col]));
+				}
+			}
+			return error;
+		}
+	}
+
+	Quaternion FromExpMap(const Vec3& a_rotation)
+	{
+		const float angleSq = a_rotation.x * a_rotation.x + a_rotation.y * a_rotation.y + a_rotation.z * a_rotation.z;
+		if (angleSq > kPolynomialLimit * kPolynomialLimit) {
+			return FromExpMapExact(a_rotation, std::sqrt(angleSq));
+		}
+
+		// With h = angle / 2 (so h^2 = angle^2 / 4):
+		//   cos(h)             ~ 1 - h^2/2 + h^4/24 - h^6/720
+		//   sin(h) / angle     ~ (1 - h^2/6 + h^4/120 - h^6/5040) / 2
+		// No sqrt needed, and the zero-angle case falls out naturally
+		const float h2 = 0.25f * angleSq;
+		const float w = 1.0f - h2 * (1.0f / 2.0f - h2 * (1.0f / 24.0f - h2 * (1.0f / 720.0f)));
+		const float scale = 0.5f * (1.0f - h2 * (1.0f / 6.0f - h2 * (1.0f / 120.0f - h2 * (1.0f / 5040.0f))));
+		return { w, a_rotation.x * scale, a_rotation.y * scale, a_rotation.z * scale };
+	}
+
+	Mat3 ToMatrix(const Quaternion& a_quat)
+	{
+		const float xx = a_quat.x * a_quat.x;
+		const float yy = a_quat.y * a_quat.y;
+		const float zz = a_quat.z * a_quat.z;
+		const float xy = a_quat.x * a_quat.y;
+		const float xz = a_quat.x * a_quat.z;
+		const float yz = a_quat.y * a_quat.z;
+		const float wx = a_quat.w * a_quat.x;
+		const float wy = a_quat.w * a_quat.y;
+		const float wz = a_quat.w * a_quat.z;
+
+		Mat3 result;
+		result.entry[0][0] = 1.0f - 2.0f * (yy + zz);
+		result.entry[0][1] = 2.0f * (xy - wz);
+		result.entry[0][2] = 2.0f * (xz + wy);
+		result.entry[1][0] = 2.0f * (xy + wz);
+		result.entry[1][1] = 1.0f - 2.0f * (xx + zz);
+		result.entry[1][2] = 2.0f * (yz - wx);
+		result.entry[2][0] = 2.0f * (xz - wy);
+		result.entry[2][1] = 2.0f * (yz + wx);
+		result.entry[2][2] = 1.0f - 2.0f * (xx + yy);
+		return result;
+	}
+
+	Mat3 Compose(const Mat3& a_lhs, const Mat3& a_rhs)
+	{
+		// Plain scalar code the compiler keeps in registers
+		Mat3 result;
+		for (int row = 0; row < 3; ++row) {
+			const float l0 = a_lhs.entry[row][0];
+			const float l1 = a_lhs.entry[row][1];
+			const float l2 = a_lhs.entry[row][2];
+			result.entry[row][0] = l0 * a_rhs.entry[0][0] + l1 * a_rhs.entry[1][0] + l2 * a_rhs.entry[2][0];
+			result.entry[row][1] = l0 * a_rhs.entry[0][1] + l1 * a_rhs.entry[1][1] + l2 * a_rhs.entry[2][1];
+			result.entry[row][2] = l0 * a_rhs.entry[0][2] + l1 * a_rhs.entry[1][2] + l2 * a_rhs.entry[2][2];
+		}
+		return result;
+	}
+
+	void ApplyExpMap(Mat3& a_rotate, const Vec3& a_rotation)
+	{
+		a_rotate = Compose(a_rotate, ToMatrix(FromExpMap(a_rotation)));
+	}
+
+	Mat3 EulerToMatrix(const Vec3& a_euler)
+	{
+		float cx = std::cos(a_euler.x);
+		float sx = std::sin(a_euler.x);
+		float cy = std::cos(a_euler.y);
+		float sy = std::sin(a_euler.y);
+		float cz = std::cos(a_euler.z);
+		float sz = std::sin(a_euler.z);
+
+		Mat3 result;
+		result.entry[0][0] = cy * cz;
+		result.entry[0][1] = -cy * sz;
+		result.entry[0][2] = sy;
+		result.entry[1][0] = sx * sy * cz + cx * sz;
+		result.entry[1][1] = -sx * sy * sz + cx * cz;
+		result.entry[1][2] = -sx * cy;
+		result.entry[2][0] = -cx * sy * cz + sx * sz;
+		result.entry[2][1] = cx * sy * sz + sx * cz;
+		result.entry[2][2] = cx * cy;
+
+		return result;
+	}
+
+	SelfCheckResult RunSelfCheck()
+	{
+		// Accuracy over the range rotation offsets actually reach (a few degrees, up to ~17 per axis)
+		constexpr float RANGE = 0.3f;
+		constexpr int STEPS = 12;
+		float maxApproxError = 0.0f;  // Polynomial vs exact half-angle sin/cos
+		float maxEulerError = 0.0f;   // Exp map vs the old Euler XYZ matrix
+		for (int i = 0; i <= STEPS; ++i) {
+			for (int j = 0; j <= STEPS; ++j) {
+				for (int k = 0; k <= STEPS; ++k) {
+					const Vec3 rotation{
+						-RANGE + 2.0f * RANGE * static_cast<float>(i) / STEPS,
+						-RANGE + 2.0f * RANGE * static_cast<float>(j) / STEPS,
+						-RANGE + 2.0f * RANGE * static_cast<float>(k) / STEPS
+					};
+					const float angle = std::sqrt(rotation.x * rotation.x + rotation.y * rotation.y + rotation.z * rotation.z);
+					const Mat3 fast = ToMatrix(FromExpMap(rotation));
+					maxApproxError = std::max(maxApproxError, MaxEntryError(fast, ToMatrix(FromExpMapExact(rotation, angle))));
+					maxEulerError = std::max(maxEulerError, MaxEntryError(fast, EulerToMatrix(rotation)));
+				}
+			}
+		}
+
+		// Timing: offset rotation build + compose onto a node rotation, both paths
+		constexpr int ITERATIONS = 100000;
+		Mat3 node;
+		Vec3 rotation{ 0.01f, -0.02f, 0.03f };
+		float sink = 0.0f;
+
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < ITERATIONS; ++i) {
+			rotation.x = 0.01f + static_cast<float>(i & 63) * 0.001f;
+			sink += (node * EulerToMatrix(rotation)).entry[0][1];
+		}
+		const double eulerNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / ITERATIONS;
+
+		start = std::chrono::steady_clock::now();
+		for (int i = 0; i < ITERATIONS; ++i) {
+			rotation.x = 0.01f + static_cast<float>(i & 63) * 0.001f;
+			Mat3 rotated = node;
+			ApplyExpMap(rotated, rotation);
+			sink += rotated.entry[0][1];
+		}
+		const double expMapNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / ITERATIONS;
+
+		return { RANGE, maxApproxError, maxEulerError, eulerNs, expMapNs, sink };
+	}
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Mat3.h"
+#include "Vec3.h"
+
+namespace Inertia
+{
+	// Rotation helpers for ApplyOffset
+	// By default the spring's rotation offset is applied as Euler XYZ angles (EulerToMatrix). The
+	// opt-in exp map path treats it as an exponential map (axis * angle, radians) and turns it into
+	// a unit quaternion using a polynomial sin/cos of the half angle. Offsets are small, so this
+	// needs no trig calls; angles above kPolynomialLimit fall back to std::sin/cos. The two paths
+	// are not the same rotation (up to ~6e-2 per matrix entry at 0.3 rad per axis), so switching
+	// changes how a preset feels; FPInertiaBench --rotation reports the difference and timings.
+	namespace RotationMath
+	{
+		constexpr float kPolynomialLimit = 0.5f;  // Radians - half-angle polynomial error < 2e-8 below this
+
+		struct Quaternion
+		{
+			float w{ 1.0f };
+			float x{ 0.0f };
+			float y{ 0.0f };
+			float z{ 0.0f };
+		};
+
+		// Exponential map (rotation vector) -> unit quaternion
+		Quaternion FromExpMap(const Vec3& a_rotation);
+
+		// Unit quaternion -> rotation matrix
+		Mat3 ToMatrix(const Quaternion& a_quat);
+
+		// a_lhs * a_rhs
+		Mat3 Compose(const Mat3& a_lhs, const Mat3& a_rhs);
+
+		// a_rotate = a_rotate * R(a_rotation)
+		void ApplyExpMap(Mat3& a_rotate, const Vec3& a_rotation);
+
+		// Default path: rotation matrix from euler angles (XYZ order)
+		Mat3 EulerToMatrix(const Vec3& a_euler);
+
+		// Exp map path vs the exact and Euler paths over the spring's working range, plus timing of both
+		struct SelfCheckResult
+		{
+			float range{ 0.0f };            // +/- radians per axis covered
+			float maxApproxError{ 0.0f };   // Polynomial vs exact half-angle sin/cos (max matrix entry)
+			float maxEulerError{ 0.0f };    // Exp map vs the old Euler XYZ matrix (max matrix entry)
+			double eulerNs{ 0.0 };          // ns per Euler build + compose
+			double expMapNs{ 0.0 };         // ns per ApplyExpMap
+			float checksum{ 0.0f };         // Keeps the timed loops from being optimised away
+		};
+		SelfCheckResult RunSelfCheck();
+	}
+}
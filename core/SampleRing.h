@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace Inertia
+{
+	// Fixed-size history of the last N values, written by one thread and read by another
+	//
+	// The producer overwrites the oldest slot and bumps the head: no lock, no allocation, no
+	// waiting on the reader. The reader copies the whole ring, then re-reads the head and drops
+	// any slot the producer may have been overwriting while it copied, so what it gets back is
+	// always complete samples in order (it may be a few samples short of N).
+	template <class T, std::uint32_t N>
+	class SampleRing
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "SampleRing holds plain values");
+		static_assert(N > 0 && (N & (N - 1)) == 0, "SampleRing size must be a power of two");
+
+	public:
+		static constexpr std::uint32_t kCapacity = N;
+		using Copy = std::array<T, N>;
+
+		// Producer
+		void Push(const T& a_value)
+		{
+			const std::uint32_t index = head.load(std::memory_order_relaxed);
+			slots[index & (N - 1)] = a_value;
+			head.store(index + 1, std::memory_order_release);
+		}
+
+		// Consumer - copy the history into a_out, oldest first; the result points into a_out
+		std::span<const T> CopyTo(Copy& a_out) const
+		{
+			const std::uint32_t end = head.load(std::memory_order_acquire);
+			const std::uint32_t available = end < N ? end : N;
+			const std::uint32_t begin = end - available;
+			for (std::uint32_t i = 0; i < available; ++i) {
+				a_out[i] = slots[(begin + i) & (N - 1)];
+			}
+
+			// Slots at or past the producer's position (minus N) when the copy finished may be torn
+			std::atomic_thread_fence(std::memory_order_acquire);
+			const std::uint32_t after = head.load(std::memory_order_relaxed);
+			std::uint32_t skip = 0;
+			if (after - begin >= N) {
+				skip = after - begin - N + 1;
+				if (skip > available) {
+					skip = available;
+				}
+			}
+			return std::span<const T>(a_out.data() + skip, available - skip);
+		}
+
+	private:
+		std::array<T, N> slots{};
+		alignas(64) std::atomic<std::uint32_t> head{ 0 };
+	};
+}
@@ -0,0 +1,484 @@
+#include "SpringBank.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+#include <immintrin.h>
+
+namespace Inertia
+{
+	namespace
+	{
+		constexpr std::uint32_t LANE_ACTIVE = 0xFFFFFFFFu;
+		constexpr std::uint32_t LANE_FROZEN = 0u;
+
+		// === SIMD REGISTER WRAPPER ===
+		// AVX when compiled with /arch:AVX (8 lanes = one slot), otherwise the SSE2 x64 baseline (4 lanes = one group)
+#if defined(__AVX__)
+#	define FPI_SIMD(op) _mm256_##op
+		using Register = __m256;
+		constexpr int SIMD_WIDTH = 8;
+#else
+#	define FPI_SIMD(op) _mm_##op
+		using Register = __m128;
+		constexpr int SIMD_WIDTH = 4;
+#endif
+
+		struct Vec
+		{
+			Register r;
+		};
+
+		inline Vec Set(float a_value) { return { FPI_SIMD(set1_ps)(a_value) }; }
+		inline Vec LoadLanes(const float* a_lanes) { return { FPI_SIMD(load_ps)(a_lanes) }; }
+		inline void StoreLanes(float* a_lanes, Vec a_value) { FPI_SIMD(store_ps)(a_lanes, a_value.r); }
+
+		inline Vec LoadMask(const std::uint32_t* a_mask)
+		{
+#if defined(__AVX__)
+			return { _mm256_castsi256_ps(_mm256_load_si256(reinterpret_cast<const __m256i*>(a_mask))) };
+#else
+			return { _mm_castsi128_ps(_mm_load_si128(reinterpret_cast<const __m128i*>(a_mask))) };
+#endif
+		}
+
+		// Lane limits for one register: position lanes come first in each slot, rotation lanes second
+		inline Vec GroupLimits(float a_position, float a_rotation, [[maybe_unused]] int a_laneInSlot)
+		{
+#if defined(__AVX__)
+			return { _mm256_setr_ps(a_position, a_position, a_position, a_position, a_rotation, a_rotation, a_rotation, a_rotation) };
+#else
+			return Set(a_laneInSlot < SpringBank::kLanesPerGroup ? a_position : a_rotation);
+#endif
+		}
+
+		inline Vec operator+(Vec a, Vec b) { return { FPI_SIMD(add_ps)(a.r, b.r) }; }
+		inline Vec operator-(Vec a, Vec b) { return { FPI_SIMD(sub_ps)(a.r, b.r) }; }
+		inline Vec operator*(Vec a, Vec b) { return { FPI_SIMD(mul_ps)(a.r, b.r) }; }
+		inline Vec operator/(Vec a, Vec b) { return { FPI_SIMD(div_ps)(a.r, b.r) }; }
+
+		inline Vec Clamp(Vec a_value, Vec a_limit)
+		{
+			const Vec negLimit = { FPI_SIMD(xor_ps)(a_limit.r, FPI_SIMD(set1_ps)(-0.0f)) };
+			return { FPI_SIMD(min_ps)(FPI_SIMD(max_ps)(a_value.r, negLimit.r), a_limit.r) };
+		}
+
+		// Branch-free per-lane select: mask bits set -> a_ifSet
+		inline Vec Select(Vec a_mask, Vec a_ifSet, Vec a_ifClear)
+		{
+			return { FPI_SIMD(or_ps)(FPI_SIMD(and_ps)(a_mask.r, a_ifSet.r), FPI_SIMD(andnot_ps)(a_mask.r, a_ifClear.r)) };
+		}
+
+		// Spring acceleration: a = k * (target - x) - c * v
+		inline Vec Accel(Vec a_x, Vec a_v, Vec a_target, Vec a_k, Vec a_c)
+		{
+			return a_k * (a_target - a_x) - a_c * a_v;
+		}
+
+		// === INTEGRATOR POLICIES ===
+		// Each Step() advances offset x and velocity v by dt; the kernel clamps the offset afterwards
+
+		// Semi-implicit Euler (original behaviour): velocity first, clamped before it moves the offset
+		struct SemiImplicitEulerPolicy
+		{
+			static constexpr bool kSubstep = true;
+
+			static void Step(Vec& a_x, Vec& a_v, Vec a_target, Vec a_k, Vec a_c, Vec a_dt, Vec a_maxV)
+			{
+				a_v = Clamp(a_v + Accel(a_x, a_v, a_target, a_k, a_c) * a_dt, a_maxV);
+				a_x = a_x + a_v * a_dt;
+			}
+		};
+
+		// Velocity Verlet with a predicted velocity for the damping term
+		struct VelocityVerletPolicy
+		{
+			static constexpr bool kSubstep = true;
+
+			static void Step(Vec& a_x, Vec& a_v, Vec a_target, Vec a_k, Vec a_c, Vec a_dt, Vec a_maxV)
+			{
+				const Vec half = Set(0.5f);
+				const Vec a0 = Accel(a_x, a_v, a_target, a_k, a_c);
+				a_x = a_x + a_v * a_dt + half * a0 * a_dt * a_dt;
+				const Vec a1 = Accel(a_x, a_v + a0 * a_dt, a_target, a_k, a_c);
+				a_v = Clamp(a_v + half * (a0 + a1) * a_dt, a_maxV);
+			}
+		};
+
+		// Classic fourth order Runge-Kutta on (x, v)
+		struct RK4Policy
+		{
+			static constexpr bool kSubstep = true;
+
+			static void Step(Vec& a_x, Vec& a_v, Vec a_target, Vec a_k, Vec a_c, Vec a_dt, Vec a_maxV)
+			{
+				const Vec half = Set(0.5f);
+				const Vec two = Set(2.0f);
+				const Vec sixth = Set(1.0f / 6.0f);
+				const Vec halfDt = half * a_dt;
+
+				const Vec x1 = a_v;
+				const Vec v1 = Accel(a_x, a_v, a_target, a_k, a_c);
+				const Vec x2 = a_v + halfDt * v1;
+				const Vec v2 = Accel(a_x + halfDt * x1, x2, a_target, a_k, a_c);
+				const Vec x3 = a_v + halfDt * v2;
+				const Vec v3 = Accel(a_x + halfDt * x2, x3, a_target, a_k, a_c);
+				const Vec x4 = a_v + a_dt * v3;
+				const Vec v4 = Accel(a_x + a_dt * x3, x4, a_target, a_k, a_c);
+
+				a_x = a_x + sixth * a_dt * (x1 + two * x2 + two * x3 + x4);
+				a_v = Clamp(a_v + sixth * a_dt * (v1 + two * v2 + two * v3 + v4), a_maxV);
+			}
+		};
+
+		// Backward Euler: v' = (v + dt * k * (target - x)) / (1 + dt * c + dt^2 * k), x' = x + dt * v'
+		struct ImplicitEulerPolicy
+		{
+			static constexpr bool kSubstep = true;
+
+			static void Step(Vec& a_x, Vec& a_v, Vec a_target, Vec a_k, Vec a_c, Vec a_dt, Vec a_maxV)
+			{
+				const Vec denom = Set(1.0f) + a_dt * a_c + a_dt * a_dt * a_k;
+				a_v = Clamp((a_v + a_dt * a_k * (a_target - a_x)) / denom, a_maxV);
+				a_x = a_x + a_dt * a_v;
+			}
+		};
+
+		// Closed-form solution of x'' = -k * (x - target) - c * x' with the target held over dt
+		// With y = x - target, a = c / 2 and disc = a^2 - k:
+		//   disc < 0  (under-damped):  y = e^(-at) * (y0 * cos(wd*t) + (v0 + a*y0) / wd * sin(wd*t)),  wd = sqrt(-disc)
+		//   disc == 0 (critical):      y = e^(-at) * (y0 + (v0 + a*y0) * t)
+		//   disc > 0  (over-damped):   y = C1 * e^(r1*t) + C2 * e^(r2*t),  r1,2 = -a +/- sqrt(disc)
+		// Evaluated once per frame in double precision, lane by lane
+		struct ExactPolicy
+		{
+			static constexpr bool kSubstep = false;
+
+			static void SolveLane(float& a_x, float& a_v, float a_target, float a_k, float a_c, double a_t)
+			{
+				const double k = a_k;
+				const double c = a_c;
+				const double y0 = static_cast<double>(a_x) - a_target;
+				const double v0 = a_v;
+
+				double y = 0.0;
+				double v = 0.0;
+
+				if (k <= 0.0) {
+					// No spring force - pure velocity damping
+					if (c > 0.0) {
+						const double decay = std::exp(-c * a_t);
+						y = y0 + v0 * (1.0 - decay) / c;
+						v = v0 * decay;
+					} else {
+						y = y0 + v0 * a_t;
+						v = v0;
+					}
+				} else {
+					const double a = 0.5 * c;
+					const double disc = a * a - k;
+					const double decay = std::exp(-a * a_t);
+
+					if (std::abs(disc) <= 1e-6 * k) {
+						// Critically damped
+						const double b = v0 + a * y0;
+						y = decay * (y0 + b * a_t);
+						v = decay * (v0 - a * b * a_t);
+					} else if (disc < 0.0) {
+						// Under-damped
+						const double wd = std::sqrt(-disc);
+						const double cosWt = std::cos(wd * a_t);
+						const double sinWt = std::sin(wd * a_t);
+						y = decay * (y0 * cosWt + (v0 + a * y0) / wd * sinWt);
+						v = decay * (v0 * cosWt - (a * v0 + k * y0) / wd * sinWt);
+					} else {
+						// Over-damped
+						const double root = std::sqrt(disc);
+						const double r1 = -a + root;
+						const double r2 = -a - root;
+						const double c1 = (v0 - r2 * y0) / (r1 - r2);
+						const double c2 = y0 - c1;
+						const double e1 = std::exp(r1 * a_t);
+						const double e2 = std::exp(r2 * a_t);
+						y = c1 * e1 + c2 * e2;
+						v = r1 * c1 * e1 + r2 * c2 * e2;
+					}
+				}
+
+				a_x = static_cast<float>(y + a_target);
+				a_v = static_cast<float>(v);
+			}
+
+			static void Step(Vec& a_x, Vec& a_v, Vec a_target, Vec a_k, Vec a_c, Vec a_dt, Vec a_maxV)
+			{
+				alignas(32) float x[SIMD_WIDTH];
+				alignas(32) float v[SIMD_WIDTH];
+				alignas(32) float target[SIMD_WIDTH];
+				alignas(32) float k[SIMD_WIDTH];
+				alignas(32) float c[SIMD_WIDTH];
+				alignas(32) float dt[SIMD_WIDTH];
+				StoreLanes(x, a_x);
+				StoreLanes(v, a_v);
+				StoreLanes(target, a_target);
+				StoreLanes(k, a_k);
+				StoreLanes(c, a_c);
+				StoreLanes(dt, a_dt);
+
+				for (int lane = 0; lane < SIMD_WIDTH; ++lane) {
+					SolveLane(x[lane], v[lane], target[lane], k[lane], c[lane], dt[lane]);
+				}
+
+				a_x = LoadLanes(x);
+				a_v = Clamp(LoadLanes(v), a_maxV);
+			}
+		};
+
+		static_assert(SpringBank::kLanesPerSlot % SIMD_WIDTH == 0, "Slot lanes must be a multiple of the SIMD width");
+
+		// Shared kernel: advances one category's lanes with a policy, limits from the category traits
+		template <class Policy, class Traits>
+		void IntegrateLanes(float* a_offset, float* a_velocity, const float* a_target,
+			const float* a_stiffness, const float* a_damping, const float* a_maxOffset,
+			const std::uint32_t* a_activeMask, int a_numSteps, float a_stepDelta)
+		{
+			constexpr bool FIXED_OFFSET_LIMITS = Traits::kMaxPosOffset > 0.0f && Traits::kMaxRotOffset > 0.0f;
+			const Vec dt = Set(a_stepDelta);
+
+			for (int i = 0; i < SpringBank::kLanesPerCategory; i += SIMD_WIDTH) {
+				const int laneInSlot = i % SpringBank::kLanesPerSlot;
+				const Vec maxV = GroupLimits(Traits::kMaxPosVelocity, Traits::kMaxRotVelocity, laneInSlot);
+				Vec maxX;
+				if constexpr (FIXED_OFFSET_LIMITS) {
+					maxX = GroupLimits(Traits::kMaxPosOffset, Traits::kMaxRotOffset, laneInSlot);
+				} else {
+					maxX = LoadLanes(a_maxOffset + i);
+				}
+
+				const Vec active = LoadMask(a_activeMask + i);
+				const Vec target = LoadLanes(a_target + i);
+				const Vec k = LoadLanes(a_stiffness + i);
+				const Vec c = LoadLanes(a_damping + i);
+				const Vec x0 = LoadLanes(a_offset + i);
+				const Vec v0 = LoadLanes(a_velocity + i);
+
+				Vec x = x0;
+				Vec v = v0;
+				for (int step = 0; step < a_numSteps; ++step) {
+					Policy::Step(x, v, target, k, c, dt, maxV);
+					x = Clamp(x, maxX);
+				}
+
+				// Frozen lanes keep their current state
+				StoreLanes(a_velocity + i, Select(active, v, v0));
+				StoreLanes(a_offset + i, Select(active, x, x0));
+			}
+		}
+
+#undef FPI_SIMD
+	}
+
+	float SpringBank::StableSubstep(SpringIntegrator a_integrator, float a_stiffness, float a_damping)
+	{
+		const float k = std::max(a_stiffness, 0.0f);
+		const float c = std::max(a_damping, 0.0f);
+		float limit = std::numeric_limits<float>::infinity();
+
+		switch (a_integrator) {
+		case SpringIntegrator::kSemiImplicitEuler:
+		case SpringIntegrator::kVelocityVerlet:
+			// Both eigenvalues of the step matrix stay inside the unit circle while k*dt^2 + 2*c*dt < 4,
+			// i.e. w*dt < 2 * (sqrt(zeta^2 + 1) - zeta)
+			if (k > 0.0f) {
+				limit = (std::sqrt(c * c + 4.0f * k) - c) / k;
+			} else if (c > 0.0f) {
+				limit = 2.0f / c;
+			}
+			break;
+		case SpringIntegrator::kRK4:
+			// RK4's region reaches |lambda * dt| ~ 2.78 on both axes; the fastest eigenvalue is w when
+			// under-damped, w * (zeta + sqrt(zeta^2 - 1)) when over-damped
+			{
+				const float a = 0.5f * c;
+				const float disc = a * a - k;
+				const float fastest = disc > 0.0f ? a + std::sqrt(disc) : std::sqrt(k);
+				if (fastest > 0.0f) {
+					limit = 2.78f / fastest;
+				}
+			}
+			break;
+		case SpringIntegrator::kExact:
+		case SpringIntegrator::kImplicitEuler:
+		default:
+			// Closed form / A-stable
+			return limit;
+		}
+
+		return limit * kStabilityMargin;
+	}
+
+	int SpringBank::RequiredSubsteps(float a_delta, float a_maxSubstep)
+	{
+		if (a_delta <= 0.0f || !(a_maxSubstep > 0.0f)) {
+			return 1;
+		}
+		// Capped well past any budget so a zero-stiffness corner case can't overflow the cast
+		const float steps = std::ceil(a_delta / a_maxSubstep);
+		return static_cast<int>(std::clamp(steps, 1.0f, 1.0e6f));
+	}
+
+	template <SpringCategory C>
+	void SpringBank::IntegrateCategory(float a_delta, SpringIntegrator a_integrator, float a_maxSubstep)
+	{
+		using Traits = SpringTraits<C>;
+		const int first = static_cast<int>(C) * kLanesPerCategory;
+
+		// === FRAMERATE INDEPENDENCE: as many substeps as this category's stability limit needs ===
+		const int numSteps = std::min(RequiredSubsteps(a_delta, a_maxSubstep), kMaxSubsteps);
+		const float stepDelta = a_delta / static_cast<float>(numSteps);
+
+		auto run = [&]<class Policy>() {
+			const int steps = Policy::kSubstep ? numSteps : 1;
+			const float dt = Policy::kSubstep ? stepDelta : a_delta;
+			IntegrateLanes<Policy, Traits>(offset + first, velocity + first, target + first,
+				stiffness + first, damping + first, maxOffset + first, activeMask + first, steps, dt);
+		};
+
+		switch (a_integrator) {
+		case SpringIntegrator::kExact:
+			run.template operator()<ExactPolicy>();
+			break;
+		case SpringIntegrator::kVelocityVerlet:
+			run.template operator()<VelocityVerletPolicy>();
+			break;
+		case SpringIntegrator::kRK4:
+			run.template operator()<RK4Policy>();
+			break;
+		case SpringIntegrator::kImplicitEuler:
+			run.template operator()<ImplicitEulerPolicy>();
+			break;
+		case SpringIntegrator::kSemiImplicitEuler:
+		default:
+			run.template operator()<SemiImplicitEulerPolicy>();
+			break;
+		}
+	}
+
+	void SpringBank::StageGroup(int a_first, const Vec3& a_target, const GroupParams& a_params, bool a_active)
+	{
+		const float axisTarget[3] = { a_target.x, a_target.y, a_target.z };
+		const std::uint32_t mask = a_active ? LANE_ACTIVE : LANE_FROZEN;
+
+		for (int axis = 0; axis < 3; ++axis) {
+			const int lane = a_first + axis;
+			target[lane] = axisTarget[axis];
+			stiffness[lane] = a_params.stiffness;
+			damping[lane] = a_params.damping;
+			maxOffset[lane] = a_params.maxOffset;
+			activeMask[lane] = mask;
+		}
+	}
+
+	void SpringBank::Stage(SpringSlot a_slot,
+		const Vec3& a_posTarget, const GroupParams& a_posParams, bool a_posActive,
+		const Vec3& a_rotTarget, const GroupParams& a_rotParams, bool a_rotActive)
+	{
+		StageGroup(PositionLane(a_slot), a_posTarget, a_posParams, a_posActive);
+		StageGroup(RotationLane(a_slot), a_rotTarget, a_rotParams, a_rotActive);
+	}
+
+	void SpringBank::Freeze(SpringSlot a_slot)
+	{
+		const int first = PositionLane(a_slot);
+		for (int lane = first; lane < first + kLanesPerSlot; ++lane) {
+			activeMask[lane] = LANE_FROZEN;
+		}
+	}
+
+	void SpringBank::Integrate(float a_delta, const IntegratorSet& a_integrators, const SubstepSet& a_maxSubsteps,
+		int a_steps, SpringBank* a_previousTick)
+	{
+		if (a_delta > 0.0f) {
+			for (int step = 0; step < a_steps; ++step) {
+				if (a_previousTick && step == a_steps - 1) {
+					*a_previousTick = *this;
+				}
+
+				IntegrateCategory<SpringCategory::kCamera>(a_delta, a_integrators[static_cast<int>(SpringCategory::kCamera)],
+					a_maxSubsteps[static_cast<int>(SpringCategory::kCamera)]);
+				IntegrateCategory<SpringCategory::kMovement>(a_delta, a_integrators[static_cast<int>(SpringCategory::kMovement)],
+					a_maxSubsteps[static_cast<int>(SpringCategory::kMovement)]);
+				IntegrateCategory<SpringCategory::kSprint>(a_delta, a_integrators[static_cast<int>(SpringCategory::kSprint)],
+					a_maxSubsteps[static_cast<int>(SpringCategory::kSprint)]);
+				IntegrateCategory<SpringCategory::kJump>(a_delta, a_integrators[static_cast<int>(SpringCategory::kJump)],
+					a_maxSubsteps[static_cast<int>(SpringCategory::kJump)]);
+			}
+		}
+
+		// Every slot must be staged again next frame
+		std::fill(std::begin(activeMask), std::end(activeMask), LANE_FROZEN);
+	}
+
+	void SpringBank::AddVelocity(SpringSlot a_slot, const Vec3& a_posImpulse, const Vec3& a_rotImpulse)
+	{
+		const int pos = PositionLane(a_slot);
+		const int rot = RotationLane(a_slot);
+		velocity[pos] += a_posImpulse.x;
+		velocity[pos + 1] += a_posImpulse.y;
+		velocity[pos + 2] += a_posImpulse.z;
+		velocity[rot] += a_rotImpulse.x;
+		velocity[rot + 1] += a_rotImpulse.y;
+		velocity[rot + 2] += a_rotImpulse.z;
+	}
+
+	void SpringBank::ScaleVelocity(SpringSlot a_slot, float a_scale)
+	{
+		const int first = PositionLane(a_slot);
+		for (int lane = first; lane < first + kLanesPerSlot; ++lane) {
+			velocity[lane] *= a_scale;
+		}
+	}
+
+	void SpringBank::Decay(SpringSlot a_slot, float a_rate)
+	{
+		const int first = PositionLane(a_slot);
+		for (int lane = first; lane < first + kLanesPerSlot; ++lane) {
+			offset[lane] += (0.0f - offset[lane]) * a_rate;
+			velocity[lane] += (0.0f - velocity[lane]) * a_rate;
+		}
+	}
+
+	bool SpringBank::IsAtRest(SpringSlot a_slot, float a_posEnergy, float a_rotEnergy) const
+	{
+		auto groupEnergy = [this](int a_first) {
+			float energy = 0.0f;
+			for (int lane = a_first; lane < a_first + kLanesPerGroup; ++lane) {
+				energy += offset[lane] * offset[lane] + velocity[lane] * velocity[lane];
+			}
+			return energy;
+		};
+
+		return groupEnergy(PositionLane(a_slot)) < a_posEnergy && groupEnergy(RotationLane(a_slot)) < a_rotEnergy;
+	}
+
+	void SpringBank::Reset(SpringSlot a_slot)
+	{
+		const int first = PositionLane(a_slot);
+		for (int lane = first; lane < first + kLanesPerSlot; ++lane) {
+			offset[lane] = 0.0f;
+			velocity[lane] = 0.0f;
+		}
+	}
+
+	void SpringBank::ResetAll()
+	{
+		std::fill(std::begin(offset), std::end(offset), 0.0f);
+		std::fill(std::begin(velocity), std::end(velocity), 0.0f);
+		std::fill(std::begin(target), std::end(target), 0.0f);
+		std::fill(std::begin(stiffness), std::end(stiffness), 0.0f);
+		std::fill(std::begin(damping), std::end(damping), 0.0f);
+		std::fill(std::begin(maxOffset), std::end(maxOffset), 0.0f);
+		std::fill(std::begin(activeMask), std::end(activeMask), LANE_FROZEN);
+	}
+}
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "Vec3.h"
+
+#include <array>
+#include <cstdint>
+
+namespace Inertia
+{
+	// Slots in the spring bank
+	// Grouped by category (right/left twins adjacent) so each category's lanes are contiguous
+	enum class SpringSlot : int
+	{
+		kCamera = 0,        // Camera rotation-based inertia (single or right hand)
+		kCameraLeft = 1,    // Left hand camera inertia (dual clavicle)
+		kMovement = 2,      // Player movement-based inertia (single or right hand)
+		kMovementLeft = 3,  // Left hand movement inertia (dual clavicle)
+		kSprint = 4,        // Sprint transition inertia
+		kSprintLeft = 5,    // Left hand sprint inertia (dual clavicle)
+		kJump = 6,          // Jump/landing inertia
+		kJumpLeft = 7,      // Left hand jump inertia (dual clavicle)
+		kTotal = 8
+	};
+
+	// Spring categories - each owns a right/left slot pair (16 contiguous lanes)
+	enum class SpringCategory : int
+	{
+		kCamera = 0,
+		kMovement = 1,
+		kSprint = 2,
+		kJump = 3,
+		kTotal = 4
+	};
+
+	// How the bank advances a category's lanes (values match the [Integrator] INI keys)
+	enum class SpringIntegrator : int
+	{
+		kSemiImplicitEuler = 0,  // Substepped, velocity then position (original behaviour)
+		kExact = 1,              // Closed-form damped oscillator, one evaluation per frame
+		kVelocityVerlet = 2,     // Second order, substepped
+		kRK4 = 3,                // Fourth order Runge-Kutta, substepped
+		kImplicitEuler = 4,      // Unconditionally stable backward Euler, substepped
+		kTotal = 5
+	};
+
+	// Compile-time limits per spring category
+	// Offset limits of 0 mean the clamp is staged per frame from the weapon settings
+	template <SpringCategory C>
+	struct SpringTraits;
+
+	template <>
+	struct SpringTraits<SpringCategory::kCamera>
+	{
+		static constexpr float kMaxPosVelocity = 500.0f;  // units/sec
+		static constexpr float kMaxRotVelocity = 50.0f;   // radians/sec
+		static constexpr float kMaxPosOffset = 0.0f;      // maxOffset setting
+		static constexpr float kMaxRotOffset = 0.0f;      // maxRotation setting
+	};
+
+	template <>
+	struct SpringTraits<SpringCategory::kMovement>
+	{
+		static constexpr float kMaxPosVelocity = 300.0f;
+		static constexpr float kMaxRotVelocity = 30.0f;
+		static constexpr float kMaxPosOffset = 0.0f;      // movementMaxOffset setting
+		static constexpr float kMaxRotOffset = 0.0f;      // movementMaxRotation setting
+	};
+
+	template <>
+	struct SpringTraits<SpringCategory::kSprint>
+	{
+		static constexpr float kMaxPosVelocity = 400.0f;
+		static constexpr float kMaxRotVelocity = 40.0f;
+		static constexpr float kMaxPosOffset = 30.0f;
+		static constexpr float kMaxRotOffset = 0.785f;    // 45 degrees
+	};
+
+	template <>
+	struct SpringTraits<SpringCategory::kJump>
+	{
+		static constexpr float kMaxPosVelocity = 500.0f;
+		static constexpr float kMaxRotVelocity = 50.0f;
+		static constexpr float kMaxPosOffset = 40.0f;
+		static constexpr float kMaxRotOffset = 0.785f;    // 45 degrees
+	};
+
+	// Structure-of-arrays storage for every spring's position and rotation lanes
+	// Each slot owns 8 lanes: position xyz + pad, then rotation xyz + pad.
+	// The spring updaters only stage targets/parameters per lane; Integrate() then advances
+	// each category with its own integrator, using SSE (or AVX when compiled with /arch:AVX).
+	class SpringBank
+	{
+	public:
+		static constexpr int kLanesPerGroup = 4;                          // xyz + pad
+		static constexpr int kLanesPerSlot = kLanesPerGroup * 2;          // position group + rotation group
+		static constexpr int kSlotCount = static_cast<int>(SpringSlot::kTotal);
+		static constexpr int kLaneCount = kLanesPerSlot * kSlotCount;     // 64 lanes
+		static constexpr int kCategoryCount = static_cast<int>(SpringCategory::kTotal);
+		static constexpr int kLanesPerCategory = kLaneCount / kCategoryCount;
+
+		static constexpr int kIntegratorCount = static_cast<int>(SpringIntegrator::kTotal);
+
+		// Sub-stepping for stability: each category takes just enough substeps to stay inside its
+		// integrator's stability limit (see StableSubstep), up to kMaxSubsteps per Integrate() step
+		static constexpr int kMaxSubsteps = 16;
+		static constexpr float kStabilityMargin = 0.5f;  // Fraction of the stability limit a substep may use
+
+		// Integrator used for each category, indexed by SpringCategory
+		using IntegratorSet = std::array<SpringIntegrator, kCategoryCount>;
+
+		// Largest stable substep for each category, indexed by SpringCategory (infinity = one step)
+		using SubstepSet = std::array<float, kCategoryCount>;
+
+		// Per-group spring parameters (mass already folded into stiffness/damping)
+		struct GroupParams
+		{
+			float stiffness{ 0.0f };    // k / m
+			float damping{ 0.0f };      // c / m
+			float maxOffset{ 0.0f };    // Offset clamp per axis (ignored when the category's traits fix it)
+		};
+
+		SpringBank() { ResetAll(); }
+
+		// Stage one slot for the next Integrate() call
+		// Targets are the spring's rest point: F = -k * (offset - target) - c * velocity
+		void Stage(SpringSlot a_slot,
+			const Vec3& a_posTarget, const GroupParams& a_posParams, bool a_posActive,
+			const Vec3& a_rotTarget, const GroupParams& a_rotParams, bool a_rotActive);
+
+		// Exclude a slot from the next Integrate() call (state is left untouched)
+		void Freeze(SpringSlot a_slot);
+
+		// Advance every staged lane a_steps times by a_delta, each category with its selected integrator
+		// and split into substeps no longer than its a_maxSubsteps entry
+		// If a_previousTick is set it receives a copy of the bank just before the final step
+		// Lanes are frozen again afterwards, so each slot must be re-staged every frame
+		void Integrate(float a_delta, const IntegratorSet& a_integrators, const SubstepSet& a_maxSubsteps,
+			int a_steps = 1, SpringBank* a_previousTick = nullptr);
+
+		// Largest substep a_integrator keeps x'' = -k * (x - target) - c * x' stable at (mass folded into
+		// k and c), scaled by kStabilityMargin; infinity for integrators that are stable at any step
+		static float StableSubstep(SpringIntegrator a_integrator, float a_stiffness, float a_damping);
+
+		// Substeps needed to cover a_delta without exceeding a_maxSubstep (not clamped to kMaxSubsteps)
+		static int RequiredSubsteps(float a_delta, float a_maxSubstep);
+
+		// State access
+		Vec3 GetPositionOffset(SpringSlot a_slot) const { return Load(offset, PositionLane(a_slot)); }
+		Vec3 GetRotationOffset(SpringSlot a_slot) const { return Load(offset, RotationLane(a_slot)); }
+		Vec3 GetPositionVelocity(SpringSlot a_slot) const { return Load(velocity, PositionLane(a_slot)); }
+		Vec3 GetRotationVelocity(SpringSlot a_slot) const { return Load(velocity, RotationLane(a_slot)); }
+
+		// Impulses (applied to velocity before integration)
+		void AddVelocity(SpringSlot a_slot, const Vec3& a_posImpulse, const Vec3& a_rotImpulse);
+		void ScaleVelocity(SpringSlot a_slot, float a_scale);
+
+		// Spring energy (offset^2 + velocity^2 summed over xyz) is below the threshold for both groups
+		// Used to put a slot to sleep once it has settled at its neutral rest point
+		bool IsAtRest(SpringSlot a_slot, float a_posEnergy, float a_rotEnergy) const;
+
+		// Lerp offset and velocity towards zero (used when a spring type is disabled)
+		void Decay(SpringSlot a_slot, float a_rate);
+
+		void Reset(SpringSlot a_slot);
+		void ResetAll();
+
+	private:
+		static constexpr int PositionLane(SpringSlot a_slot) { return static_cast<int>(a_slot) * kLanesPerSlot; }
+		static constexpr int RotationLane(SpringSlot a_slot) { return PositionLane(a_slot) + kLanesPerGroup; }
+
+		static Vec3 Load(const float* a_lanes, int a_first)
+		{
+			return { a_lanes[a_first], a_lanes[a_first + 1], a_lanes[a_first + 2] };
+		}
+
+		void StageGroup(int a_first, const Vec3& a_target, const GroupParams& a_params, bool a_active);
+
+		// Runs one category's lanes through the selected integrator policy
+		template <SpringCategory C>
+		void IntegrateCategory(float a_delta, SpringIntegrator a_integrator, float a_maxSubstep);
+
+		// Spring state
+		alignas(32) float offset[kLaneCount];
+		alignas(32) float velocity[kLaneCount];
+
+		// Per-lane parameters, rewritten by Stage() every frame
+		alignas(32) float target[kLaneCount];
+		alignas(32) float stiffness[kLaneCount];
+		alignas(32) float damping[kLaneCount];
+		alignas(32) float maxOffset[kLaneCount];
+		alignas(32) std::uint32_t activeMask[kLaneCount];  // All bits set = integrate, 0 = keep current state
+	};
+}
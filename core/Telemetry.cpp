@@ -0,0 +1,27 @@
+#include "Telemetry.h"
+
+namespace Inertia::Core
+{
+	TelemetrySample MakeTelemetrySample(const FrameState& a_state, double a_time, float a_costUs)
+	{
+		TelemetrySample sample;
+		sample.time = a_time;
+		sample.cameraSpeed = a_state.cameraSpeed;
+
+		const SpringSlot slots[] = { kRightHandSlots.camera, kRightHandSlots.movement, kRightHandSlots.sprint, kRightHandSlots.jump };
+		for (std::size_t i = 0; i < sample.offset.size(); ++i) {
+			const Vec3 offset = a_state.springBank.GetPositionOffset(slots[i]);
+			const Vec3 velocity = a_state.springBank.GetPositionVelocity(slots[i]);
+			sample.offset[i] = Length(offset);
+			sample.energy[i] = offset.x * offset.x + offset.y * offset.y + offset.z * offset.z +
+				velocity.x * velocity.x + velocity.y * velocity.y + velocity.z * velocity.z;
+		}
+
+		sample.equipBlend = a_state.equipBlendFactor;
+		sample.actionBlend = a_state.actionBlendFactor;
+		sample.airBlend = a_state.movementAirBlend;
+		sample.settling = a_state.settlingFactor;
+		sample.costUs = a_costUs;
+		return sample;
+	}
+}
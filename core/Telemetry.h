@@ -0,0 +1,29 @@
+#pragma once
+
+#include "InertiaFrame.h"
+#include "SampleRing.h"
+
+namespace Inertia::Core
+{
+	// One frame of the values the on-screen overlay plots (right hand springs)
+	struct TelemetrySample
+	{
+		double time{ 0.0 };           // Seconds, from the owner's running frame clock
+		float cameraSpeed{ 0.0f };    // Smoothed camera velocity length
+		// Per SpringCategory: position offset length, and the position group's energy as the sleep
+		// check measures it (offset^2 + velocity^2)
+		std::array<float, static_cast<std::size_t>(SpringCategory::kTotal)> offset{};
+		std::array<float, static_cast<std::size_t>(SpringCategory::kTotal)> energy{};
+		float equipBlend{ 0.0f };
+		float actionBlend{ 0.0f };
+		float airBlend{ 0.0f };       // Movement air blend (0 = in air)
+		float settling{ 0.0f };
+		float costUs{ 0.0f };         // Game thread time spent by the plugin on this frame
+	};
+
+	// About 14 seconds at 144 fps, 34 at 60
+	using TelemetryRing = SampleRing<TelemetrySample, 2048>;
+
+	// Sample a_state as it is after a completed step
+	TelemetrySample MakeTelemetrySample(const FrameState& a_state, double a_time, float a_costUs);
+}
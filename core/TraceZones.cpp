@@ -0,0 +1,191 @@
+#include "TraceZones.h"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Inertia::Perf
+{
+	namespace
+	{
+		// 64K zones per thread (1.5MB), several seconds of every zone at a high frame rate
+		constexpr std::uint32_t kEventsPerThread = 1u << 16;
+
+		struct Event
+		{
+			const char* name;
+			std::uint64_t start;
+			std::uint64_t end;
+		};
+
+		struct ThreadBuffer
+		{
+			std::unique_ptr<Event[]> events{ std::make_unique<Event[]>(kEventsPerThread) };
+			std::atomic<std::uint32_t> count{ 0 };
+			std::atomic<std::uint64_t> dropped{ 0 };
+			const char* name{ nullptr };
+			std::uint32_t id{ 0 };
+		};
+
+		struct Registry
+		{
+			std::mutex mutex;
+			std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+			std::uint64_t epochTicks{ 0 };
+			double epochUs{ 0.0 };
+		};
+
+		// Never destroyed: detached threads can still record while the process exits
+		Registry& GetRegistry()
+		{
+			static auto* registry = new Registry();
+			return *registry;
+		}
+
+		thread_local ThreadBuffer* threadBuffer = nullptr;
+		thread_local const char* threadName = nullptr;
+
+		// First zone on this thread allocates its buffer; every later zone appends without locking
+		ThreadBuffer& GetThreadBuffer()
+		{
+			if (!threadBuffer) {
+				auto& registry = GetRegistry();
+				auto buffer = std::make_unique<ThreadBuffer>();
+				std::lock_guard lock(registry.mutex);
+				buffer->id = static_cast<std::uint32_t>(registry.buffers.size()) + 1;
+				buffer->name = threadName;
+				threadBuffer = buffer.get();
+				registry.buffers.push_back(std::move(buffer));
+			}
+			return *threadBuffer;
+		}
+
+		void AppendEscaped(std::string& a_out, const char* a_text)
+		{
+			for (const char* c = a_text; *c; ++c) {
+				if (*c == '"' || *c == '\\') {
+					a_out += '\\';
+				}
+				a_out += *c;
+			}
+		}
+	}
+
+	namespace detail
+	{
+		std::atomic<bool> capturing{ false };
+
+		void Record(const char* a_name, std::uint64_t a_start, std::uint64_t a_end)
+		{
+			auto& buffer = GetThreadBuffer();
+			const std::uint32_t index = buffer.count.load(std::memory_order_relaxed);
+			if (index >= kEventsPerThread) {
+				buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+			buffer.events[index] = { a_name, a_start, a_end };
+			buffer.count.store(index + 1, std::memory_order_release);
+		}
+	}
+
+	void StartZoneCapture()
+	{
+		auto& registry = GetRegistry();
+		{
+			std::lock_guard lock(registry.mutex);
+			for (auto& buffer : registry.buffers) {
+				buffer->count.store(0, std::memory_order_relaxed);
+				buffer->dropped.store(0, std::memory_order_relaxed);
+			}
+			registry.epochUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now().time_since_epoch()).count();
+			registry.epochTicks = Now();
+		}
+		detail::capturing.store(true, std::memory_order_release);
+	}
+
+	void StopZoneCapture()
+	{
+		detail::capturing.store(false, std::memory_order_release);
+	}
+
+	std::string ZonesToChromeJson()
+	{
+		auto& registry = GetRegistry();
+		std::lock_guard lock(registry.mutex);
+
+		std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+		char line[160];
+		bool first = true;
+		auto separate = [&]() {
+			if (!first) {
+				json += ",\n";
+			}
+			first = false;
+		};
+
+		for (const auto& buffer : registry.buffers) {
+			separate();
+			std::snprintf(line, sizeof(line), "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"", buffer->id);
+			json += line;
+			if (buffer->name) {
+				AppendEscaped(json, buffer->name);
+			} else {
+				std::snprintf(line, sizeof(line), "Thread %u", buffer->id);
+				json += line;
+			}
+			json += "\"}}";
+
+			const std::uint32_t count = buffer->count.load(std::memory_order_acquire);
+			for (std::uint32_t i = 0; i < count; ++i) {
+				const Event& event = buffer->events[i];
+				// Zones from before the capture started (in flight at StartZoneCapture) are skipped
+				if (event.start < registry.epochTicks) {
+					continue;
+				}
+				separate();
+				json += "{\"ph\":\"X\",\"name\":\"";
+				AppendEscaped(json, event.name);
+				std::snprintf(line, sizeof(line), "\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+					buffer->id,
+					registry.epochUs + TicksToNs(event.start - registry.epochTicks) / 1000.0,
+					TicksToNs(event.end - event.start) / 1000.0);
+				json += line;
+			}
+		}
+		json += "\n]}\n";
+		return json;
+	}
+
+	std::uint64_t GetRecordedZoneCount()
+	{
+		auto& registry = GetRegistry();
+		std::lock_guard lock(registry.mutex);
+		std::uint64_t total = 0;
+		for (const auto& buffer : registry.buffers) {
+			total += buffer->count.load(std::memory_order_relaxed);
+		}
+		return total;
+	}
+
+	std::uint64_t GetDroppedZoneCount()
+	{
+		auto& registry = GetRegistry();
+		std::lock_guard lock(registry.mutex);
+		std::uint64_t total = 0;
+		for (const auto& buffer : registry.buffers) {
+			total += buffer->dropped.load(std::memory_order_relaxed);
+		}
+		return total;
+	}
+
+	void SetZoneThreadName(const char* a_name)
+	{
+		threadName = a_name;
+		if (threadBuffer) {
+			std::lock_guard lock(GetRegistry().mutex);
+			threadBuffer->name = a_name;
+		}
+	}
+}
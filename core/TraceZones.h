@@ -0,0 +1,79 @@
+#pragma once
+
+#include "PerfHistogram.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace Inertia::Perf
+{
+#ifdef FPINERTIA_TRACE_ZONES
+	inline constexpr bool kZonesEnabled = true;
+#else
+	inline constexpr bool kZonesEnabled = false;
+#endif
+
+	// Scoped trace zones, exported as a Chrome trace-event JSON file (chrome://tracing, Perfetto)
+	//
+	// Compiled in with FPINERTIA_TRACE_ZONES (the plugin's diagnostics build); otherwise
+	// FPI_TRACE_ZONE expands to nothing. When compiled in, a zone outside a capture is one relaxed
+	// load. During a capture each thread appends to its own preallocated buffer (allocated the
+	// first time that thread records); a full buffer drops further zones rather than growing.
+	// Timestamps are steady_clock microseconds (QPC on Windows), so a capture lines up with other
+	// tools' frame timing captures of the same session.
+	namespace detail
+	{
+		extern std::atomic<bool> capturing;
+		void Record(const char* a_name, std::uint64_t a_start, std::uint64_t a_end);
+	}
+
+	inline bool IsCapturingZones() { return kZonesEnabled && detail::capturing.load(std::memory_order_relaxed); }
+
+	// Clear every thread's buffer and start recording
+	void StartZoneCapture();
+
+	// Stop recording; the buffers keep their zones until the next StartZoneCapture
+	void StopZoneCapture();
+
+	// The last capture as Chrome trace-event JSON (call after StopZoneCapture)
+	std::string ZonesToChromeJson();
+
+	// Zones recorded and dropped (thread buffer full) in the last capture
+	std::uint64_t GetRecordedZoneCount();
+	std::uint64_t GetDroppedZoneCount();
+
+	// Name this thread in the trace (a_name must outlive the capture, e.g. a string literal)
+	void SetZoneThreadName(const char* a_name);
+
+	// Records its lifetime as one complete event; a_name must be a string literal
+	class Zone
+	{
+	public:
+		explicit Zone(const char* a_name) :
+			name(a_name),
+			start(IsCapturingZones() ? Now() : 0)
+		{}
+
+		~Zone()
+		{
+			if (start != 0) {
+				detail::Record(name, start, Now());
+			}
+		}
+
+		Zone(const Zone&) = delete;
+		Zone& operator=(const Zone&) = delete;
+
+	private:
+		const char* name;
+		std::uint64_t start;
+	};
+}
+
+// Trace the rest of the enclosing scope as a_name (one zone per scope)
+#ifdef FPINERTIA_TRACE_ZONES
+#	define FPI_TRACE_ZONE(a_name) ::Inertia::Perf::Zone fpiTraceZone { a_name }
+#else
+#	define FPI_TRACE_ZONE(a_name) static_cast<void>(0)
+#endif
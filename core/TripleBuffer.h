@@ -0,0 +1,57 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace Inertia
+{
+	// Single-producer / single-consumer handoff of the latest value, wait-free on both sides
+	//
+	// Three copies of T: the producer fills its back buffer and swaps it into the middle; the
+	// consumer swaps the middle into its front buffer when a newer value is there. Neither side
+	// ever touches the buffer the other owns, so the consumer always reads one complete value
+	// (never a mix of two publishes) without retrying or blocking the producer.
+	template <class T>
+	class TripleBuffer
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "TripleBuffer holds plain values");
+
+	public:
+		// Producer - write the next value here, then Publish() it
+		T& Back() { return buffers[back]; }
+
+		void Publish()
+		{
+			back = middle.exchange(static_cast<std::uint8_t>(back | FRESH), std::memory_order_acq_rel) & INDEX_MASK;
+		}
+
+		void Publish(const T& a_value)
+		{
+			Back() = a_value;
+			Publish();
+		}
+
+		// Consumer - take the latest published value into Front(); false if nothing new was published
+		bool Acquire()
+		{
+			if (!(middle.load(std::memory_order_relaxed) & FRESH)) {
+				return false;
+			}
+			front = middle.exchange(front, std::memory_order_acq_rel) & INDEX_MASK;
+			return true;
+		}
+
+		const T& Front() const { return buffers[front]; }
+
+	private:
+		static constexpr std::uint8_t INDEX_MASK = 0x3;
+		static constexpr std::uint8_t FRESH = 0x4;  // Middle holds a value the consumer hasn't taken
+
+		// Each side's index on its own cache line so they don't contend
+		T buffers[3]{};
+		alignas(64) std::atomic<std::uint8_t> middle{ 1 };
+		alignas(64) std::uint8_t back{ 0 };   // Producer only
+		alignas(64) std::uint8_t front{ 2 };  // Consumer only
+	};
+}
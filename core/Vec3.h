@@ -0,0 +1,61 @@
+#pragma once
+
+// Vector type used by the physics core
+// Inside the DLL (FPINERTIA_CORE_NIPOINT3, compiled with src/PCH.h) this is the game's NiPoint3, so
+// spring state passes between the plugin and the core with no conversion. The headless build
+// (Linux/GCC/Clang, tools) gets a minimal stand-in with the same layout and the operators the core uses.
+
+#if defined(FPINERTIA_CORE_NIPOINT3)
+
+namespace Inertia
+{
+	using Vec3 = RE::NiPoint3;
+}
+
+#else
+
+namespace Inertia
+{
+	struct Vec3
+	{
+		float x{ 0.0f };
+		float y{ 0.0f };
+		float z{ 0.0f };
+
+		constexpr Vec3() = default;
+		constexpr Vec3(float a_x, float a_y, float a_z) :
+			x(a_x), y(a_y), z(a_z) {}
+
+		constexpr Vec3 operator+(const Vec3& a_rhs) const { return { x + a_rhs.x, y + a_rhs.y, z + a_rhs.z }; }
+		constexpr Vec3 operator-(const Vec3& a_rhs) const { return { x - a_rhs.x, y - a_rhs.y, z - a_rhs.z }; }
+		constexpr Vec3 operator*(float a_scale) const { return { x * a_scale, y * a_scale, z * a_scale }; }
+		constexpr Vec3 operator/(float a_scale) const { return { x / a_scale, y / a_scale, z / a_scale }; }
+		constexpr Vec3 operator-() const { return { -x, -y, -z }; }
+
+		constexpr Vec3& operator+=(const Vec3& a_rhs)
+		{
+			x += a_rhs.x;
+			y += a_rhs.y;
+			z += a_rhs.z;
+			return *this;
+		}
+
+		constexpr Vec3& operator-=(const Vec3& a_rhs)
+		{
+			x -= a_rhs.x;
+			y -= a_rhs.y;
+			z -= a_rhs.z;
+			return *this;
+		}
+
+		constexpr Vec3& operator*=(float a_scale)
+		{
+			x *= a_scale;
+			y *= a_scale;
+			z *= a_scale;
+			return *this;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,548 @@
+// FPInertiaBench - ns/frame for each stage of the per-frame inertia pipeline and for the full frame
+//
+// Drives the same Core::StepCamera / Core::StepSprings / Core::ApplyOffset path the plugin runs in
+// InertiaManager::Update and OnFirstPersonUpdate with synthetic input, for every combination of:
+//   hands: single (chest pivot) / dual (both clavicles with offset)
+//   input: idle (no camera or movement input - springs settle and sleep) / heavy (constant looking
+//          around, strafing, sprint toggles, jumps, attacks and stance changes)
+//   rate:  30 / 60 / 144 / 240 Hz frame deltas
+//
+// Stage timings come from StageTimes laps (timer overhead subtracted). The full frame is timed
+// separately without any inner timers. Each value is the median over --repeats runs.
+//
+// --rotation instead checks ApplyOffset's opt-in exp map rotation path (RotationMath) against the
+// exact and default Euler paths and times both; it exits with 1 if the polynomial error is out of tolerance.
+//
+// Usage: FPInertiaBench [--format table|json|csv] [--out <file>] [--frames <n>] [--repeats <n>] [--rotation]
+
+#include "InertiaFrame.h"
+#include "RotationMath.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+	using namespace Inertia;
+	using Clock = std::chrono::steady_clock;
+
+	constexpr float TWO_PI = 2.0f * Core::kPi;
+
+	struct Options
+	{
+		std::string format{ "table" };
+		std::string out;
+		int frames{ 20000 };
+		int repeats{ 5 };
+		bool rotation{ false };
+	};
+
+	// Polynomial vs exact sin/cos over the self-check range, as a max rotation matrix entry error
+	constexpr float ROTATION_TOLERANCE = 1e-6f;
+
+	enum class InputKind
+	{
+		Idle,
+		Heavy
+	};
+
+	struct Scenario
+	{
+		bool dual{ false };
+		InputKind input{ InputKind::Idle };
+		int hz{ 60 };
+	};
+
+	// ns/frame per stage (medians), plus how often there was anything to apply
+	struct Result
+	{
+		Scenario scenario;
+		double stepCamera{ 0.0 };
+		double state{ 0.0 };
+		double camera{ 0.0 };
+		double movement{ 0.0 };
+		double sprint{ 0.0 };
+		double jump{ 0.0 };
+		double integrate{ 0.0 };
+		double combine{ 0.0 };
+		double apply{ 0.0 };
+		double fullFrame{ 0.0 };
+		double awakeFraction{ 0.0 };
+	};
+
+	volatile float sink = 0.0f;
+
+	// Global Settings defaults (src/Settings.h)
+	Core::CoreSettings MakeSettings()
+	{
+		return Core::CoreSettings{};
+	}
+
+	// CompileWeaponProfile() applied to the WeaponInertiaSettings defaults (src/Settings.h),
+	// with sprint inertia switched on so the sprint stage does real work under heavy input
+	CompiledWeaponProfile MakeProfile()
+	{
+		constexpr float DEG = Core::kDegToRad;
+		CompiledWeaponProfile profile;
+
+		profile.cameraStiffness = 150.0f;
+		profile.cameraDamping = 12.0f;
+		profile.cameraMaxOffset = 8.0f;
+		profile.cameraMaxRotation = 15.0f * DEG;
+		profile.cameraTargetMaxOffset = 8.0f * 2.0f;
+		profile.cameraTargetMaxRotation = profile.cameraMaxRotation * 2.0f;
+		profile.cameraPitchPosScale = 1.5f;
+		profile.cameraPitchRotScale = 0.08f;
+		profile.cameraRollRotScale = 0.04f;
+		profile.cameraAirMult = 0.3f;
+
+		profile.movementEnabled = true;
+		profile.movementStiffness = 80.0f;
+		profile.movementDamping = 6.0f;
+		profile.movementMaxOffset = 12.0f;
+		profile.movementMaxRotation = 20.0f * DEG;
+		profile.movementLeftMult = 1.0f;
+		profile.movementRightMult = 1.0f;
+		profile.movementForwardMult = 0.5f;
+		profile.movementBackwardMult = 0.5f;
+
+		profile.sprintEnabled = true;
+		profile.sprintStartPosImpulse = { 0.0f, 8.0f * 20.0f, -3.0f * 15.0f };
+		profile.sprintStartRotImpulse = { 5.0f * DEG * 10.0f, 0.0f, 0.0f };
+		profile.sprintStopPosImpulse = { 0.0f, -8.0f * 25.0f, 3.0f * 12.0f };
+		profile.sprintStopRotImpulse = { -5.0f * DEG * 8.0f, 0.0f, 0.0f };
+		profile.sprintBlendTime = 0.1f;
+		profile.sprintStiffness = 60.0f;
+		profile.sprintDamping = 5.0f;
+
+		profile.jumpEnabled = true;
+		profile.jumpPosImpulse = { 0.0f, 4.0f * 15.0f, -6.0f * 20.0f };
+		profile.jumpRotImpulse = { 3.0f * DEG * 8.0f, 0.0f, 0.0f };
+		profile.fallPosImpulse = { 0.0f, 4.0f * 15.0f, -6.0f * 20.0f };
+		profile.fallRotImpulse = { 3.0f * DEG * 8.0f, 0.0f, 0.0f };
+		profile.jumpStiffness = 40.0f;
+		profile.jumpDamping = 3.0f;
+		profile.landStiffness = 120.0f;
+		profile.landDamping = 10.0f;
+		profile.landImpulseY = 3.0f;
+		profile.landImpulseZ = 10.0f;
+		profile.landRotImpulse = 5.0f * DEG;
+		profile.airTimeImpulseScale = 1.5f;
+
+		profile.simultaneousThreshold = 0.5f;
+		profile.simultaneousCameraMult = 1.0f;
+		profile.simultaneousMovementMult = 1.0f;
+
+		Core::CompileStability(profile, MakeSettings().settleDampingMult);
+		return profile;
+	}
+
+	// Deterministic per-frame input for one scenario
+	std::vector<Core::FrameInputs> MakeInputs(const Scenario& a_scenario, int a_frames)
+	{
+		std::vector<Core::FrameInputs> inputs(static_cast<std::size_t>(a_frames));
+		const float delta = 1.0f / static_cast<float>(a_scenario.hz);
+
+		for (int i = 0; i < a_frames; ++i) {
+			auto& in = inputs[static_cast<std::size_t>(i)];
+			in.delta = delta;
+			in.dualClavicle = a_scenario.dual;
+			if (a_scenario.input == InputKind::Idle) {
+				continue;
+			}
+
+			// Looking around with some high-frequency jitter, strafing, sprinting every other
+			// second, a jump every 1.5 s, an attack every 2 s and a stance change every 4 s
+			const float t = static_cast<float>(i) * delta;
+			in.camera.yaw = 0.6f * std::sin(TWO_PI * 0.5f * t) + 0.15f * std::sin(TWO_PI * 2.3f * t);
+			in.camera.pitch = 0.2f * std::sin(TWO_PI * 0.8f * t);
+			in.sprinting = (static_cast<int>(t) % 2) == 1;
+			in.moveInputX = in.sprinting ? 0.0f : std::sin(TWO_PI * 0.4f * t);
+			in.moveInputY = in.sprinting ? 1.0f : 0.5f * std::cos(TWO_PI * 0.3f * t);
+			in.inMidair = std::fmod(t, 1.5f) < 0.6f;
+			in.inJumpState = in.inMidair;
+			in.inAction = std::fmod(t, 2.0f) < 0.4f;
+			in.stance = static_cast<Stance>(static_cast<int>(t / 4.0f) % static_cast<int>(Stance::COUNT));
+		}
+		return inputs;
+	}
+
+	// Weapon drawn and fully blended in, as after the equip blend in Update()
+	Core::FrameState MakeState()
+	{
+		Core::FrameState state;
+		state.equipBlendFactor = 1.0f;
+		return state;
+	}
+
+	// Same as OnFirstPersonUpdate: the animation system rewrites the node every frame, then the offset is added
+	void ApplyFrame(const Core::FrameOutput& a_output, const Core::CoreSettings& a_settings, int a_pivot)
+	{
+		Vec3 translate{ 0.0f, 0.0f, 0.0f };
+		Mat3 rotate;
+		Core::ApplyOffset(translate, rotate, a_output.combinedState, a_settings.enablePosition, a_settings.enableRotation, a_pivot, false);
+		if (a_output.useDualClaviclePivot) {
+			Vec3 translateLeft{ 0.0f, 0.0f, 0.0f };
+			Mat3 rotateLeft;
+			Core::ApplyOffset(translateLeft, rotateLeft, a_output.combinedStateLeft, a_settings.enablePosition, a_settings.enableRotation, a_pivot, false);
+			translate += translateLeft;
+			rotate = rotate * rotateLeft;
+		}
+		sink = sink + translate.x + rotate.entry[0][1];
+	}
+
+	// Cost of one steady_clock read, subtracted per timed section
+	double MeasureTimerOverhead()
+	{
+		constexpr int SAMPLES = 200000;
+		double total = 0.0;
+		for (int i = 0; i < SAMPLES; ++i) {
+			auto a = Clock::now();
+			auto b = Clock::now();
+			total += std::chrono::duration<double, std::nano>(b - a).count();
+		}
+		return total / SAMPLES;
+	}
+
+	double Median(std::vector<double> a_values)
+	{
+		std::sort(a_values.begin(), a_values.end());
+		const std::size_t mid = a_values.size() / 2;
+		return (a_values.size() % 2) ? a_values[mid] : 0.5 * (a_values[mid - 1] + a_values[mid]);
+	}
+
+	double PerFrame(const Core::StageTimes::Stage& a_stage, double a_overhead, int a_frames)
+	{
+		return std::max(0.0, a_stage.ns - a_overhead * a_stage.laps) / a_frames;
+	}
+
+	Result RunScenario(const Scenario& a_scenario, const Options& a_options, double a_overhead)
+	{
+		const Core::CoreSettings settings = MakeSettings();
+		const CompiledWeaponProfile profile = MakeProfile();
+		const std::vector<Core::FrameInputs> inputs = MakeInputs(a_scenario, a_options.frames);
+		const int pivot = a_scenario.dual ? 5 : 0;  // BothClaviclesOffset / Chest
+		const int frames = a_options.frames;
+
+		std::vector<double> stepCamera, state, camera, movement, sprint, jump, integrate, combine, apply, fullFrame;
+		int awakeFrames = 0;
+
+		// Repeat 0 is a warm-up and is not recorded
+		for (int repeat = 0; repeat <= a_options.repeats; ++repeat) {
+			// Staged run - every section timed
+			Core::FrameState frame = MakeState();
+			Core::FrameOutput output;
+			Core::StageTimes times;
+			Core::StageTimes::Stage cameraStep;
+			Core::StageTimes::Stage applyStep;
+			awakeFrames = 0;
+
+			for (const auto& in : inputs) {
+				auto start = Clock::now();
+				const bool primed = Core::StepCamera(frame, in, settings);
+				auto end = Clock::now();
+				cameraStep.ns += std::chrono::duration<double, std::nano>(end - start).count();
+				cameraStep.laps++;
+				if (!primed) {
+					continue;
+				}
+
+				Core::StepSprings(frame, in, settings, profile, output, &times);
+				if (!output.hasOffsets) {
+					continue;
+				}
+				awakeFrames++;
+
+				start = Clock::now();
+				ApplyFrame(output, settings, pivot);
+				end = Clock::now();
+				applyStep.ns += std::chrono::duration<double, std::nano>(end - start).count();
+				applyStep.laps++;
+			}
+
+			// Full frame - no inner timers
+			Core::FrameState fullState = MakeState();
+			Core::FrameOutput fullOutput;
+			auto start = Clock::now();
+			for (const auto& in : inputs) {
+				fullOutput.hasOffsets = false;
+				Core::StepFrame(fullState, in, settings, profile, fullOutput);
+				if (fullOutput.hasOffsets) {
+					ApplyFrame(fullOutput, settings, pivot);
+				}
+			}
+			const double fullNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+			if (repeat == 0) {
+				continue;
+			}
+			stepCamera.push_back(PerFrame(cameraStep, a_overhead, frames));
+			state.push_back(PerFrame(times.state, a_overhead, frames));
+			camera.push_back(PerFrame(times.camera, a_overhead, frames));
+			movement.push_back(PerFrame(times.movement, a_overhead, frames));
+			sprint.push_back(PerFrame(times.sprint, a_overhead, frames));
+			jump.push_back(PerFrame(times.jump, a_overhead, frames));
+			integrate.push_back(PerFrame(times.integrate, a_overhead, frames));
+			combine.push_back(PerFrame(times.combine, a_overhead, frames));
+			apply.push_back(PerFrame(applyStep, a_overhead, frames));
+			fullFrame.push_back(fullNs / frames);
+		}
+
+		Result result;
+		result.scenario = a_scenario;
+		result.stepCamera = Median(stepCamera);
+		result.state = Median(state);
+		result.camera = Median(camera);
+		result.movement = Median(movement);
+		result.sprint = Median(sprint);
+		result.jump = Median(jump);
+		result.integrate = Median(integrate);
+		result.combine = Median(combine);
+		result.apply = Median(apply);
+		result.fullFrame = Median(fullFrame);
+		result.awakeFraction = static_cast<double>(awakeFrames) / frames;
+		return result;
+	}
+
+	const char* HandsName(const Scenario& a_scenario)
+	{
+		return a_scenario.dual ? "dual" : "single";
+	}
+
+	const char* InputName(const Scenario& a_scenario)
+	{
+		return a_scenario.input == InputKind::Heavy ? "heavy" : "idle";
+	}
+
+	std::string ScenarioName(const Scenario& a_scenario)
+	{
+		return std::string(HandsName(a_scenario)) + "-" + InputName(a_scenario) + "-" + std::to_string(a_scenario.hz) + "hz";
+	}
+
+	// Column names shared by every format (ns/frame unless noted)
+	struct Column
+	{
+		const char* name;
+		double Result::*value;
+	};
+
+	constexpr Column COLUMNS[] = {
+		{ "step_camera", &Result::stepCamera },
+		{ "state", &Result::state },
+		{ "camera_spring", &Result::camera },
+		{ "movement_spring", &Result::movement },
+		{ "sprint_spring", &Result::sprint },
+		{ "jump_spring", &Result::jump },
+		{ "integrate", &Result::integrate },
+		{ "combine", &Result::combine },
+		{ "apply_offset", &Result::apply },
+		{ "full_frame", &Result::fullFrame },
+	};
+
+	std::string FormatNumber(double a_value, int a_precision)
+	{
+		char buffer[64];
+		std::snprintf(buffer, sizeof(buffer), "%.*f", a_precision, a_value);
+		return buffer;
+	}
+
+	std::string WriteJson(const std::vector<Result>& a_results, const Options& a_options, double a_overhead)
+	{
+		std::ostringstream out;
+		out << "{\n";
+		out << "  \"benchmark\": \"FPInertiaBench\",\n";
+		out << "  \"unit\": \"ns/frame\",\n";
+		out << "  \"frames\": " << a_options.frames << ",\n";
+		out << "  \"repeats\": " << a_options.repeats << ",\n";
+		out << "  \"timerOverheadNs\": " << FormatNumber(a_overhead, 2) << ",\n";
+		out << "  \"results\": [\n";
+		for (std::size_t i = 0; i < a_results.size(); ++i) {
+			const Result& r = a_results[i];
+			out << "    {\n";
+			out << "      \"scenario\": \"" << ScenarioName(r.scenario) << "\",\n";
+			out << "      \"hands\": \"" << HandsName(r.scenario) << "\",\n";
+			out << "      \"input\": \"" << InputName(r.scenario) << "\",\n";
+			out << "      \"hz\": " << r.scenario.hz << ",\n";
+			out << "      \"awake_fraction\": " << FormatNumber(r.awakeFraction, 4) << ",\n";
+			out << "      \"ns_per_frame\": {";
+			for (std::size_t c = 0; c < std::size(COLUMNS); ++c) {
+				out << (c ? ", " : " ") << "\"" << COLUMNS[c].name << "\": " << FormatNumber(r.*COLUMNS[c].value, 2);
+			}
+			out << " }\n";
+			out << "    }" << (i + 1 < a_results.size() ? "," : "") << "\n";
+		}
+		out << "  ]\n";
+		out << "}\n";
+		return out.str();
+	}
+
+	std::string WriteCsv(const std::vector<Result>& a_results)
+	{
+		std::ostringstream out;
+		out << "scenario,hands,input,hz,awake_fraction";
+		for (const auto& column : COLUMNS) {
+			out << "," << column.name << "_ns";
+		}
+		out << "\n";
+		for (const Result& r : a_results) {
+			out << ScenarioName(r.scenario) << "," << HandsName(r.scenario) << "," << InputName(r.scenario) << ","
+				<< r.scenario.hz << "," << FormatNumber(r.awakeFraction, 4);
+			for (const auto& column : COLUMNS) {
+				out << "," << FormatNumber(r.*column.value, 2);
+			}
+			out << "\n";
+		}
+		return out.str();
+	}
+
+	std::string WriteTable(const std::vector<Result>& a_results, const Options& a_options, double a_overhead)
+	{
+		std::ostringstream out;
+		out << "FPInertiaBench - ns/frame, median of " << a_options.repeats << " x " << a_options.frames
+			<< " frames (timer overhead " << FormatNumber(a_overhead, 1) << " ns subtracted)\n\n";
+
+		char line[256];
+		std::snprintf(line, sizeof(line), "%-20s %6s", "scenario", "awake");
+		out << line;
+		for (const auto& column : COLUMNS) {
+			std::snprintf(line, sizeof(line), " %15s", column.name);
+			out << line;
+		}
+		out << "\n";
+
+		for (const Result& r : a_results) {
+			std::snprintf(line, sizeof(line), "%-20s %5.0f%%", ScenarioName(r.scenario).c_str(), r.awakeFraction * 100.0);
+			out << line;
+			for (const auto& column : COLUMNS) {
+				std::snprintf(line, sizeof(line), " %15.1f", r.*column.value);
+				out << line;
+			}
+			out << "\n";
+		}
+		return out.str();
+	}
+
+	std::string WriteRotation(const RotationMath::SelfCheckResult& a_check, const std::string& a_format)
+	{
+		std::ostringstream out;
+		if (a_format == "json") {
+			out << "{\n";
+			out << "  \"benchmark\": \"FPInertiaBench rotation\",\n";
+			out << "  \"range\": " << FormatNumber(a_check.range, 2) << ",\n";
+			out << "  \"polynomial_error\": " << a_check.maxApproxError << ",\n";
+			out << "  \"euler_error\": " << a_check.maxEulerError << ",\n";
+			out << "  \"euler_ns\": " << FormatNumber(a_check.eulerNs, 2) << ",\n";
+			out << "  \"exp_map_ns\": " << FormatNumber(a_check.expMapNs, 2) << ",\n";
+			out << "  \"checksum\": " << FormatNumber(a_check.checksum, 3) << "\n";
+			out << "}\n";
+		} else if (a_format == "csv") {
+			out << "range,polynomial_error,euler_error,euler_ns,exp_map_ns\n";
+			out << FormatNumber(a_check.range, 2) << "," << a_check.maxApproxError << "," << a_check.maxEulerError << ","
+				<< FormatNumber(a_check.eulerNs, 2) << "," << FormatNumber(a_check.expMapNs, 2) << "\n";
+		} else {
+			char line[256];
+			std::snprintf(line, sizeof(line), "Rotation path: polynomial error %.2e (tolerance %.0e), exp map vs Euler %.2e (max entry, +/-%.1f rad)\n",
+				a_check.maxApproxError, ROTATION_TOLERANCE, a_check.maxEulerError, a_check.range);
+			out << line;
+			std::snprintf(line, sizeof(line), "Rotation path: Euler %.1f ns/call, exp map %.1f ns/call (checksum %.3f)\n",
+				a_check.eulerNs, a_check.expMapNs, a_check.checksum);
+			out << line;
+		}
+		return out.str();
+	}
+
+	void PrintUsage()
+	{
+		std::printf(
+			"Usage: FPInertiaBench [--format table|json|csv] [--out <file>] [--frames <n>] [--repeats <n>] [--rotation]\n"
+			"  --format    Output format (default: table)\n"
+			"  --out       Write to a file instead of stdout\n"
+			"  --frames    Frames per scenario run (default: 20000)\n"
+			"  --repeats   Timed runs per scenario, median reported (default: 5)\n"
+			"  --rotation  Check and time the exp map rotation path instead (exit code 1 if out of tolerance)\n");
+	}
+
+	bool ParseOptions(int a_argc, char** a_argv, Options& a_options)
+	{
+		for (int i = 1; i < a_argc; ++i) {
+			const char* arg = a_argv[i];
+			const bool hasValue = i + 1 < a_argc;
+			if (std::strcmp(arg, "--format") == 0 && hasValue) {
+				a_options.format = a_argv[++i];
+			} else if (std::strcmp(arg, "--out") == 0 && hasValue) {
+				a_options.out = a_argv[++i];
+			} else if (std::strcmp(arg, "--frames") == 0 && hasValue) {
+				a_options.frames = std::max(1, std::atoi(a_argv[++i]));
+			} else if (std::strcmp(arg, "--repeats") == 0 && hasValue) {
+				a_options.repeats = std::max(1, std::atoi(a_argv[++i]));
+			} else if (std::strcmp(arg, "--rotation") == 0) {
+				a_options.rotation = true;
+			} else {
+				return false;
+			}
+		}
+		return a_options.format == "table" || a_options.format == "json" || a_options.format == "csv";
+	}
+}
+
+int main(int a_argc, char** a_argv)
+{
+	Options options;
+	if (!ParseOptions(a_argc, a_argv, options)) {
+		PrintUsage();
+		return 1;
+	}
+
+	std::string report;
+	bool passed = true;
+	if (options.rotation) {
+		const RotationMath::SelfCheckResult check = RotationMath::RunSelfCheck();
+		passed = check.maxApproxError <= ROTATION_TOLERANCE;
+		report = WriteRotation(check, options.format);
+	} else {
+		const double overhead = MeasureTimerOverhead();
+
+		std::vector<Result> results;
+		for (bool dual : { false, true }) {
+			for (InputKind input : { InputKind::Idle, InputKind::Heavy }) {
+				for (int hz : { 30, 60, 144, 240 }) {
+					results.push_back(RunScenario({ dual, input, hz }, options, overhead));
+				}
+			}
+		}
+
+		if (options.format == "json") {
+			report = WriteJson(results, options, overhead);
+		} else if (options.format == "csv") {
+			report = WriteCsv(results);
+		} else {
+			report = WriteTable(results, options, overhead);
+		}
+	}
+
+	if (options.out.empty()) {
+		std::cout << report;
+	} else {
+		std::ofstream file(options.out, std::ios::binary);
+		if (!file) {
+			std::fprintf(stderr, "FPInertiaBench: cannot write %s\n", options.out.c_str());
+			return 1;
+		}
+		file << report;
+	}
+	if (!passed) {
+		std::fprintf(stderr, "FPInertiaBench: rotation path error out of tolerance\n");
+		return 1;
+	}
+	return 0;
+}
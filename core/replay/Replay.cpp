@@ -0,0 +1,701 @@
+// FPInertiaReplay - replays recorded input traces (.fpit) through the core and diffs the deferred
+// offsets against golden outputs
+//
+// Every trace is replayed once per preset, all trace x preset jobs spread across every core.
+//   recorded preset  - the settings and weapon profiles captured in the trace (always run)
+//   preset files     - "key = value" overrides applied on top of every captured profile/settings
+//                      record (see PrintUsage for the keys), one file per preset
+//
+// Golden outputs are <trace>.<preset>.golden next to the trace (or in --golden <dir>). Without one,
+// the recorded preset is compared with the offsets the game produced while recording; other
+// presets report "no golden". --bless writes the current outputs as the new goldens.
+//
+// Usage: FPInertiaReplay [options] <trace-or-dir>...
+
+#include "InputTrace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	using namespace Inertia;
+	namespace fs = std::filesystem;
+
+	constexpr std::uint32_t GOLDEN_MAGIC = 0x47495046;  // "FPIG"
+	constexpr std::uint16_t GOLDEN_VERSION = 1;
+	constexpr const char* GOLDEN_EXTENSION = ".golden";
+	constexpr const char* PRESET_EXTENSION = ".preset";
+	constexpr const char* RECORDED_PRESET = "recorded";
+
+	struct Options
+	{
+		std::vector<fs::path> traces;
+		std::vector<fs::path> presetFiles;
+		fs::path goldenDir;          // Empty = next to each trace
+		bool bless{ false };
+		bool verbose{ false };
+		int jobs{ 0 };               // 0 = hardware concurrency
+		float posTolerance{ 1e-4f };  // Game units
+		float rotTolerance{ 1e-5f };  // Radians
+	};
+
+	// === PRESETS ===
+
+	// A named set of overrides applied to every settings/profile record of a trace
+	struct Preset
+	{
+		std::string name;
+		std::vector<std::function<void(Core::CoreSettings&)>> settingsEdits;
+		std::vector<std::function<void(CompiledWeaponProfile&)>> profileEdits;
+	};
+
+	struct ProfileFloat
+	{
+		const char* name;
+		float CompiledWeaponProfile::*value;
+	};
+
+	struct ProfileBool
+	{
+		const char* name;
+		bool CompiledWeaponProfile::*value;
+	};
+
+	struct SettingsFloat
+	{
+		const char* name;
+		float Core::CoreSettings::*value;
+	};
+
+	struct SettingsBool
+	{
+		const char* name;
+		bool Core::CoreSettings::*value;
+	};
+
+	// CompiledWeaponProfile scalars (already in the profile's units: mass folded in, radians)
+	constexpr ProfileFloat PROFILE_FLOATS[] = {
+		{ "cameraStiffness", &CompiledWeaponProfile::cameraStiffness },
+		{ "cameraDamping", &CompiledWeaponProfile::cameraDamping },
+		{ "cameraMaxOffset", &CompiledWeaponProfile::cameraMaxOffset },
+		{ "cameraMaxRotation", &CompiledWeaponProfile::cameraMaxRotation },
+		{ "cameraTargetMaxOffset", &CompiledWeaponProfile::cameraTargetMaxOffset },
+		{ "cameraTargetMaxRotation", &CompiledWeaponProfile::cameraTargetMaxRotation },
+		{ "cameraPitchPosScale", &CompiledWeaponProfile::cameraPitchPosScale },
+		{ "cameraPitchRotScale", &CompiledWeaponProfile::cameraPitchRotScale },
+		{ "cameraRollRotScale", &CompiledWeaponProfile::cameraRollRotScale },
+		{ "cameraAirMult", &CompiledWeaponProfile::cameraAirMult },
+		{ "movementStiffness", &CompiledWeaponProfile::movementStiffness },
+		{ "movementDamping", &CompiledWeaponProfile::movementDamping },
+		{ "movementMaxOffset", &CompiledWeaponProfile::movementMaxOffset },
+		{ "movementMaxRotation", &CompiledWeaponProfile::movementMaxRotation },
+		{ "movementLeftMult", &CompiledWeaponProfile::movementLeftMult },
+		{ "movementRightMult", &CompiledWeaponProfile::movementRightMult },
+		{ "movementForwardMult", &CompiledWeaponProfile::movementForwardMult },
+		{ "movementBackwardMult", &CompiledWeaponProfile::movementBackwardMult },
+		{ "sprintBlendTime", &CompiledWeaponProfile::sprintBlendTime },
+		{ "sprintStiffness", &CompiledWeaponProfile::sprintStiffness },
+		{ "sprintDamping", &CompiledWeaponProfile::sprintDamping },
+		{ "jumpStiffness", &CompiledWeaponProfile::jumpStiffness },
+		{ "jumpDamping", &CompiledWeaponProfile::jumpDamping },
+		{ "landStiffness", &CompiledWeaponProfile::landStiffness },
+		{ "landDamping", &CompiledWeaponProfile::landDamping },
+		{ "landImpulseY", &CompiledWeaponProfile::landImpulseY },
+		{ "landImpulseZ", &CompiledWeaponProfile::landImpulseZ },
+		{ "landRotImpulse", &CompiledWeaponProfile::landRotImpulse },
+		{ "airTimeImpulseScale", &CompiledWeaponProfile::airTimeImpulseScale },
+		{ "simultaneousThreshold", &CompiledWeaponProfile::simultaneousThreshold },
+		{ "simultaneousCameraMult", &CompiledWeaponProfile::simultaneousCameraMult },
+		{ "simultaneousMovementMult", &CompiledWeaponProfile::simultaneousMovementMult },
+	};
+
+	constexpr ProfileBool PROFILE_BOOLS[] = {
+		{ "movementEnabled", &CompiledWeaponProfile::movementEnabled },
+		{ "sprintEnabled", &CompiledWeaponProfile::sprintEnabled },
+		{ "jumpEnabled", &CompiledWeaponProfile::jumpEnabled },
+	};
+
+	constexpr SettingsFloat SETTINGS_FLOATS[] = {
+		{ "globalIntensity", &Core::CoreSettings::globalIntensity },
+		{ "smoothingFactor", &Core::CoreSettings::smoothingFactor },
+		{ "settleDelay", &Core::CoreSettings::settleDelay },
+		{ "settleSpeed", &Core::CoreSettings::settleSpeed },
+		{ "settleDampingMult", &Core::CoreSettings::settleDampingMult },
+		{ "movementInertiaStrength", &Core::CoreSettings::movementInertiaStrength },
+		{ "movementInertiaThreshold", &Core::CoreSettings::movementInertiaThreshold },
+		{ "actionBlendSpeed", &Core::CoreSettings::actionBlendSpeed },
+		{ "actionMinIntensity", &Core::CoreSettings::actionMinIntensity },
+	};
+
+	constexpr SettingsBool SETTINGS_BOOLS[] = {
+		{ "movementInertiaEnabled", &Core::CoreSettings::movementInertiaEnabled },
+		{ "forwardBackInertia", &Core::CoreSettings::forwardBackInertia },
+	};
+
+	// Integrator keys match the [Integrator] INI names, indexed by SpringCategory
+	constexpr const char* INTEGRATOR_KEYS[] = { "cameraIntegrator", "movementIntegrator", "sprintIntegrator", "jumpIntegrator" };
+
+	std::string Trim(const std::string& a_text)
+	{
+		const auto first = a_text.find_first_not_of(" \t\r");
+		if (first == std::string::npos) {
+			return {};
+		}
+		const auto last = a_text.find_last_not_of(" \t\r");
+		return a_text.substr(first, last - first + 1);
+	}
+
+	bool ParseBool(const std::string& a_value, bool& a_result)
+	{
+		if (a_value == "1" || a_value == "true") {
+			a_result = true;
+			return true;
+		}
+		if (a_value == "0" || a_value == "false") {
+			a_result = false;
+			return true;
+		}
+		return false;
+	}
+
+	bool ParseFloat(const std::string& a_value, float& a_result)
+	{
+		char* end = nullptr;
+		a_result = std::strtof(a_value.c_str(), &end);
+		return end && end != a_value.c_str() && *end == '\0';
+	}
+
+	bool ParseInt(const std::string& a_value, int& a_result)
+	{
+		char* end = nullptr;
+		a_result = static_cast<int>(std::strtol(a_value.c_str(), &end, 10));
+		return end && end != a_value.c_str() && *end == '\0';
+	}
+
+	// One "key = value" line into a_preset; false with a_error set if the key or value is invalid
+	bool ParsePresetLine(const std::string& a_key, const std::string& a_value, Preset& a_preset, std::string& a_error)
+	{
+		for (const auto& field : PROFILE_FLOATS) {
+			if (a_key == field.name) {
+				float value;
+				if (!ParseFloat(a_value, value)) break;
+				a_preset.profileEdits.push_back([member = field.value, value](CompiledWeaponProfile& a_profile) { a_profile.*member = value; });
+				return true;
+			}
+		}
+		for (const auto& field : PROFILE_BOOLS) {
+			if (a_key == field.name) {
+				bool value;
+				if (!ParseBool(a_value, value)) break;
+				a_preset.profileEdits.push_back([member = field.value, value](CompiledWeaponProfile& a_profile) { a_profile.*member = value; });
+				return true;
+			}
+		}
+		for (const auto& field : SETTINGS_FLOATS) {
+			if (a_key == field.name) {
+				float value;
+				if (!ParseFloat(a_value, value)) break;
+				a_preset.settingsEdits.push_back([member = field.value, value](Core::CoreSettings& a_settings) { a_settings.*member = value; });
+				return true;
+			}
+		}
+		for (const auto& field : SETTINGS_BOOLS) {
+			if (a_key == field.name) {
+				bool value;
+				if (!ParseBool(a_value, value)) break;
+				a_preset.settingsEdits.push_back([member = field.value, value](Core::CoreSettings& a_settings) { a_settings.*member = value; });
+				return true;
+			}
+		}
+		for (std::size_t i = 0; i < std::size(INTEGRATOR_KEYS); ++i) {
+			int value;
+			if (a_key == INTEGRATOR_KEYS[i] && ParseInt(a_value, value) &&
+				value >= 0 && value < static_cast<int>(SpringIntegrator::kTotal)) {
+				a_preset.settingsEdits.push_back([i, value](Core::CoreSettings& a_settings) {
+					a_settings.integrators[i] = static_cast<SpringIntegrator>(value);
+				});
+				return true;
+			}
+		}
+		for (int i = 0; i < static_cast<int>(Stance::COUNT); ++i) {
+			float value;
+			if (a_key == "stanceMultiplier" + std::to_string(i) && ParseFloat(a_value, value)) {
+				a_preset.profileEdits.push_back([i, value](CompiledWeaponProfile& a_profile) { a_profile.stances[static_cast<std::size_t>(i)].multiplier = value; });
+				return true;
+			}
+		}
+		if (a_key == "fixedTimestep") {
+			bool value;
+			if (ParseBool(a_value, value)) {
+				a_preset.settingsEdits.push_back([value](Core::CoreSettings& a_settings) { a_settings.timestep.fixed = value; });
+				return true;
+			}
+		} else if (a_key == "physicsRateHz" || a_key == "maxPhysicsSteps") {
+			int value;
+			if (ParseInt(a_value, value) && value > 0) {
+				const bool rate = a_key == "physicsRateHz";
+				a_preset.settingsEdits.push_back([rate, value](Core::CoreSettings& a_settings) {
+					(rate ? a_settings.timestep.rateHz : a_settings.timestep.maxSteps) = value;
+				});
+				return true;
+			}
+		}
+
+		a_error = "bad key or value '" + a_key + " = " + a_value + "'";
+		return false;
+	}
+
+	bool LoadPreset(const fs::path& a_path, Preset& a_preset, std::string& a_error)
+	{
+		std::ifstream file(a_path);
+		if (!file) {
+			a_error = "cannot open file";
+			return false;
+		}
+
+		a_preset.name = a_path.stem().string();
+		std::string line;
+		int lineNumber = 0;
+		while (std::getline(file, line)) {
+			lineNumber++;
+			line = Trim(line.substr(0, line.find('#')));
+			if (line.empty()) {
+				continue;
+			}
+			const auto equals = line.find('=');
+			if (equals == std::string::npos) {
+				a_error = "line " + std::to_string(lineNumber) + ": expected key = value";
+				return false;
+			}
+			std::string error;
+			if (!ParsePresetLine(Trim(line.substr(0, equals)), Trim(line.substr(equals + 1)), a_preset, error)) {
+				a_error = "line " + std::to_string(lineNumber) + ": " + error;
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// === GOLDEN OUTPUTS ===
+
+	struct GoldenHeader
+	{
+		std::uint32_t magic{ GOLDEN_MAGIC };
+		std::uint16_t version{ GOLDEN_VERSION };
+		std::uint16_t frameSize{ 0 };
+		std::uint32_t frameCount{ 0 };
+	};
+
+	// Deferred offsets of one frame (flags: Trace::kHasOffsets / kDualClavicle)
+	struct GoldenFrame
+	{
+		std::uint16_t flags{ 0 };
+		std::uint16_t reserved{ 0 };
+		float interpolationAlpha{ 1.0f };
+		Trace::Offsets combined;
+		Trace::Offsets previous;
+		Trace::Offsets combinedLeft;
+		Trace::Offsets previousLeft;
+	};
+
+	GoldenFrame ToGolden(const Core::FrameOutput& a_output)
+	{
+		Trace::FrameRecord record;
+		Trace::StoreOutput(record, a_output);
+
+		GoldenFrame golden;
+		if (a_output.hasOffsets) {
+			golden.flags = Trace::kHasOffsets;
+			if (a_output.useDualClaviclePivot) {
+				golden.flags |= Trace::kDualClavicle;
+			}
+			golden.interpolationAlpha = record.interpolationAlpha;
+			golden.combined = record.combined;
+			golden.previous = record.previous;
+			golden.combinedLeft = record.combinedLeft;
+			golden.previousLeft = record.previousLeft;
+		}
+		return golden;
+	}
+
+	bool ReadGolden(const fs::path& a_path, std::vector<GoldenFrame>& a_frames, std::string& a_error)
+	{
+		std::ifstream file(a_path, std::ios::binary);
+		GoldenHeader header;
+		if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+			header.magic != GOLDEN_MAGIC || header.version != GOLDEN_VERSION || header.frameSize != sizeof(GoldenFrame)) {
+			a_error = "unreadable or incompatible golden file";
+			return false;
+		}
+		a_frames.resize(header.frameCount);
+		if (!file.read(reinterpret_cast<char*>(a_frames.data()), static_cast<std::streamsize>(a_frames.size() * sizeof(GoldenFrame)))) {
+			a_error = "golden file is truncated";
+			return false;
+		}
+		return true;
+	}
+
+	bool WriteGolden(const fs::path& a_path, const std::vector<GoldenFrame>& a_frames)
+	{
+		std::ofstream file(a_path, std::ios::binary);
+		GoldenHeader header;
+		header.frameSize = static_cast<std::uint16_t>(sizeof(GoldenFrame));
+		header.frameCount = static_cast<std::uint32_t>(a_frames.size());
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(reinterpret_cast<const char*>(a_frames.data()), static_cast<std::streamsize>(a_frames.size() * sizeof(GoldenFrame)));
+		return static_cast<bool>(file);
+	}
+
+	// === JOBS ===
+
+	struct LoadedTrace
+	{
+		fs::path path;
+		Trace::TraceData data;
+		std::string error;
+	};
+
+	enum class Status
+	{
+		kPass,
+		kFail,
+		kNoGolden,
+		kBlessed,
+		kError
+	};
+
+	struct JobResult
+	{
+		Status status{ Status::kPass };
+		std::size_t frames{ 0 };
+		std::size_t mismatches{ 0 };
+		std::size_t firstMismatch{ 0 };
+		float maxPosError{ 0.0f };
+		float maxRotError{ 0.0f };
+		bool goldenFromTrace{ false };
+		std::string message;
+	};
+
+	fs::path GoldenPath(const Options& a_options, const fs::path& a_trace, const std::string& a_preset)
+	{
+		const fs::path dir = a_options.goldenDir.empty() ? a_trace.parent_path() : a_options.goldenDir;
+		return dir / (a_trace.stem().string() + "." + a_preset + GOLDEN_EXTENSION);
+	}
+
+	float MaxDiff(const float (&a_lhs)[3], const float (&a_rhs)[3])
+	{
+		float diff = 0.0f;
+		for (int i = 0; i < 3; ++i) {
+			diff = std::max(diff, std::abs(a_lhs[i] - a_rhs[i]));
+		}
+		return diff;
+	}
+
+	// Replay one trace with one preset and diff it against its golden
+	JobResult RunJob(const LoadedTrace& a_trace, const Preset* a_preset, const Options& a_options)
+	{
+		JobResult result;
+		const Trace::TraceData& trace = a_trace.data;
+		const std::string presetName = a_preset ? a_preset->name : RECORDED_PRESET;
+
+		// Apply the preset to every settings/profile record once
+		std::vector<Core::CoreSettings> settings = trace.settings;
+		std::vector<CompiledWeaponProfile> profiles;
+		profiles.reserve(trace.profiles.size());
+		for (const auto& record : trace.profiles) {
+			profiles.push_back(record.profile);
+		}
+		if (a_preset) {
+			for (auto& entry : settings) {
+				for (const auto& edit : a_preset->settingsEdits) edit(entry);
+			}
+			for (auto& entry : profiles) {
+				for (const auto& edit : a_preset->profileEdits) edit(entry);
+				Core::CompileStability(entry, entry.stabilitySettleDampingMult);
+			}
+		}
+
+		// Replay
+		Core::FrameState state = trace.hasState ? trace.initialState : Core::FrameState{};
+		std::vector<GoldenFrame> produced;
+		produced.reserve(trace.frames.size());
+		Core::FrameOutput output;
+		for (std::size_t i = 0; i < trace.frames.size(); ++i) {
+			const auto& frame = trace.frames[i];
+			if (!Trace::ReplayFrame(state, frame.record, settings[frame.settingsIndex], profiles[frame.profileIndex], output) && !a_preset) {
+				result.status = Status::kFail;
+				result.message = "camera priming diverged from the recording at frame " + std::to_string(i);
+				return result;
+			}
+			produced.push_back(ToGolden(output));
+		}
+		result.frames = produced.size();
+
+		const fs::path goldenPath = GoldenPath(a_options, a_trace.path, presetName);
+		if (a_options.bless) {
+			if (!WriteGolden(goldenPath, produced)) {
+				result.status = Status::kError;
+				result.message = "cannot write " + goldenPath.string();
+				return result;
+			}
+			result.status = Status::kBlessed;
+			return result;
+		}
+
+		// Expected: the golden file, else (recorded preset only) what the game produced
+		std::vector<GoldenFrame> expected;
+		if (fs::exists(goldenPath)) {
+			if (!ReadGolden(goldenPath, expected, result.message)) {
+				result.status = Status::kError;
+				return result;
+			}
+		} else if (!a_preset) {
+			result.goldenFromTrace = true;
+			for (const auto& frame : trace.frames) {
+				expected.push_back(ToGolden(Trace::ToFrameOutput(frame.record)));
+			}
+		} else {
+			result.status = Status::kNoGolden;
+			return result;
+		}
+
+		if (expected.size() != produced.size()) {
+			result.status = Status::kFail;
+			result.message = "golden has " + std::to_string(expected.size()) + " frames, replay produced " + std::to_string(produced.size());
+			return result;
+		}
+
+		for (std::size_t i = 0; i < produced.size(); ++i) {
+			const GoldenFrame& lhs = produced[i];
+			const GoldenFrame& rhs = expected[i];
+			bool mismatch = lhs.flags != rhs.flags;
+			if (!mismatch && (lhs.flags & Trace::kHasOffsets)) {
+				const float posError = std::max({ MaxDiff(lhs.combined.position, rhs.combined.position),
+					MaxDiff(lhs.previous.position, rhs.previous.position),
+					MaxDiff(lhs.combinedLeft.position, rhs.combinedLeft.position),
+					MaxDiff(lhs.previousLeft.position, rhs.previousLeft.position) });
+				const float rotError = std::max({ MaxDiff(lhs.combined.rotation, rhs.combined.rotation),
+					MaxDiff(lhs.previous.rotation, rhs.previous.rotation),
+					MaxDiff(lhs.combinedLeft.rotation, rhs.combinedLeft.rotation),
+					MaxDiff(lhs.previousLeft.rotation, rhs.previousLeft.rotation) });
+				result.maxPosError = std::max(result.maxPosError, posError);
+				result.maxRotError = std::max(result.maxRotError, rotError);
+				mismatch = posError > a_options.posTolerance || rotError > a_options.rotTolerance ||
+					std::abs(lhs.interpolationAlpha - rhs.interpolationAlpha) > 1e-6f;
+			}
+			if (mismatch) {
+				if (result.mismatches == 0) {
+					result.firstMismatch = i;
+				}
+				result.mismatches++;
+			}
+		}
+
+		if (result.mismatches > 0) {
+			result.status = Status::kFail;
+			result.message = std::to_string(result.mismatches) + " frames out of tolerance, first at frame " + std::to_string(result.firstMismatch);
+		}
+		return result;
+	}
+
+	// Run a_fn(0..a_count-1) on a_threads workers
+	void ParallelFor(std::size_t a_count, int a_threads, const std::function<void(std::size_t)>& a_fn)
+	{
+		std::atomic<std::size_t> next{ 0 };
+		auto worker = [&] {
+			for (std::size_t i = next.fetch_add(1); i < a_count; i = next.fetch_add(1)) {
+				a_fn(i);
+			}
+		};
+
+		const int threads = static_cast<int>(std::min<std::size_t>(static_cast<std::size_t>(std::max(1, a_threads)), a_count));
+		std::vector<std::thread> pool;
+		for (int i = 1; i < threads; ++i) {
+			pool.emplace_back(worker);
+		}
+		worker();
+		for (auto& thread : pool) {
+			thread.join();
+		}
+	}
+
+	// === COMMAND LINE ===
+
+	void PrintUsage()
+	{
+		std::printf(
+			"Usage: FPInertiaReplay [options] <trace-or-dir>...\n"
+			"  Replays .fpit traces (directories are searched recursively) and diffs the deferred\n"
+			"  offsets against <trace>.<preset>.golden.\n"
+			"\n"
+			"  --preset <file-or-dir>  Also replay with this preset (directories: every *.preset file)\n"
+			"  --golden <dir>          Read/write golden files here instead of next to each trace\n"
+			"  --bless                 Write the current outputs as the golden files\n"
+			"  --pos-tol <units>       Position tolerance (default 1e-4)\n"
+			"  --rot-tol <radians>     Rotation tolerance (default 1e-5)\n"
+			"  --jobs <n>              Worker threads (default: all cores)\n"
+			"  --verbose               Print passing jobs too\n"
+			"\n"
+			"Preset files hold 'key = value' lines ('#' starts a comment) applied on top of every\n"
+			"settings and weapon profile record in the trace. Keys:\n"
+			"  profile (compiled units):");
+		for (const auto& field : PROFILE_FLOATS) std::printf(" %s", field.name);
+		for (const auto& field : PROFILE_BOOLS) std::printf(" %s", field.name);
+		std::printf(" stanceMultiplier0..3\n  settings:");
+		for (const auto& field : SETTINGS_FLOATS) std::printf(" %s", field.name);
+		for (const auto& field : SETTINGS_BOOLS) std::printf(" %s", field.name);
+		for (const auto* key : INTEGRATOR_KEYS) std::printf(" %s", key);
+		std::printf(" fixedTimestep physicsRateHz maxPhysicsSteps\n");
+	}
+
+	void AddPaths(const fs::path& a_path, const char* a_extension, std::vector<fs::path>& a_out)
+	{
+		if (!fs::is_directory(a_path)) {
+			a_out.push_back(a_path);
+			return;
+		}
+		std::vector<fs::path> found;
+		for (const auto& entry : fs::recursive_directory_iterator(a_path)) {
+			if (entry.is_regular_file() && entry.path().extension() == a_extension) {
+				found.push_back(entry.path());
+			}
+		}
+		std::sort(found.begin(), found.end());
+		a_out.insert(a_out.end(), found.begin(), found.end());
+	}
+
+	bool ParseOptions(int a_argc, char** a_argv, Options& a_options)
+	{
+		for (int i = 1; i < a_argc; ++i) {
+			const std::string arg = a_argv[i];
+			const bool hasValue = i + 1 < a_argc;
+			if (arg == "--preset" && hasValue) {
+				AddPaths(a_argv[++i], PRESET_EXTENSION, a_options.presetFiles);
+			} else if (arg == "--golden" && hasValue) {
+				a_options.goldenDir = a_argv[++i];
+			} else if (arg == "--bless") {
+				a_options.bless = true;
+			} else if (arg == "--pos-tol" && hasValue) {
+				a_options.posTolerance = std::strtof(a_argv[++i], nullptr);
+			} else if (arg == "--rot-tol" && hasValue) {
+				a_options.rotTolerance = std::strtof(a_argv[++i], nullptr);
+			} else if (arg == "--jobs" && hasValue) {
+				a_options.jobs = std::atoi(a_argv[++i]);
+			} else if (arg == "--verbose") {
+				a_options.verbose = true;
+			} else if (!arg.empty() && arg[0] != '-') {
+				AddPaths(arg, Trace::kExtension, a_options.traces);
+			} else {
+				return false;
+			}
+		}
+		return !a_options.traces.empty();
+	}
+
+	const char* StatusName(Status a_status)
+	{
+		switch (a_status) {
+		case Status::kPass:
+			return "PASS";
+		case Status::kFail:
+			return "FAIL";
+		case Status::kNoGolden:
+			return "NONE";
+		case Status::kBlessed:
+			return "BLESS";
+		default:
+			return "ERROR";
+		}
+	}
+}
+
+int main(int a_argc, char** a_argv)
+{
+	Options options;
+	if (!ParseOptions(a_argc, a_argv, options)) {
+		PrintUsage();
+		return 2;
+	}
+	if (options.jobs <= 0) {
+		options.jobs = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+	}
+	if (!options.goldenDir.empty()) {
+		std::error_code ec;
+		fs::create_directories(options.goldenDir, ec);
+	}
+
+	std::vector<Preset> presets(options.presetFiles.size());
+	for (std::size_t i = 0; i < presets.size(); ++i) {
+		std::string error;
+		if (!LoadPreset(options.presetFiles[i], presets[i], error)) {
+			std::fprintf(stderr, "%s: %s\n", options.presetFiles[i].string().c_str(), error.c_str());
+			return 2;
+		}
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+
+	// Load every trace once, in parallel
+	std::vector<LoadedTrace> traces(options.traces.size());
+	ParallelFor(traces.size(), options.jobs, [&](std::size_t a_index) {
+		traces[a_index].path = options.traces[a_index];
+		Trace::ReadTrace(traces[a_index].path, traces[a_index].data, traces[a_index].error);
+	});
+
+	// Every trace x (recorded + each preset)
+	const std::size_t presetCount = presets.size() + 1;
+	std::vector<JobResult> results(traces.size() * presetCount);
+	ParallelFor(results.size(), options.jobs, [&](std::size_t a_index) {
+		const LoadedTrace& trace = traces[a_index / presetCount];
+		const std::size_t preset = a_index % presetCount;
+		if (!trace.error.empty()) {
+			results[a_index].status = Status::kError;
+			results[a_index].message = trace.error;
+			return;
+		}
+		results[a_index] = RunJob(trace, preset == 0 ? nullptr : &presets[preset - 1], options);
+	});
+
+	const double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	// Report in trace/preset order
+	std::size_t counts[5]{};
+	std::size_t totalFrames = 0;
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const JobResult& result = results[i];
+		const LoadedTrace& trace = traces[i / presetCount];
+		const std::size_t preset = i % presetCount;
+		counts[static_cast<int>(result.status)]++;
+		totalFrames += result.frames;
+
+		if (result.status == Status::kPass && !options.verbose) {
+			continue;
+		}
+		std::printf("%-5s %s [%s] frames=%zu maxPos=%.2e maxRot=%.2e%s%s%s%s\n",
+			StatusName(result.status), trace.path.string().c_str(), preset == 0 ? RECORDED_PRESET : presets[preset - 1].name.c_str(),
+			result.frames, result.maxPosError, result.maxRotError,
+			result.goldenFromTrace ? " (vs recorded offsets)" : "",
+			trace.data.truncated ? " (trace truncated)" : "",
+			result.message.empty() ? "" : " - ", result.message.c_str());
+	}
+
+	std::printf("%zu traces x %zu presets: %zu passed, %zu failed, %zu without golden, %zu blessed, %zu errors "
+				"(%zu frames in %.0f ms on %d threads)\n",
+		traces.size(), presetCount, counts[static_cast<int>(Status::kPass)], counts[static_cast<int>(Status::kFail)],
+		counts[static_cast<int>(Status::kNoGolden)], counts[static_cast<int>(Status::kBlessed)], counts[static_cast<int>(Status::kError)],
+		totalFrames, elapsedMs, options.jobs);
+
+	return (counts[static_cast<int>(Status::kFail)] + counts[static_cast<int>(Status::kError)]) > 0 ? 1 : 0;
+}
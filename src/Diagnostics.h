@@ -0,0 +1,40 @@
+#pragma once
+
+// Compile-time log levels for the per-frame paths
+//
+// Trace level is the per-frame diagnostics: periodic spring dumps, blend progress and the offsets
+// applied every frame. It only exists in the diagnostics build (CMake option FPINERTIA_DIAGNOSTICS,
+// "diagnostics" preset); a release build compiles it out entirely, so Update and the
+// UpdateFirstPerson hook carry no branch, counter or format string for it.
+// Debug level (state changes, one-off and once-per-second messages) is in every build and is
+// switched at runtime by bDebugLogging, which also switches trace level in a diagnostics build.
+namespace Diagnostics
+{
+	enum class Level
+	{
+		kTrace,
+		kDebug
+	};
+
+#ifdef FPINERTIA_DIAGNOSTICS
+	inline constexpr Level kCompiledLevel = Level::kTrace;
+#else
+	inline constexpr Level kCompiledLevel = Level::kDebug;
+#endif
+
+	// True when messages of a_level are compiled into this build
+	constexpr bool IsCompiled(Level a_level) { return a_level >= kCompiledLevel; }
+
+	// For trace-level blocks that keep their own counters: if constexpr (Diagnostics::kTrace) { ... }
+	inline constexpr bool kTrace = IsCompiled(Level::kTrace);
+}
+
+// Trace-level message; a_condition and the arguments are only compiled into the diagnostics build
+#define FPI_LOG_TRACE(a_condition, ...)      \
+	do {                                      \
+		if constexpr (::Diagnostics::kTrace) { \
+			if (a_condition) {                 \
+				logger::info(__VA_ARGS__);     \
+			}                                  \
+		}                                      \
+	} while (false)
@@ -1,5 +1,13 @@
 #include "Inertia.h"
 #include "Settings.h"
+#include "SettingsWatcher.h"
+#include "FrameClock.h"
+#include "InertiaFrame.h"
+#include "TraceRecorder.h"
+#include "TelemetryCapture.h"
+#include "Diagnostics.h"
+#include "PerfStats.h"
+#include "TraceZones.h"
 
 namespace Inertia
 {
@@ -88,51 +96,33 @@ namespace Inertia
 			hasLoggedSkeleton = true;
 		}
 		
-		// Clamp a vector component-wise
-		RE::NiPoint3 ClampVector(const RE::NiPoint3& a_vec, float a_max)
+		// Global settings the physics core reads, copied once per frame
+		Core::CoreSettings MakeCoreSettings(const Settings* a_settings)
 		{
-			return {
-				std::clamp(a_vec.x, -a_max, a_max),
-				std::clamp(a_vec.y, -a_max, a_max),
-				std::clamp(a_vec.z, -a_max, a_max)
-			};
-		}
-		
-		// Linear interpolation for vectors
-		RE::NiPoint3 LerpVector(const RE::NiPoint3& a_from, const RE::NiPoint3& a_to, float a_t)
-		{
-			return {
-				a_from.x + (a_to.x - a_from.x) * a_t,
-				a_from.y + (a_to.y - a_from.y) * a_t,
-				a_from.z + (a_to.z - a_from.z) * a_t
-			};
-		}
-		
-		// Create rotation matrix from euler angles (XYZ order)
-		RE::NiMatrix3 EulerToMatrix(const RE::NiPoint3& a_euler)
-		{
-			float cx = std::cos(a_euler.x);
-			float sx = std::sin(a_euler.x);
-			float cy = std::cos(a_euler.y);
-			float sy = std::sin(a_euler.y);
-			float cz = std::cos(a_euler.z);
-			float sz = std::sin(a_euler.z);
-			
-			RE::NiMatrix3 result;
-			result.entry[0][0] = cy * cz;
-			result.entry[0][1] = -cy * sz;
-			result.entry[0][2] = sy;
-			result.entry[1][0] = sx * sy * cz + cx * sz;
-			result.entry[1][1] = -sx * sy * sz + cx * cz;
-			result.entry[1][2] = -sx * cy;
-			result.entry[2][0] = -cx * sy * cz + sx * sz;
-			result.entry[2][1] = cx * sy * sz + sx * cz;
-			result.entry[2][2] = cx * cy;
-			
-			return result;
+			Core::CoreSettings core;
+			core.globalIntensity = a_settings->globalIntensity;
+			core.smoothingFactor = a_settings->smoothingFactor;
+			core.settleDelay = a_settings->settleDelay;
+			core.settleSpeed = a_settings->settleSpeed;
+			core.settleDampingMult = a_settings->settleDampingMult;
+			core.enablePosition = a_settings->enablePosition;
+			core.enableRotation = a_settings->enableRotation;
+			core.movementInertiaEnabled = a_settings->movementInertiaEnabled;
+			core.movementInertiaStrength = a_settings->movementInertiaStrength;
+			core.movementInertiaThreshold = a_settings->movementInertiaThreshold;
+			core.forwardBackInertia = a_settings->forwardBackInertia;
+			core.actionBlendSpeed = a_settings->actionBlendSpeed;
+			core.actionMinIntensity = a_settings->actionMinIntensity;
+			core.integrators = {
+				static_cast<SpringIntegrator>(a_settings->cameraIntegrator),
+				static_cast<SpringIntegrator>(a_settings->movementIntegrator),
+				static_cast<SpringIntegrator>(a_settings->sprintIntegrator),
+				static_cast<SpringIntegrator>(a_settings->jumpIntegrator) };
+			core.timestep = { a_settings->fixedTimestep, a_settings->physicsRateHz, a_settings->maxPhysicsSteps };
+			return core;
 		}
 	}
-
+	
 	RE::NiNode* InertiaManager::GetFirstPersonNode()
 	{
 		auto* player = RE::PlayerCharacter::GetSingleton();
@@ -364,6 +354,9 @@ namespace Inertia
 	
 	RE::NiNode* InertiaManager::GetClavicleNode(RE::NiNode* a_fpRoot, Hand a_hand)
 	{
+		FPI_PERF_SCOPE(kClavicleNode);
+		FPI_TRACE_ZONE("Clavicle node lookup");
+		
 		if (!a_fpRoot) {
 			return nullptr;
 		}
@@ -413,6 +406,9 @@ namespace Inertia
 
 	const WeaponInertiaSettings& InertiaManager::GetCurrentWeaponSettings(RE::PlayerCharacter* a_player, Hand a_hand)
 	{
+		FPI_PERF_SCOPE(kWeaponSettings);
+		FPI_TRACE_ZONE("Weapon settings lookup");
+		
 		// Check if equipped weapon has changed by comparing FormID
 		// This avoids expensive EditorID lookups and keyword checks every frame
 		bool isLeftHand = (a_hand == Hand::kLeft);
@@ -434,20 +430,27 @@ namespace Inertia
 		}
 		
 		auto* presets = InertiaPresets::GetSingleton();
+		const PresetSnapshot& snapshot = *presetSnapshot;
 		
-		// Check if presets have changed (user switched preset)
-		uint32_t currentVersion = presets->GetSettingsVersion();
-		
-		// Use cached settings if weapon hasn't changed AND presets haven't changed
+		// Use cached settings if weapon hasn't changed
 		if (cachedWeaponSettings && combinedFormID == cachedWeaponFormID && 
-			cachedSettingsVersion == currentVersion &&
 			(currentWeaponType == WeaponType::Shield) == isShield) {
+			PerfStats::GetSingleton()->CountWeaponLookup(true);
+			// Presets edited or switched - same weapon, so just look it up again in the new snapshot
+			if (cachedSnapshotGeneration != snapshot.generation) {
+				cachedSnapshotGeneration = snapshot.generation;
+				cachedWeaponSettings = isDualWieldMode ?
+					&snapshot.GetWeaponTypeSettings(currentWeaponType) :
+					&snapshot.GetWeaponSettings(currentWeaponEditorID, currentCustomWeaponType, currentWeaponType);
+				CompileWeaponProfile();
+			}
 			return *cachedWeaponSettings;
 		}
 		
-		// Weapon or presets changed - refresh cached settings
+		// Weapon changed - refresh cached settings
+		PerfStats::GetSingleton()->CountWeaponLookup(false);
 		cachedWeaponFormID = combinedFormID;
-		cachedSettingsVersion = currentVersion;
+		cachedSnapshotGeneration = snapshot.generation;
 		
 		// PRIORITY 1: Check for dual wield types first
 		WeaponType dualWieldType = DetectDualWieldType(a_player);
@@ -468,7 +471,9 @@ namespace Inertia
 			}
 			
 			// For dual wield, we don't use specific weapon presets - just the type
-			cachedWeaponSettings = &presets->GetWeaponTypeSettings(dualWieldType);
+			currentCustomWeaponType.clear();
+			cachedWeaponSettings = &snapshot.GetWeaponTypeSettings(dualWieldType);
+			CompileWeaponProfile();
 			return *cachedWeaponSettings;
 		}
 		
@@ -500,7 +505,9 @@ namespace Inertia
 		
 		// Use preset system with keyword support
 		// Priority: specific weapon -> keyword-based type -> standard type
-		cachedWeaponSettings = &presets->GetWeaponSettingsWithKeywords(editorID, weapon, weaponType);
+		currentCustomWeaponType = weapon ? presets->GetBestKeywordMatch(weapon) : std::string{};
+		cachedWeaponSettings = &snapshot.GetWeaponSettings(editorID, currentCustomWeaponType, weaponType);
+		CompileWeaponProfile();
 		
 		// Log weapon type detection
 		auto* settings = Settings::GetSingleton();
@@ -558,731 +565,145 @@ namespace Inertia
 		return false;
 	}
 
-	RE::NiPoint3 InertiaManager::CalculateCameraVelocity(float a_delta)
+	void InertiaManager::RecordTraceFrame(RE::PlayerCharacter* a_player, const Core::FrameInputs& a_inputs,
+		const Core::CoreSettings& a_coreSettings, bool a_weaponDrawn, std::uint16_t a_flags)
 	{
-		auto* camera = RE::PlayerCamera::GetSingleton();
-		if (!camera || a_delta <= 0.0f) {
-			return { 0.0f, 0.0f, 0.0f };
-		}
-		
-		// Get current camera state
-		auto* firstPersonState = camera->currentState.get();
-		if (!firstPersonState) {
-			return { 0.0f, 0.0f, 0.0f };
-		}
-		
-		// Get camera rotation from player angles (more reliable)
-		auto* player = RE::PlayerCharacter::GetSingleton();
-		if (!player) {
-			return { 0.0f, 0.0f, 0.0f };
+		auto* recorder = TraceRecorder::GetSingleton();
+		recorder->RecordSettings(a_coreSettings);
+		
+		if (recorder->NeedsProfile(compiledProfileId)) {
+			Trace::ProfileRecord profile;
+			profile.id = compiledProfileId;
+			profile.weaponType = static_cast<std::int32_t>(currentWeaponType);
+			profile.formID = cachedWeaponFormID;
+			profile.pivotPoint = cachedWeaponSettings ? cachedWeaponSettings->pivotPoint : 0;
+			currentWeaponEditorID.copy(profile.editorID, sizeof(profile.editorID) - 1);
+			profile.profile = compiledProfile;
+			recorder->RecordProfile(profile);
+			
+			// Ring full - don't write frames that reference a profile the trace doesn't have
+			if (recorder->NeedsProfile(compiledProfileId)) {
+				return;
+			}
 		}
 		
-		float currentYaw = player->GetAngleZ();
-		float currentPitch = player->GetAngleX();
-		float currentRoll = 0.0f;  // Roll is typically 0 in Skyrim
+		Trace::FrameRecord record;
+		Trace::StoreInputs(record, a_inputs);
+		record.equipBlendFactor = frame.equipBlendFactor;
+		record.profileId = compiledProfileId;
+		record.flags |= a_flags;
 		
-		// Calculate angular velocity (radians per second)
-		RE::NiPoint3 velocity;
-		
-		// Handle yaw wraparound (0 to 2*PI)
-		float yawDiff = currentYaw - lastCameraYaw;
-		if (yawDiff > PI) {
-			yawDiff -= 2.0f * PI;
-		} else if (yawDiff < -PI) {
-			yawDiff += 2.0f * PI;
+		if (traceResetPending) {
+			record.flags |= Trace::kReset;
+			traceResetPending = false;
 		}
 		
-		velocity.z = yawDiff / a_delta;  // Yaw velocity
-		velocity.x = (currentPitch - lastCameraPitch) / a_delta;  // Pitch velocity
-		velocity.y = (currentRoll - lastCameraRoll) / a_delta;  // Roll velocity
-		
-		// Store current values for next frame
-		lastCameraYaw = currentYaw;
-		lastCameraPitch = currentPitch;
-		lastCameraRoll = currentRoll;
-		
-		// === FRAMERATE INDEPENDENCE FIX ===
-		// Clamp maximum velocity to prevent extreme spikes from frame drops or sudden input
-		constexpr float MAX_ANGULAR_VELOCITY = 25.0f;  // radians/sec - very fast turn
-		velocity.x = std::clamp(velocity.x, -MAX_ANGULAR_VELOCITY, MAX_ANGULAR_VELOCITY);
-		velocity.y = std::clamp(velocity.y, -MAX_ANGULAR_VELOCITY, MAX_ANGULAR_VELOCITY);
-		velocity.z = std::clamp(velocity.z, -MAX_ANGULAR_VELOCITY, MAX_ANGULAR_VELOCITY);
-		
-		// Clamp velocity CHANGE per frame to prevent sudden jumps
-		constexpr float MAX_VELOCITY_CHANGE_PER_SEC = 50.0f;  // radians/sec^2
-		float maxChange = MAX_VELOCITY_CHANGE_PER_SEC * a_delta;
+		// Raw game state behind the inputs above (for reading a trace, not needed to replay it)
+		bool readyStart = false;
+		a_player->GetGraphVariableBool("SBF_ReadyStart", readyStart);
+		if (readyStart) record.flags |= Trace::kReadyStart;
+		if (a_weaponDrawn) record.flags |= Trace::kWeaponDrawn;
+		if (a_player->AsActorState()->GetAttackState() != RE::ATTACK_STATE_ENUM::kNone) record.flags |= Trace::kAttacking;
+		if (a_player->IsCasting(nullptr)) record.flags |= Trace::kCasting;
 		
-		RE::NiPoint3 velocityDelta = {
-			velocity.x - prevCameraVelocity.x,
-			velocity.y - prevCameraVelocity.y,
-			velocity.z - prevCameraVelocity.z
-		};
-		
-		velocityDelta.x = std::clamp(velocityDelta.x, -maxChange, maxChange);
-		velocityDelta.y = std::clamp(velocityDelta.y, -maxChange, maxChange);
-		velocityDelta.z = std::clamp(velocityDelta.z, -maxChange, maxChange);
-		
-		velocity.x = prevCameraVelocity.x + velocityDelta.x;
-		velocity.y = prevCameraVelocity.y + velocityDelta.y;
-		velocity.z = prevCameraVelocity.z + velocityDelta.z;
-		
-		prevCameraVelocity = velocity;
-		
-		return velocity;
-	}
-
-	// Update camera-based spring (responds to camera rotation)
-	void InertiaManager::UpdateSpring(SpringState& a_state, const WeaponInertiaSettings& a_settings,
-		const RE::NiPoint3& a_cameraVelocity, float a_delta, float a_multiplier,
-		bool a_stanceInvertCamera)
-	{
-		auto* settings = Settings::GetSingleton();
-		float intensity = settings->globalIntensity * a_multiplier;
-
-		if (intensity <= 0.0f) {
-			a_state.Reset();
-			return;
+		if (a_flags & Trace::kSpringsStepped) {
+			Trace::StoreOutput(record, deferredOffsets);
 		}
 		
-		// Separate invert factors for pitch (up/down) and yaw (left/right)
-		// XOR with stance-specific override: stance invert flips the base setting
-		bool effectiveInvertPitch = a_settings.invertCameraPitch ^ a_stanceInvertCamera;
-		bool effectiveInvertYaw = a_settings.invertCameraYaw ^ a_stanceInvertCamera;
-		float invertPitch = effectiveInvertPitch ? -1.0f : 1.0f;
-		float invertYaw = effectiveInvertYaw ? -1.0f : 1.0f;
-		
-		// Spring-damper system for CAMERA inertia only
-		float k = a_settings.stiffness;
-		float m = a_settings.mass;
-		
-		// Apply settling - increase damping when camera stops
-		float dampingMultiplier = 1.0f + (settlingFactor * (settings->settleDampingMult - 1.0f));
-		float c = a_settings.damping * dampingMultiplier;
-		
-		// Global pitch multiplier affects ALL pitch effects (position + rotation)
-		float pitchMult = a_settings.cameraPitchMult;
-		
-		// === FRAMERATE INDEPENDENCE: Use sub-stepping for large deltas ===
-		constexpr float MAX_SUBSTEP = 0.016f;  // ~60fps equivalent
-		int numSteps = static_cast<int>(std::ceil(a_delta / MAX_SUBSTEP));
-		numSteps = std::clamp(numSteps, 1, 4);  // Max 4 substeps
-		float stepDelta = a_delta / static_cast<float>(numSteps);
-		
-		// Maximum velocity and position change per substep for stability
-		constexpr float MAX_POS_VELOCITY = 500.0f;   // units/sec
-		constexpr float MAX_ROT_VELOCITY = 50.0f;    // radians/sec
-		
-		for (int step = 0; step < numSteps; ++step) {
-			// Position offset - CAMERA ONLY
-			if (settings->enablePosition) {
-				RE::NiPoint3 targetOffset = {
-					invertYaw * -a_cameraVelocity.z * 2.0f * intensity,  // Yaw -> X offset
-					0.0f,
-					invertPitch * a_cameraVelocity.x * 1.5f * intensity * pitchMult  // Pitch -> Z offset (global pitch mult)
-				};
-				
-				targetOffset = ClampVector(targetOffset, a_settings.maxOffset * 2.0f);
-				
-				RE::NiPoint3 springForce = {
-					-k * a_state.positionOffset.x - c * a_state.positionVelocity.x + targetOffset.x * k * 0.5f,
-					-k * a_state.positionOffset.y - c * a_state.positionVelocity.y,
-					-k * a_state.positionOffset.z - c * a_state.positionVelocity.z + targetOffset.z * k * 0.5f
-				};
-				
-				RE::NiPoint3 acceleration = { springForce.x / m, springForce.y / m, springForce.z / m };
-				
-				a_state.positionVelocity.x += acceleration.x * stepDelta;
-				a_state.positionVelocity.y += acceleration.y * stepDelta;
-				a_state.positionVelocity.z += acceleration.z * stepDelta;
-				
-				// Clamp velocity for stability
-				a_state.positionVelocity = ClampVector(a_state.positionVelocity, MAX_POS_VELOCITY);
-				
-				a_state.positionOffset.x += a_state.positionVelocity.x * stepDelta;
-				a_state.positionOffset.y += a_state.positionVelocity.y * stepDelta;
-				a_state.positionOffset.z += a_state.positionVelocity.z * stepDelta;
-				
-				a_state.positionOffset = ClampVector(a_state.positionOffset, a_settings.maxOffset);
-			}
-			
-			// Rotation offset - CAMERA ONLY
-			if (settings->enableRotation) {
-				float maxRotRad = a_settings.maxRotation * DEG_TO_RAD;
-				
-				RE::NiPoint3 targetRotation = {
-					invertPitch * a_cameraVelocity.x * 0.08f * intensity * a_settings.pitchMultiplier * pitchMult,  // Pitch rotation (both mults)
-					invertYaw * -a_cameraVelocity.z * 0.06f * intensity,  // Yaw rotation
-					invertYaw * -a_cameraVelocity.z * 0.04f * intensity * a_settings.rollMultiplier  // Roll (driven by yaw)
-				};
-				
-				targetRotation = ClampVector(targetRotation, maxRotRad * 2.0f);
-				
-				RE::NiPoint3 rotSpringForce = {
-					-k * a_state.rotationOffset.x - c * a_state.rotationVelocity.x + targetRotation.x * k * 0.5f,
-					-k * a_state.rotationOffset.y - c * a_state.rotationVelocity.y + targetRotation.y * k * 0.5f,
-					-k * a_state.rotationOffset.z - c * a_state.rotationVelocity.z + targetRotation.z * k * 0.5f
-				};
-				
-				RE::NiPoint3 rotAcceleration = { rotSpringForce.x / m, rotSpringForce.y / m, rotSpringForce.z / m };
-				
-				a_state.rotationVelocity.x += rotAcceleration.x * stepDelta;
-				a_state.rotationVelocity.y += rotAcceleration.y * stepDelta;
-				a_state.rotationVelocity.z += rotAcceleration.z * stepDelta;
-				
-				// Clamp velocity for stability
-				a_state.rotationVelocity = ClampVector(a_state.rotationVelocity, MAX_ROT_VELOCITY);
-				
-				a_state.rotationOffset.x += a_state.rotationVelocity.x * stepDelta;
-				a_state.rotationOffset.y += a_state.rotationVelocity.y * stepDelta;
-				a_state.rotationOffset.z += a_state.rotationVelocity.z * stepDelta;
-				
-				a_state.rotationOffset = ClampVector(a_state.rotationOffset, maxRotRad);
-			}
-		}
+		recorder->RecordFrame(record);
 	}
 	
-	// Update movement-based spring (responds to player strafing and forward/back movement)
-	// Uses TARGET-BASED spring: spring moves towards target position, not just returning to 0
-	// Uses PER-WEAPON settings for spring parameters
-	// Optional stance invert override: when true, XOR with base invert settings
-	void UpdateMovementSpring(SpringState& a_state, Settings* settings, 
-		const WeaponInertiaSettings& a_weaponSettings,
-		const RE::NiPoint3& a_localMovement, float a_delta, float a_intensity,
-		bool a_stanceInvertMovement = false)
+	void InertiaManager::CompileWeaponProfile()
 	{
-		// Check per-weapon enable AND global enable
-		if (!settings->movementInertiaEnabled || !a_weaponSettings.movementInertiaEnabled || a_intensity <= 0.0f) {
-			// Decay to zero when disabled
-			float decayRate = std::min(1.0f, a_delta * 5.0f);
-			a_state.positionOffset = LerpVector(a_state.positionOffset, {0,0,0}, decayRate);
-			a_state.rotationOffset = LerpVector(a_state.rotationOffset, {0,0,0}, decayRate);
-			a_state.positionVelocity = LerpVector(a_state.positionVelocity, {0,0,0}, decayRate);
-			a_state.rotationVelocity = LerpVector(a_state.rotationVelocity, {0,0,0}, decayRate);
-			return;
-		}
-		
-		// Spring parameters from PER-WEAPON settings
-		float k = a_weaponSettings.movementStiffness;
-		float c = a_weaponSettings.movementDamping;
-		float m = 1.0f;
-		
-		// Separate invert factors for lateral (left/right) and forward/back movement
-		// XOR with stance-specific override: stance invert flips the base setting
-		bool effectiveInvertLateral = a_weaponSettings.invertMovementLateral ^ a_stanceInvertMovement;
-		bool effectiveInvertForwardBack = a_weaponSettings.invertMovementForwardBack ^ a_stanceInvertMovement;
-		float invertLateral = effectiveInvertLateral ? -1.0f : 1.0f;
-		float invertForwardBack = effectiveInvertForwardBack ? -1.0f : 1.0f;
-		
-		// Calculate TARGET position based on movement
-		RE::NiPoint3 targetPos = { 0.0f, 0.0f, 0.0f };
-		RE::NiPoint3 targetRot = { 0.0f, 0.0f, 0.0f };
+		compiledProfileId++;
 		
-		float lateralSpeed = std::abs(a_localMovement.x);
-		float forwardSpeed = std::abs(a_localMovement.y);
-		float totalHorizontalSpeed = lateralSpeed + forwardSpeed;
-		
-		// === LATERAL (LEFT/RIGHT) MOVEMENT ===
-		if (lateralSpeed > settings->movementInertiaThreshold) {
-			float strength = settings->movementInertiaStrength * a_intensity;
-			float speedFactor = std::min(1.0f, lateralSpeed / 200.0f);
-			
-			// Calculate blend factor - reduce effect when moving diagonally
-			float lateralBlend = (totalHorizontalSpeed > 0.1f) ? (lateralSpeed / totalHorizontalSpeed) : 0.0f;
-			float blendedStrength = strength * lateralBlend * speedFactor * 1.5f;
-			
-			float normalizedInput = std::clamp(a_localMovement.x / 200.0f, -1.0f, 1.0f);
-			
-			// Blend multipliers based on direction
-			float rightBlend = std::max(0.0f, normalizedInput);
-			float leftBlend = std::max(0.0f, -normalizedInput);
-			float effectiveMult = rightBlend * a_weaponSettings.movementRightMult + 
-			                      leftBlend * a_weaponSettings.movementLeftMult;
-			
-			targetPos.x = invertLateral * -normalizedInput * effectiveMult * blendedStrength;
-			targetRot.z = invertLateral * -normalizedInput * effectiveMult * blendedStrength * 0.033f;
-		}
-		
-		// === FORWARD/BACK MOVEMENT ===
-		// Uses per-weapon forward/back multipliers (only if global forward/back is enabled)
-		if (settings->forwardBackInertia && forwardSpeed > settings->movementInertiaThreshold) {
-			float strength = settings->movementInertiaStrength * a_intensity;
-			float speedFactor = std::min(1.0f, forwardSpeed / 200.0f);
-			
-			// Calculate blend factor - reduce effect when moving diagonally
-			float forwardBlend = (totalHorizontalSpeed > 0.1f) ? (forwardSpeed / totalHorizontalSpeed) : 0.0f;
-			float blendedStrength = strength * forwardBlend * speedFactor;
-			
-			float normalizedInput = std::clamp(a_localMovement.y / 200.0f, -1.0f, 1.0f);
-			
-			// Use per-weapon forward/back multipliers
-			float forwardBlendMult = std::max(0.0f, normalizedInput);
-			float backwardBlendMult = std::max(0.0f, -normalizedInput);
-			float effectiveMult = forwardBlendMult * a_weaponSettings.movementForwardMult + 
-			                      backwardBlendMult * a_weaponSettings.movementBackwardMult;
-			
-			// Forward -> arms move toward camera (negative Y in local space)
-			// Backward -> arms move away from camera (positive Y in local space)
-			targetPos.y = invertForwardBack * -normalizedInput * effectiveMult * blendedStrength;
-			// Slight Z adjustment for natural feel
-			targetPos.z += invertForwardBack * -normalizedInput * effectiveMult * blendedStrength * 0.3f;
-		}
-		
-		// Clamp targets using per-weapon max values
-		targetPos = ClampVector(targetPos, a_weaponSettings.movementMaxOffset);
-		float maxRotRad = a_weaponSettings.movementMaxRotation * DEG_TO_RAD;
-		targetRot = ClampVector(targetRot, maxRotRad);
-		
-		// === FRAMERATE INDEPENDENCE: Sub-stepping ===
-		constexpr float MAX_SUBSTEP = 0.016f;
-		int numSteps = static_cast<int>(std::ceil(a_delta / MAX_SUBSTEP));
-		numSteps = std::clamp(numSteps, 1, 4);
-		float stepDelta = a_delta / static_cast<float>(numSteps);
-		
-		constexpr float MAX_POS_VELOCITY = 300.0f;
-		constexpr float MAX_ROT_VELOCITY = 30.0f;
-		
-		for (int step = 0; step < numSteps; ++step) {
-			// Spring physics for position: F = -k * (current - target) - c * velocity
-			RE::NiPoint3 posSpringForce = {
-				-k * (a_state.positionOffset.x - targetPos.x) - c * a_state.positionVelocity.x,
-				-k * (a_state.positionOffset.y - targetPos.y) - c * a_state.positionVelocity.y,
-				-k * (a_state.positionOffset.z - targetPos.z) - c * a_state.positionVelocity.z
-			};
-			
-			a_state.positionVelocity.x += (posSpringForce.x / m) * stepDelta;
-			a_state.positionVelocity.y += (posSpringForce.y / m) * stepDelta;
-			a_state.positionVelocity.z += (posSpringForce.z / m) * stepDelta;
-			
-			a_state.positionVelocity = ClampVector(a_state.positionVelocity, MAX_POS_VELOCITY);
-			
-			a_state.positionOffset.x += a_state.positionVelocity.x * stepDelta;
-			a_state.positionOffset.y += a_state.positionVelocity.y * stepDelta;
-			a_state.positionOffset.z += a_state.positionVelocity.z * stepDelta;
-			
-			a_state.positionOffset = ClampVector(a_state.positionOffset, a_weaponSettings.movementMaxOffset);
-			
-			// Spring physics for rotation
-			RE::NiPoint3 rotSpringForce = {
-				-k * (a_state.rotationOffset.x - targetRot.x) - c * a_state.rotationVelocity.x,
-				-k * (a_state.rotationOffset.y - targetRot.y) - c * a_state.rotationVelocity.y,
-				-k * (a_state.rotationOffset.z - targetRot.z) - c * a_state.rotationVelocity.z
-			};
-			
-			a_state.rotationVelocity.x += (rotSpringForce.x / m) * stepDelta;
-			a_state.rotationVelocity.y += (rotSpringForce.y / m) * stepDelta;
-			a_state.rotationVelocity.z += (rotSpringForce.z / m) * stepDelta;
-			
-			a_state.rotationVelocity = ClampVector(a_state.rotationVelocity, MAX_ROT_VELOCITY);
-			
-			a_state.rotationOffset.x += a_state.rotationVelocity.x * stepDelta;
-			a_state.rotationOffset.y += a_state.rotationVelocity.y * stepDelta;
-			a_state.rotationOffset.z += a_state.rotationVelocity.z * stepDelta;
-			
-			a_state.rotationOffset = ClampVector(a_state.rotationOffset, maxRotRad);
-		}
+		CompileProfile(*cachedWeaponSettings, Settings::GetSingleton()->settleDampingMult, compiledProfile);
 	}
 	
-	// Update sprint transition inertia
-	// Applies an impulse on sprint state change, then spring settles naturally
-	void UpdateSprintSpring(SpringState& a_state, const WeaponInertiaSettings& a_weaponSettings,
-		bool a_isSprinting, bool a_wasSprinting,
-		float& a_blendProgress, float& a_blendDuration,
-		RE::NiPoint3& a_pendingPosImpulse, RE::NiPoint3& a_pendingRotImpulse,
-		float a_delta)
+	void InertiaManager::CompileProfile(const WeaponInertiaSettings& a_weapon, float a_settleDampingMult, CompiledWeaponProfile& a_profile)
 	{
-		if (!a_weaponSettings.sprintInertiaEnabled) {
-			// Quickly decay to zero when disabled
-			float decayRate = std::min(1.0f, a_delta * 10.0f);
-			a_state.positionOffset = LerpVector(a_state.positionOffset, {0,0,0}, decayRate);
-			a_state.rotationOffset = LerpVector(a_state.rotationOffset, {0,0,0}, decayRate);
-			a_state.positionVelocity = LerpVector(a_state.positionVelocity, {0,0,0}, decayRate);
-			a_state.rotationVelocity = LerpVector(a_state.rotationVelocity, {0,0,0}, decayRate);
-			a_blendProgress = 0.0f;
-			a_pendingPosImpulse = {0,0,0};
-			a_pendingRotImpulse = {0,0,0};
-			return;
-		}
-		
-		constexpr float DEG_TO_RAD_LOCAL = 3.14159265358979323846f / 180.0f;
-		
-		// Detect sprint state transitions and set up impulse
-		if (a_isSprinting != a_wasSprinting) {
-			// Calculate the total impulse to apply
-			if (a_isSprinting) {
-				// Starting sprint - arms lag behind
-				a_pendingPosImpulse = {
-					0.0f,
-					a_weaponSettings.sprintImpulseY * 20.0f,
-					-a_weaponSettings.sprintImpulseZ * 15.0f
-				};
-				a_pendingRotImpulse = {
-					a_weaponSettings.sprintRotImpulse * DEG_TO_RAD_LOCAL * 10.0f,
-					0.0f,
-					0.0f
-				};
-			} else {
-				// Stopping sprint - arms overshoot forward
-				a_pendingPosImpulse = {
-					0.0f,
-					-a_weaponSettings.sprintImpulseY * 25.0f,
-					a_weaponSettings.sprintImpulseZ * 12.0f
-				};
-				a_pendingRotImpulse = {
-					-a_weaponSettings.sprintRotImpulse * DEG_TO_RAD_LOCAL * 8.0f,
-					0.0f,
-					0.0f
-				};
-			}
-			
-			// Set up blend
-			a_blendDuration = a_weaponSettings.sprintImpulseBlendTime;
-			a_blendProgress = 0.0f;
-			
-			// If blend time is 0, apply instantly
-			if (a_blendDuration <= 0.001f) {
-				a_state.positionVelocity.x += a_pendingPosImpulse.x;
-				a_state.positionVelocity.y += a_pendingPosImpulse.y;
-				a_state.positionVelocity.z += a_pendingPosImpulse.z;
-				a_state.rotationVelocity.x += a_pendingRotImpulse.x;
-				a_state.rotationVelocity.y += a_pendingRotImpulse.y;
-				a_state.rotationVelocity.z += a_pendingRotImpulse.z;
-				a_pendingPosImpulse = {0,0,0};
-				a_pendingRotImpulse = {0,0,0};
-				a_blendProgress = 1.0f;
-			}
-		}
-		
-		// Apply pending impulse gradually if blending
-		if (a_blendProgress < 1.0f && a_blendDuration > 0.001f) {
-			float prevProgress = a_blendProgress;
-			a_blendProgress = std::min(1.0f, a_blendProgress + a_delta / a_blendDuration);
-			
-			// Apply the portion of impulse for this frame
-			float deltaProgress = a_blendProgress - prevProgress;
-			a_state.positionVelocity.x += a_pendingPosImpulse.x * deltaProgress;
-			a_state.positionVelocity.y += a_pendingPosImpulse.y * deltaProgress;
-			a_state.positionVelocity.z += a_pendingPosImpulse.z * deltaProgress;
-			a_state.rotationVelocity.x += a_pendingRotImpulse.x * deltaProgress;
-			a_state.rotationVelocity.y += a_pendingRotImpulse.y * deltaProgress;
-			a_state.rotationVelocity.z += a_pendingRotImpulse.z * deltaProgress;
-			
-			// Clear pending when done
-			if (a_blendProgress >= 1.0f) {
-				a_pendingPosImpulse = {0,0,0};
-				a_pendingRotImpulse = {0,0,0};
-			}
-		}
-		
-		// Spring physics to settle back to zero (target is always neutral)
-		float k = a_weaponSettings.sprintStiffness;
-		float c = a_weaponSettings.sprintDamping;
-		float m = 1.0f;
-		
-		// Sub-stepping for stability
-		constexpr float MAX_SUBSTEP = 0.016f;
-		int numSteps = static_cast<int>(std::ceil(a_delta / MAX_SUBSTEP));
-		numSteps = std::clamp(numSteps, 1, 4);
-		float stepDelta = a_delta / static_cast<float>(numSteps);
-		
-		constexpr float MAX_POS_VELOCITY = 400.0f;
-		constexpr float MAX_ROT_VELOCITY = 40.0f;
-		
-		for (int step = 0; step < numSteps; ++step) {
-			// Position spring: F = -k * position - c * velocity (target is 0,0,0)
-			RE::NiPoint3 posForce = {
-				-k * a_state.positionOffset.x - c * a_state.positionVelocity.x,
-				-k * a_state.positionOffset.y - c * a_state.positionVelocity.y,
-				-k * a_state.positionOffset.z - c * a_state.positionVelocity.z
-			};
-			
-			a_state.positionVelocity.x += (posForce.x / m) * stepDelta;
-			a_state.positionVelocity.y += (posForce.y / m) * stepDelta;
-			a_state.positionVelocity.z += (posForce.z / m) * stepDelta;
-			
-			a_state.positionVelocity = ClampVector(a_state.positionVelocity, MAX_POS_VELOCITY);
-			
-			a_state.positionOffset.x += a_state.positionVelocity.x * stepDelta;
-			a_state.positionOffset.y += a_state.positionVelocity.y * stepDelta;
-			a_state.positionOffset.z += a_state.positionVelocity.z * stepDelta;
-			
-			// Clamp max offset
-			a_state.positionOffset = ClampVector(a_state.positionOffset, 30.0f);
-			
-			// Rotation spring
-			RE::NiPoint3 rotForce = {
-				-k * a_state.rotationOffset.x - c * a_state.rotationVelocity.x,
-				-k * a_state.rotationOffset.y - c * a_state.rotationVelocity.y,
-				-k * a_state.rotationOffset.z - c * a_state.rotationVelocity.z
-			};
-			
-			a_state.rotationVelocity.x += (rotForce.x / m) * stepDelta;
-			a_state.rotationVelocity.y += (rotForce.y / m) * stepDelta;
-			a_state.rotationVelocity.z += (rotForce.z / m) * stepDelta;
-			
-			a_state.rotationVelocity = ClampVector(a_state.rotationVelocity, MAX_ROT_VELOCITY);
-			
-			a_state.rotationOffset.x += a_state.rotationVelocity.x * stepDelta;
-			a_state.rotationOffset.y += a_state.rotationVelocity.y * stepDelta;
-			a_state.rotationOffset.z += a_state.rotationVelocity.z * stepDelta;
-			
-			// Clamp max rotation (45 degrees in radians)
-			a_state.rotationOffset = ClampVector(a_state.rotationOffset, 0.785f);
-		}
+		const WeaponInertiaSettings& weapon = a_weapon;
+		CompiledWeaponProfile& profile = a_profile;
+		
+		profile.cameraStiffness = weapon.stiffness / weapon.mass;
+		profile.cameraDamping = weapon.damping / weapon.mass;
+		profile.cameraMaxOffset = weapon.maxOffset;
+		profile.cameraMaxRotation = weapon.maxRotation * DEG_TO_RAD;
+		profile.cameraTargetMaxOffset = weapon.maxOffset * 2.0f;
+		profile.cameraTargetMaxRotation = profile.cameraMaxRotation * 2.0f;
+		profile.cameraPitchPosScale = 1.5f * weapon.cameraPitchMult;
+		profile.cameraPitchRotScale = 0.08f * weapon.pitchMultiplier * weapon.cameraPitchMult;
+		profile.cameraRollRotScale = 0.04f * weapon.rollMultiplier;
+		profile.cameraAirMult = weapon.cameraInertiaAirMult;
+		
+		profile.movementEnabled = weapon.movementInertiaEnabled;
+		profile.movementStiffness = weapon.movementStiffness;
+		profile.movementDamping = weapon.movementDamping;
+		profile.movementMaxOffset = weapon.movementMaxOffset;
+		profile.movementMaxRotation = weapon.movementMaxRotation * DEG_TO_RAD;
+		profile.movementLeftMult = weapon.movementLeftMult;
+		profile.movementRightMult = weapon.movementRightMult;
+		profile.movementForwardMult = weapon.movementForwardMult;
+		profile.movementBackwardMult = weapon.movementBackwardMult;
+		
+		// Sprint start: arms lag behind; sprint stop: arms overshoot forward
+		profile.sprintEnabled = weapon.sprintInertiaEnabled;
+		profile.sprintStartPosImpulse = { 0.0f, weapon.sprintImpulseY * 20.0f, -weapon.sprintImpulseZ * 15.0f };
+		profile.sprintStartRotImpulse = { weapon.sprintRotImpulse * DEG_TO_RAD * 10.0f, 0.0f, 0.0f };
+		profile.sprintStopPosImpulse = { 0.0f, -weapon.sprintImpulseY * 25.0f, weapon.sprintImpulseZ * 12.0f };
+		profile.sprintStopRotImpulse = { -weapon.sprintRotImpulse * DEG_TO_RAD * 8.0f, 0.0f, 0.0f };
+		profile.sprintBlendTime = weapon.sprintImpulseBlendTime;
+		profile.sprintStiffness = weapon.sprintStiffness;
+		profile.sprintDamping = weapon.sprintDamping;
+		
+		// Jump: arms dip down and back on push-off; fall: gentler follow-through
+		profile.jumpEnabled = weapon.jumpInertiaEnabled;
+		profile.jumpPosImpulse = { 0.0f, weapon.jumpImpulseY * 15.0f, -weapon.jumpImpulseZ * 20.0f };
+		profile.jumpRotImpulse = { weapon.jumpRotImpulse * DEG_TO_RAD * 8.0f, 0.0f, 0.0f };
+		profile.fallPosImpulse = { 0.0f, weapon.fallImpulseY * 15.0f, -weapon.fallImpulseZ * 20.0f };
+		profile.fallRotImpulse = { weapon.fallRotImpulse * DEG_TO_RAD * 8.0f, 0.0f, 0.0f };
+		profile.jumpStiffness = weapon.jumpStiffness;
+		profile.jumpDamping = weapon.jumpDamping;
+		profile.landStiffness = weapon.landStiffness;
+		profile.landDamping = weapon.landDamping;
+		profile.landImpulseY = weapon.landImpulseY;
+		profile.landImpulseZ = weapon.landImpulseZ;
+		profile.landRotImpulse = weapon.landRotImpulse * DEG_TO_RAD;
+		profile.airTimeImpulseScale = weapon.airTimeImpulseScale;
+		
+		profile.simultaneousThreshold = weapon.simultaneousThreshold;
+		profile.simultaneousCameraMult = weapon.simultaneousCameraMult;
+		profile.simultaneousMovementMult = weapon.simultaneousMovementMult;
+		
+		// Stance invert overrides flip the base setting (XOR)
+		for (size_t i = 0; i < profile.stances.size(); ++i) {
+			auto& stance = profile.stances[i];
+			stance.multiplier = weapon.stanceMultipliers[i];
+			stance.cameraInvertPitch = (weapon.invertCameraPitch ^ weapon.stanceInvertCamera[i]) ? -1.0f : 1.0f;
+			stance.cameraInvertYaw = (weapon.invertCameraYaw ^ weapon.stanceInvertCamera[i]) ? -1.0f : 1.0f;
+			stance.movementInvertLateral = (weapon.invertMovementLateral ^ weapon.stanceInvertMovement[i]) ? -1.0f : 1.0f;
+			stance.movementInvertForwardBack = (weapon.invertMovementForwardBack ^ weapon.stanceInvertMovement[i]) ? -1.0f : 1.0f;
+		}
+		
+		// Largest stable substep per spring category and integrator
+		Core::CompileStability(profile, a_settleDampingMult);
 	}
 	
-	// Update jump/landing inertia
-	// Applies impulse on jump start, uses low stiffness while airborne,
-	// then applies landing impulse with high stiffness scaled by air time
-	// Blends smoothly between jump and landing states if landing before jump settles
-	void UpdateJumpSpring(SpringState& a_state, const WeaponInertiaSettings& a_weaponSettings,
-		bool a_isInAir, bool a_wasInAir, bool a_didJump, float a_airTime, bool a_landingDetected,
-		float& a_currentStiffness, float& a_currentDamping, float a_delta)
-	{
-		if (!a_weaponSettings.jumpInertiaEnabled) {
-			// Quickly decay to zero when disabled
-			float decayRate = std::min(1.0f, a_delta * 10.0f);
-			a_state.positionOffset = LerpVector(a_state.positionOffset, {0,0,0}, decayRate);
-			a_state.rotationOffset = LerpVector(a_state.rotationOffset, {0,0,0}, decayRate);
-			a_state.positionVelocity = LerpVector(a_state.positionVelocity, {0,0,0}, decayRate);
-			a_state.rotationVelocity = LerpVector(a_state.rotationVelocity, {0,0,0}, decayRate);
-			return;
-		}
-		
-		constexpr float DEG_TO_RAD_LOCAL = 3.14159265358979323846f / 180.0f;
-		
-		// Detect state transitions
-		if (a_isInAir && !a_wasInAir) {
-			// Just left the ground (jump or fall)
-			// Use airborne spring parameters
-			a_currentStiffness = a_weaponSettings.jumpStiffness;
-			a_currentDamping = a_weaponSettings.jumpDamping;
-			
-			if (a_didJump) {
-				// Player actually jumped - apply full jump impulse
-				// Arms dip down and back as player pushes off
-				a_state.positionVelocity.y += a_weaponSettings.jumpImpulseY * 15.0f;
-				a_state.positionVelocity.z -= a_weaponSettings.jumpImpulseZ * 20.0f;
-				a_state.rotationVelocity.x += a_weaponSettings.jumpRotImpulse * DEG_TO_RAD_LOCAL * 8.0f;
-			} else {
-				// Player fell off a ledge - apply gentler fall impulse
-				// Slight downward/forward motion as arms follow momentum
-				a_state.positionVelocity.y += a_weaponSettings.fallImpulseY * 15.0f;
-				a_state.positionVelocity.z -= a_weaponSettings.fallImpulseZ * 20.0f;
-				a_state.rotationVelocity.x += a_weaponSettings.fallRotImpulse * DEG_TO_RAD_LOCAL * 8.0f;
-			}
-		}
-		else if (a_landingDetected) {
-			// Just landed (detected via SBF_ReadyStart or state transition with cooldown)
-			// Switch to landing spring parameters (tighter)
-			a_currentStiffness = a_weaponSettings.landStiffness;
-			a_currentDamping = a_weaponSettings.landDamping;
-			
-			// Calculate how "settled" the spring currently is (0 = max energy, 1 = fully settled)
-			// This allows smooth blending if landing before jump spring has settled
-			float posEnergy = std::sqrt(
-				a_state.positionOffset.x * a_state.positionOffset.x +
-				a_state.positionOffset.y * a_state.positionOffset.y +
-				a_state.positionOffset.z * a_state.positionOffset.z);
-			float velEnergy = std::sqrt(
-				a_state.positionVelocity.x * a_state.positionVelocity.x +
-				a_state.positionVelocity.y * a_state.positionVelocity.y +
-				a_state.positionVelocity.z * a_state.positionVelocity.z);
-			
-			// Normalize energy (rough estimate based on typical max values)
-			float normalizedEnergy = std::clamp((posEnergy / 20.0f) + (velEnergy / 200.0f), 0.0f, 1.0f);
-			
-			// Settled factor: 1 when spring is idle, 0 when spring has max energy
-			float settledFactor = 1.0f - normalizedEnergy;
-			
-			// Calculate landing impulse scale based on air time
-			// Minimum 0.3 sec to register as significant landing, caps at ~2 sec
-			float normalizedAirTime = std::clamp((a_airTime - 0.1f) / 1.5f, 0.0f, 1.0f);
-			
-			// If player didn't jump (just fell), use a different base scale
-			float baseScale = a_didJump ? 1.0f : 0.7f;
-			
-			// Apply air time scaling with configurable exponent
-			float impulseScale = baseScale * (0.3f + normalizedAirTime * a_weaponSettings.airTimeImpulseScale);
-			
-			// Blend landing impulse based on how settled the spring is
-			// If spring has lots of energy (unsettled), reduce landing impulse to avoid stacking
-			// Minimum 30% of landing impulse always applies to ensure landing feels responsive
-			float blendedScale = impulseScale * (0.3f + 0.7f * settledFactor);
-			
-			// If spring is unsettled, also dampen existing velocity to transition smoothly
-			// This prevents the jump spring momentum from fighting the landing impulse
-			if (normalizedEnergy > 0.3f) {
-				float dampFactor = 0.5f + 0.5f * settledFactor; // 0.5 to 1.0
-				a_state.positionVelocity.x *= dampFactor;
-				a_state.positionVelocity.y *= dampFactor;
-				a_state.positionVelocity.z *= dampFactor;
-				a_state.rotationVelocity.x *= dampFactor;
-				a_state.rotationVelocity.y *= dampFactor;
-				a_state.rotationVelocity.z *= dampFactor;
-			}
-			
-			// Landing impulse - arms compress down then bounce back
-			a_state.positionVelocity.y -= a_weaponSettings.landImpulseY * blendedScale * 20.0f;
-			a_state.positionVelocity.z -= a_weaponSettings.landImpulseZ * blendedScale * 25.0f;
-			a_state.rotationVelocity.x += a_weaponSettings.landRotImpulse * DEG_TO_RAD_LOCAL * blendedScale * 10.0f;
-		}
-		
-		// Spring physics with current stiffness/damping
-		float k = a_currentStiffness;
-		float c = a_currentDamping;
-		float m = 1.0f;
-		
-		// Sub-stepping for stability
-		constexpr float MAX_SUBSTEP = 0.016f;
-		int numSteps = static_cast<int>(std::ceil(a_delta / MAX_SUBSTEP));
-		numSteps = std::clamp(numSteps, 1, 4);
-		float stepDelta = a_delta / static_cast<float>(numSteps);
-		
-		constexpr float MAX_POS_VELOCITY = 500.0f;
-		constexpr float MAX_ROT_VELOCITY = 50.0f;
-		
-		for (int step = 0; step < numSteps; ++step) {
-			// Position spring: F = -k * position - c * velocity (target is 0,0,0)
-			RE::NiPoint3 posForce = {
-				-k * a_state.positionOffset.x - c * a_state.positionVelocity.x,
-				-k * a_state.positionOffset.y - c * a_state.positionVelocity.y,
-				-k * a_state.positionOffset.z - c * a_state.positionVelocity.z
-			};
-			
-			a_state.positionVelocity.x += (posForce.x / m) * stepDelta;
-			a_state.positionVelocity.y += (posForce.y / m) * stepDelta;
-			a_state.positionVelocity.z += (posForce.z / m) * stepDelta;
-			
-			a_state.positionVelocity = ClampVector(a_state.positionVelocity, MAX_POS_VELOCITY);
-			
-			a_state.positionOffset.x += a_state.positionVelocity.x * stepDelta;
-			a_state.positionOffset.y += a_state.positionVelocity.y * stepDelta;
-			a_state.positionOffset.z += a_state.positionVelocity.z * stepDelta;
-			
-			// Clamp max offset
-			a_state.positionOffset = ClampVector(a_state.positionOffset, 40.0f);
-			
-			// Rotation spring
-			RE::NiPoint3 rotForce = {
-				-k * a_state.rotationOffset.x - c * a_state.rotationVelocity.x,
-				-k * a_state.rotationOffset.y - c * a_state.rotationVelocity.y,
-				-k * a_state.rotationOffset.z - c * a_state.rotationVelocity.z
-			};
-			
-			a_state.rotationVelocity.x += (rotForce.x / m) * stepDelta;
-			a_state.rotationVelocity.y += (rotForce.y / m) * stepDelta;
-			a_state.rotationVelocity.z += (rotForce.z / m) * stepDelta;
-			
-			a_state.rotationVelocity = ClampVector(a_state.rotationVelocity, MAX_ROT_VELOCITY);
-			
-			a_state.rotationOffset.x += a_state.rotationVelocity.x * stepDelta;
-			a_state.rotationOffset.y += a_state.rotationVelocity.y * stepDelta;
-			a_state.rotationOffset.z += a_state.rotationVelocity.z * stepDelta;
-			
-			// Clamp max rotation
-			a_state.rotationOffset = ClampVector(a_state.rotationOffset, 0.785f);
-		}
-	}
-
-	RE::NiPoint3 InertiaManager::CalculateLocalMovement(RE::PlayerCharacter* a_player, float a_delta)
-	{
-		if (!a_player || a_delta <= 0.0f) {
-			return { 0.0f, 0.0f, 0.0f };
-		}
-		
-		// Use player input directly - much more reliable than position tracking
-		// This gives us the raw input values already in local (camera-relative) space
-		auto* playerControls = RE::PlayerControls::GetSingleton();
-		if (!playerControls) {
-			return { 0.0f, 0.0f, 0.0f };
-		}
-		
-		// moveInputVec is already in local space:
-		// X = left/right input (-1 = left, +1 = right)
-		// Y = forward/back input (-1 = back, +1 = forward)
-		RE::NiPoint2 inputVec = playerControls->data.moveInputVec;
-		
-		// Scale input to approximate velocity (input is -1 to 1, scale to reasonable speed)
-		// Normal walk speed is ~100-150 units/sec, run is ~300+
-		constexpr float INPUT_TO_VELOCITY = 200.0f;
-		
-		RE::NiPoint3 localVelocity = {
-			inputVec.x * INPUT_TO_VELOCITY,   // Local right (strafe)
-			inputVec.y * INPUT_TO_VELOCITY,   // Local forward
-			0.0f                               // No vertical from input
-		};
-		
-		// Smooth the movement input to reduce jitter
-		constexpr float MOVEMENT_SMOOTHING = 0.3f;
-		smoothedLocalMovement = LerpVector(smoothedLocalMovement, localVelocity, 1.0f - MOVEMENT_SMOOTHING);
-		
-		return smoothedLocalMovement;
-	}
-
-	void InertiaManager::ApplyOffset(RE::NiNode* a_node, const SpringState& a_state,
-		const WeaponInertiaSettings& a_settings, [[maybe_unused]] Hand a_hand)
+	void InertiaManager::ApplyOffset(RE::NiNode* a_node, const Core::Pose::Offset& a_offset,
+		int a_pivotPoint, [[maybe_unused]] Hand a_hand)
 	{
 		if (!a_node) {
 			return;
 		}
 		
-		auto* settings = Settings::GetSingleton();
+		SpringState state;
+		state.positionOffset = a_offset.position;
+		state.rotationOffset = a_offset.rotation;
 		
-		// Get the offsets from spring state
-		const RE::NiPoint3& positionOffset = a_state.positionOffset;
-		const RE::NiPoint3& rotationOffset = a_state.rotationOffset;
-		
-		// Apply position offset (ADDITIVE from both camera and movement springs)
-		if (settings->enablePosition) {
-			a_node->local.translate.x += positionOffset.x;
-			a_node->local.translate.y += positionOffset.y;
-			a_node->local.translate.z += positionOffset.z;
-		}
-		
-		// Apply rotation offset with pivot compensation
-		if (settings->enableRotation && 
-			(std::abs(rotationOffset.x) > 0.0001f ||
-			 std::abs(rotationOffset.y) > 0.0001f ||
-			 std::abs(rotationOffset.z) > 0.0001f)) {
-			
-			// Apply pivot compensation using PER-WEAPON pivot point
-			// This adds a translation to make it APPEAR that rotation is around a different point
-			int weaponPivot = a_settings.pivotPoint;
-			if (weaponPivot != 0) {  // 0 = Chest, no compensation needed
-				// Pivot offset is the approximate distance from spine to the pivot point
-				float pivotDistance = 0.0f;
-				switch (weaponPivot) {
-				case 1:  // Right hand
-				case 2:  // Left hand
-					pivotDistance = 35.0f;
-					break;
-				case 3:  // Weapon
-					pivotDistance = 50.0f;
-					break;
-				case 4:  // Both Clavicles (no compensation, applied at clavicle level)
-					pivotDistance = 0.0f;
-					break;
-				case 5:  // Both Clavicles with Offset - compensate based on which side
-					// Distance from clavicle to approximate hand position (arm length)
-					// Similar to pivots 1/2 for consistent feel
-					pivotDistance = 35.0f;
-					break;
-				default:
-					break;
-				}
-				
-				// Yaw rotation (around Z) causes X displacement at the pivot
-				float yawCompensation = -pivotDistance * rotationOffset.z;
-				// Pitch rotation (around X) causes Y displacement at the pivot
-				float pitchCompensation = -pivotDistance * rotationOffset.x * 0.5f;
-				
-				a_node->local.translate.x += yawCompensation;
-				a_node->local.translate.y += pitchCompensation;
-			}
-			
-			RE::NiMatrix3 offsetRotation = EulerToMatrix(rotationOffset);
-			a_node->local.rotate = a_node->local.rotate * offsetRotation;
-		}
+		// Position offset, then rotation with pivot compensation using the PER-WEAPON pivot point
+		auto* settings = Settings::GetSingleton();
+		Core::ApplyOffset(a_node->local.translate, a_node->local.rotate, state,
+			settings->enablePosition, settings->enableRotation, a_pivotPoint, settings->expMapRotation);
 	}
 	
 	// Get the spine node for applying inertia (ALWAYS the spine)
@@ -1290,6 +711,9 @@ namespace Inertia
 	// Uses caching to avoid expensive string-based node searches every frame
 	RE::NiNode* InertiaManager::GetPivotNode(RE::NiNode* a_fpRoot, RE::PlayerCharacter* a_player)
 	{
+		FPI_PERF_SCOPE(kPivotNode);
+		FPI_TRACE_ZONE("Pivot node lookup");
+		
 		// Return cached node if valid (pointer still valid and part of current skeleton)
 		// We verify the cache is still valid by checking if the node's parent chain leads to our root
 		if (cachedSpineNode) {
@@ -1315,11 +739,58 @@ namespace Inertia
 
 	void InertiaManager::Update(float a_delta)
 	{
+		FPI_PERF_SCOPE(kUpdate);
+		FPI_TRACE_ZONE("InertiaManager::Update");
+		Perf::ScopedTicks frameCost(frameCostTicks);
+		
+		// A step still running on the worker (joined late or not at all) owns frame - take it back first
+		frameWorker.Wait();
+		lateLatchPending = false;
+		
+		// Last frame is complete on every path now (inline, late latch or worker): sample it for the
+		// overlay and the CSV capture
+		auto* telemetryCapture = TelemetryCapture::GetSingleton();
+		const bool capturingTelemetry = telemetryCapture->Sync();
+		const bool debugOnScreen = Settings::GetSingleton()->debugOnScreen;
+		if (debugOnScreen || capturingTelemetry) {
+			const float costUs = static_cast<float>(Perf::TicksToNs(frameCostTicks) / 1000.0);
+			if (debugOnScreen) {
+				telemetry.Push(Core::MakeTelemetrySample(frame, telemetryTime, costUs));
+			}
+			if (capturingTelemetry) {
+				telemetryCapture->Record(frame, telemetryDelta, costUs);
+			}
+		}
+		telemetryTime += a_delta;
+		telemetryDelta = a_delta;
+		frameCostTicks = 0;
+		
+		// Input trace recording (started/stopped from the menu). The first frame of a recording
+		// snapshots the physics state so a replay starts exactly where the game was.
+		auto* traceRecorder = TraceRecorder::GetSingleton();
+		const bool tracing = traceRecorder->Sync();
+		if (tracing && traceRecorder->NeedsState()) {
+			traceRecorder->RecordState(frame);
+			traceResetPending = false;
+		}
+		
+		// Reset requested from the menu - applied here, where frame is no longer on loan to the worker
+		if (resetPending.exchange(false, std::memory_order_acq_rel)) {
+			Reset();
+		}
+		
 		auto* settings = Settings::GetSingleton();
 		if (!settings->enabled) {
 			return;
 		}
 		
+		// One preset snapshot for the whole frame, reloaded only when a new one was published (the
+		// shared_ptr load takes a short lock); the one it replaces is freed by the menu thread
+		auto* presets = InertiaPresets::GetSingleton();
+		if (!presetSnapshot || presetSnapshot->generation != presets->GetSnapshotGeneration()) {
+			presetSnapshot = presets->AcquireSnapshot();
+		}
+		
 		// Skip updates when any menu is open to prevent flickering/glitches
 		// Consolidated early-exit: GameIsPaused covers most pause menus
 		auto* ui = RE::UI::GetSingleton();
@@ -1360,49 +831,35 @@ namespace Inertia
 		}
 		
 		// Update equip blend factor (smooth transition when drawing/sheathing)
-		// Cap delta time to prevent instant blends from frame rate spikes or loading
-		constexpr float MAX_BLEND_DELTA = 0.05f;  // 50ms max
-		float cappedDelta = std::min(a_delta, MAX_BLEND_DELTA);
-		
-		constexpr float EQUIP_BLEND_IN_SPEED = 3.0f;   // Speed when drawing weapon (blend in)
-		constexpr float EQUIP_BLEND_OUT_SPEED = 4.0f;  // Speed when sheathing weapon (blend out, slightly faster)
-		float equipBlendTarget = isWeaponDrawn ? 1.0f : 0.0f;
-		
-		// Use appropriate speed based on direction
-		float blendSpeed = (equipBlendFactor < equipBlendTarget) ? EQUIP_BLEND_IN_SPEED : EQUIP_BLEND_OUT_SPEED;
-		float equipBlendDelta = blendSpeed * cappedDelta;
-		
-		float prevEquipBlendFactor = equipBlendFactor;
-		
-		if (equipBlendFactor < equipBlendTarget) {
-			equipBlendFactor = std::min(equipBlendTarget, equipBlendFactor + equipBlendDelta);
-		} else if (equipBlendFactor > equipBlendTarget) {
-			equipBlendFactor = std::max(equipBlendTarget, equipBlendFactor - equipBlendDelta);
-		}
+		float prevEquipBlendFactor = frame.equipBlendFactor;
+		const Core::EquipBlendStep equipStep = Core::StepEquipBlend(frame.equipBlendFactor, isWeaponDrawn, a_delta);
+		const float equipBlendTarget = equipStep.target;
 		
 		// Log equip state changes (only when debug logging enabled)
 		if (settings->debugLogging) {
 			if (isWeaponDrawn != wasWeaponDrawn) {
 				logger::info("[FPInertia] Equip state change: drawn={} -> {}, equipBlendFactor={:.3f}",
-					wasWeaponDrawn, isWeaponDrawn, equipBlendFactor);
+					wasWeaponDrawn, isWeaponDrawn, frame.equipBlendFactor);
 			}
 			
-			// Log blend progress while blending (every few frames to avoid spam)
-			bool isBlending = std::abs(equipBlendFactor - equipBlendTarget) > 0.001f;
-			static int blendLogCounter = 0;
-			if (isBlending) {
-				blendLogCounter++;
-				if (blendLogCounter % 10 == 0) {  // Log every 10 frames while blending
-					logger::info("[FPInertia] Equip blend: {:.3f} -> {:.3f} (target={:.1f}, speed={:.1f}, delta={:.4f})",
-						prevEquipBlendFactor, equipBlendFactor, equipBlendTarget, blendSpeed, cappedDelta);
+			// Log blend progress while blending (every few frames to avoid spam) - trace level
+			if constexpr (Diagnostics::kTrace) {
+				bool isBlending = std::abs(frame.equipBlendFactor - equipBlendTarget) > 0.001f;
+				static int blendLogCounter = 0;
+				if (isBlending) {
+					blendLogCounter++;
+					if (blendLogCounter % 10 == 0) {  // Log every 10 frames while blending
+						logger::info("[FPInertia] Equip blend: {:.3f} -> {:.3f} (target={:.1f}, speed={:.1f}, delta={:.4f})",
+							prevEquipBlendFactor, frame.equipBlendFactor, equipBlendTarget, equipStep.speed, equipStep.cappedDelta);
+					}
+				} else {
+					blendLogCounter = 0;
 				}
-			} else {
-				blendLogCounter = 0;
 			}
 		}
 		
 		// If fully sheathed and blend is complete, reset springs
-		if (equipBlendFactor <= 0.001f && !isWeaponDrawn) {
+		if (frame.equipBlendFactor <= 0.001f && !isWeaponDrawn) {
 			if (isInFirstPerson && lastTargetNode) {
 				logger::info("[FPInertia] Fully sheathed, resetting springs");
 				Reset();
@@ -1442,56 +899,45 @@ namespace Inertia
 			return;
 		}
 		
-		// Calculate camera velocity
-		RE::NiPoint3 rawCameraVelocity = CalculateCameraVelocity(a_delta);
-		
-		// Smooth the camera velocity to reduce jitter
-		float smoothing = settings->smoothingFactor;
-		smoothedCameraVelocity = LerpVector(smoothedCameraVelocity, rawCameraVelocity, 1.0f - smoothing);
+		// *** GATHER FRAME INPUTS ***
+		// Everything the physics core reads from the game this frame
+		// Late latch moves the camera and spring step into OnFirstPersonUpdate; frame generation keeps
+		// the two-hook path, and traces record the stepped state here, so both step inline
+		const bool lateLatch = settings->lateLatch && !settings->frameGenCompatMode && !tracing;
+		const Core::CoreSettings coreSettings = MakeCoreSettings(settings);
+		Core::FrameInputs inputs;
+		inputs.delta = a_delta;
+		inputs.camera = { player->GetAngleZ(), player->GetAngleX(), 0.0f };  // Roll is typically 0 in Skyrim
 		
-		// Skip first frame to initialize camera tracking
-		if (!initialized) {
-			initialized = true;
-			settlingFactor = 0.0f;
-			timeSinceMovement = 0.0f;
-			logger::info("[FPInertia] First frame initialized, starting inertia updates");
-			return;
+		// moveInputVec is already in local (camera-relative) space:
+		// X = left/right input (-1 = left, +1 = right)
+		// Y = forward/back input (-1 = back, +1 = forward)
+		if (auto* playerControls = RE::PlayerControls::GetSingleton()) {
+			inputs.moveInputX = playerControls->data.moveInputVec.x;
+			inputs.moveInputY = playerControls->data.moveInputVec.y;
 		}
+		inputs.inAction = IsPlayerInAction(player);
+		inputs.sprinting = player->AsActorState()->IsSprinting();
+		inputs.inMidair = player->IsInMidair();
 		
-		// Calculate settling factor based on camera movement
-		// When camera is moving, reset settling. When stopped, gradually increase damping.
-		float cameraSpeed = std::sqrt(
-			smoothedCameraVelocity.x * smoothedCameraVelocity.x +
-			smoothedCameraVelocity.y * smoothedCameraVelocity.y +
-			smoothedCameraVelocity.z * smoothedCameraVelocity.z
-		);
-		
-		constexpr float MOVEMENT_THRESHOLD = 0.1f; // Minimum velocity to count as "moving"
-		
-		if (cameraSpeed > MOVEMENT_THRESHOLD) {
-			// Camera is moving - reset settling
-			timeSinceMovement = 0.0f;
-			settlingFactor = 0.0f;
-		} else {
-			// Camera stopped - start settling after delay
-			timeSinceMovement += a_delta;
-			
-			if (timeSinceMovement > settings->settleDelay) {
-				// Gradually increase settling factor
-				float settleTime = timeSinceMovement - settings->settleDelay;
-				settlingFactor = std::min(1.0f, settleTime * settings->settleSpeed);
-			}
+		// Detect if player jumped vs fell by checking behavior graph "bInJumpState" on leaving the ground
+		// This is set by the game when the player actually presses jump
+		if (inputs.inMidair && !frame.isInAir) {
+			player->GetGraphVariableBool("bInJumpState", inputs.inJumpState);
 		}
 		
-		// Action blending - reduce intensity during attacks/bow draw/spells
-		bool inAction = IsPlayerInAction(player);
-		float targetBlend = inAction ? settings->actionMinIntensity : 1.0f;
+		// Get current stance from stance mods (Stances NG, Dynamic Weapon Movesets)
+		// This affects the global intensity multiplier for all inertia
+		inputs.stance = GetCurrentStance();
 		
-		// Smooth blend towards target
-		if (actionBlendFactor < targetBlend) {
-			actionBlendFactor = std::min(targetBlend, actionBlendFactor + a_delta * settings->actionBlendSpeed);
-		} else if (actionBlendFactor > targetBlend) {
-			actionBlendFactor = std::max(targetBlend, actionBlendFactor - a_delta * settings->actionBlendSpeed);
+		// *** CAMERA VELOCITY, SETTLING AND ACTION BLEND ***
+		// Skip first frame to initialize camera tracking (late latch: done by StepLateLatch)
+		if (!lateLatch && !Core::StepCamera(frame, inputs, coreSettings)) {
+			logger::info("[FPInertia] First frame initialized, starting inertia updates");
+			if (tracing) {
+				RecordTraceFrame(player, inputs, coreSettings, isWeaponDrawn, 0);
+			}
+			return;
 		}
 		
 		// Get weapon types for each hand
@@ -1505,134 +951,45 @@ namespace Inertia
 		// If inertia is disabled for this weapon type, reset springs and exit early
 		if (!primarySettings.enabled) {
 			// Reset springs so there's no lingering offset when switching to an enabled type
+			std::uint16_t traceFlags = Trace::kCameraPrimed;
 			if (!wasInertiaDisabled) {
-				cameraSpring.Reset();
-				movementSpring.Reset();
-				cameraSpringLeft.Reset();
-				movementSpringLeft.Reset();
-				sprintSpring.Reset();
-				sprintSpringLeft.Reset();
-				jumpSpring.Reset();
-				jumpSpringLeft.Reset();
+				traceFlags |= Trace::kBankReset;
+				frame.springBank.ResetAll();
+				frame.previousTickBank.ResetAll();
+				frame.physicsAccumulator = 0.0f;
+				frame.slotAsleep.fill(false);
 				wasInertiaDisabled = true;
 				if (settings->debugLogging) {
 					logger::info("[FPInertia] Inertia disabled for current weapon type - springs reset");
 				}
 			}
+			if (tracing) {
+				RecordTraceFrame(player, inputs, coreSettings, isWeaponDrawn, traceFlags);
+			}
+			if (lateLatch) {
+				lateLatchStep = { inputs, coreSettings, primarySettings.pivotPoint, false };
+				lateLatchPending = true;
+			}
 			return;
 		} else {
 			wasInertiaDisabled = false;
 		}
 		
-		// *** CALCULATE PLAYER MOVEMENT FIRST ***
-		// This must happen before spring updates so movement data is available
-		CalculateLocalMovement(player, a_delta);
-		
-		// *** CHECK SPRINT STATE ***
-		wasSprinting = isSprinting;
-		isSprinting = player->AsActorState()->IsSprinting();
-		
-		// *** CHECK JUMP/AIR STATE ***
-		wasInAir = isInAir;
-		
-		// Check if player is in the air (jumping or falling)
-		bool currentlyInAir = player->IsInMidair();
-		
-		// Update landing cooldown
-		if (landingCooldown > 0.0f) {
-			landingCooldown -= a_delta;
-		}
-		
-		// Track air time for landing impulse scaling
-		if (currentlyInAir && !wasInAir) {
-			// Just left ground - reset air time
-			// Detect if player jumped vs fell by checking behavior graph "bInJumpState"
-			// This is set by the game when the player actually presses jump
-			bool inJumpState = false;
-			player->GetGraphVariableBool("bInJumpState", inJumpState);
-			didJump = inJumpState;
-			airTime = 0.0f;
-		}
-		
-		if (currentlyInAir) {
-			airTime += a_delta;
-		}
-		
-		// Check for landing via behavior graph state (more reliable than IsInMidair transition)
-		// SBF_ReadyStart triggers when the landing animation begins
-		bool landingDetected = false;
-		if (!currentlyInAir && wasInAir && landingCooldown <= 0.0f) {
-			// Also check for SBF_ReadyStart for more accurate landing detection
-			bool readyStart = false;
-			if (player->GetGraphVariableBool("SBF_ReadyStart", readyStart) && readyStart) {
-				landingDetected = true;
-				landingCooldown = 0.25f;  // Prevent multiple triggers
-			} else {
-				// Fallback: if we just transitioned from air to ground, count it as landing
-				landingDetected = true;
-				landingCooldown = 0.25f;
-			}
-		}
-		
-		isInAir = currentlyInAir;
-		
-		// Blend movement inertia out while in air, back in when grounded
-		constexpr float AIR_BLEND_SPEED = 8.0f;  // How fast to blend in/out
-		float airBlendTarget = isInAir ? 0.0f : 1.0f;
-		float airBlendDelta = AIR_BLEND_SPEED * a_delta;
-		if (movementAirBlend < airBlendTarget) {
-			movementAirBlend = std::min(movementAirBlend + airBlendDelta, airBlendTarget);
-		} else if (movementAirBlend > airBlendTarget) {
-			movementAirBlend = std::max(movementAirBlend - airBlendDelta, airBlendTarget);
-		}
-		
-		// Blend camera inertia to configurable multiplier while in air
-		float cameraAirTarget = isInAir ? primarySettings.cameraInertiaAirMult : 1.0f;
-		if (cameraAirBlend < cameraAirTarget) {
-			cameraAirBlend = std::min(cameraAirBlend + airBlendDelta, cameraAirTarget);
-		} else if (cameraAirBlend > cameraAirTarget) {
-			cameraAirBlend = std::max(cameraAirBlend - airBlendDelta, cameraAirTarget);
-		}
-		
-		// *** DETECT CURRENT STANCE ***
-		// Get current stance from stance mods (Stances NG, Dynamic Weapon Movesets)
-		// This affects the global intensity multiplier for all inertia
-		previousStance = currentStance;
-		currentStance = GetCurrentStance();
-		
-		// Get stance multiplier from per-weapon settings
-		float stanceMultiplier = primarySettings.stanceMultipliers[static_cast<size_t>(currentStance)];
-
-		// Get stance-specific invert overrides (when true, XOR with base invert settings)
-		bool stanceInvertCamera = primarySettings.stanceInvertCamera[static_cast<size_t>(currentStance)];
-		bool stanceInvertMovement = primarySettings.stanceInvertMovement[static_cast<size_t>(currentStance)];
-		
 		// Log stance changes (debug only)
-		if (settings->debugLogging && currentStance != previousStance) {
+		if (settings->debugLogging && inputs.stance != frame.currentStance) {
+			float stanceMultiplier = compiledProfile.stances[static_cast<size_t>(inputs.stance)].multiplier;
+			bool stanceInvertCamera = primarySettings.stanceInvertCamera[static_cast<size_t>(inputs.stance)];
+			bool stanceInvertMovement = primarySettings.stanceInvertMovement[static_cast<size_t>(inputs.stance)];
 			logger::info("[FPInertia] Stance changed: {} -> {} (mult: {:.2f}, invertCam: {}, invertMov: {})",
-				GetStanceName(previousStance), GetStanceName(currentStance), stanceMultiplier,
+				GetStanceName(frame.currentStance), GetStanceName(inputs.stance), stanceMultiplier,
 				stanceInvertCamera ? "yes" : "no", stanceInvertMovement ? "yes" : "no");
 		}
 		
-		// *** UPDATE CAMERA SPRING ***
-		// Responds to camera rotation (looking around) - uses per-weapon settings
-		// Multiply intensity by equipBlendFactor so springs decay when weapon is sheathed
-		// Also apply stance multiplier for per-stance intensity adjustment
-		// This prevents built-up spring state from suddenly appearing when drawing a weapon
-		float cameraIntensity = actionBlendFactor * equipBlendFactor * stanceMultiplier;
-		UpdateSpring(cameraSpring, primarySettings, smoothedCameraVelocity, a_delta, cameraIntensity, stanceInvertCamera);
-		
-		// *** UPDATE MOVEMENT SPRING (SEPARATE) ***
-		// Responds to player strafing - uses per-weapon movement spring settings
-		// Also uses equipBlendFactor to decay when weapon is sheathed
-		// Also apply stance multiplier for per-stance intensity adjustment
-		float movementIntensity = actionBlendFactor * equipBlendFactor * stanceMultiplier;
-		UpdateMovementSpring(movementSpring, settings, primarySettings, smoothedLocalMovement, a_delta, movementIntensity, stanceInvertMovement);
-		
-		// *** UPDATE LEFT HAND SPRINGS (for dual clavicle pivot modes) ***
+		// *** LEFT HAND SPRINGS (for dual clavicle pivot modes) ***
 		// Only use clavicle pivots (4 or 5) if we're actually in dual wield mode
 		// If a non-dual-wield type has pivot 4/5 set (by mistake or from config), force it back to Chest (0)
 		bool useDualClaviclePivot = (primarySettings.pivotPoint == 4 || primarySettings.pivotPoint == 5) && isDualWieldMode;
+		inputs.dualClavicle = useDualClaviclePivot;
 		
 		// Log dual wield settings being applied (once per frame batch)
 		static bool loggedDualWieldSettings = false;
@@ -1659,130 +1016,70 @@ namespace Inertia
 			loggedPivotFallback = false;
 		}
 		
-		if (useDualClaviclePivot) {
-			// Update left hand springs independently
-			// They use the same input but maintain separate state for natural asymmetry
-			UpdateSpring(cameraSpringLeft, primarySettings, smoothedCameraVelocity, a_delta, cameraIntensity, stanceInvertCamera);
-			UpdateMovementSpring(movementSpringLeft, settings, primarySettings, smoothedLocalMovement, a_delta, movementIntensity, stanceInvertMovement);
+		// Avoided-update stats, reported once per second
+		avoidedStatsTimer += a_delta;
+		if (avoidedStatsTimer >= 1.0f) {
+			const float avoidedPerSecond = static_cast<float>(frame.avoidedUpdates) / avoidedStatsTimer;
+			const int sleeping = Core::CountSleepingSlots(frame);
+			avoidedUpdatesPerSecond.store(avoidedPerSecond, std::memory_order_relaxed);
+			sleepingSlotCount.store(sleeping, std::memory_order_relaxed);
+			if (settings->debugLogging) {
+				logger::info("[FPInertia] Spring sleep: {} of {} slots asleep, {:.0f} slot updates/sec avoided",
+					sleeping, SpringBank::kSlotCount, avoidedPerSecond);
+			}
+			frame.avoidedUpdates = 0;
+			avoidedStatsTimer = 0.0f;
+		}
+		
+		// Camera stability limits assume fully settled damping - rebuild if the multiplier was changed
+		if (compiledProfile.stabilitySettleDampingMult != coreSettings.settleDampingMult) {
+			CompileWeaponProfile();
+		}
+		
+		// *** STEP SPRINGS ***
+		// Stages every awake spring (camera, movement, sprint, jump and their left hand twins),
+		// integrates them and combines each hand additively. Nothing awake -> nothing to apply.
+		// Frame-gen compatible: the result is stored for application in the UpdateFirstPerson hook,
+		// so offsets are applied AFTER the game's animation system updates
+		// Late latch leaves the step to OnFirstPersonUpdate; worker thread mode runs it alongside the
+		// game's animation update and the hook joins it. Traces record the stepped state right here,
+		// so recording keeps the inline step.
+		if (lateLatch) {
+			lateLatchStep = { inputs, coreSettings, primarySettings.pivotPoint, true };
+			lateLatchPending = true;
+			return;  // The spring logging below reads the stepped state, which doesn't exist yet
+		}
+		if (settings->workerThread && !tracing) {
+			frameWorker.Submit(frame, { inputs, coreSettings, compiledProfile, primarySettings.pivotPoint });
+			return;  // The spring logging below reads frame, which is the worker's until the join
+		}
+		Core::StageTimes stageTimes;
+		Core::StepSprings(frame, inputs, coreSettings, compiledProfile, deferredOffsets, &stageTimes);
+		PerfStats::GetSingleton()->RecordStages(stageTimes);
+		if (tracing) {
+			RecordTraceFrame(player, inputs, coreSettings, isWeaponDrawn, Trace::kCameraPrimed | Trace::kSpringsStepped);
+		}
+		if (!deferredOffsets.hasOffsets) {
+			return;
 		}
+		poseBuffer.Publish(Core::MakePose(deferredOffsets, primarySettings.pivotPoint));
 		
-		// Log spring intensities and output periodically while blending (debug only)
-		if (settings->debugLogging) {
-			static int springLogCounter = 0;
-			springLogCounter++;
-			if (springLogCounter % 30 == 0 && (equipBlendFactor > 0.001f && equipBlendFactor < 0.999f)) {
-				logger::info("[FPInertia] Spring intensity: action={:.3f}, equip={:.3f}, camera={:.3f}, movement={:.3f}",
-					actionBlendFactor, equipBlendFactor, cameraIntensity, movementIntensity);
-				logger::info("[FPInertia] Movement spring: pos=({:.3f},{:.3f},{:.3f}), vel=({:.3f},{:.3f},{:.3f})",
-					movementSpring.positionOffset.x, movementSpring.positionOffset.y, movementSpring.positionOffset.z,
-					movementSpring.positionVelocity.x, movementSpring.positionVelocity.y, movementSpring.positionVelocity.z);
+		// Log spring intensities and output periodically while blending (trace level)
+		if constexpr (Diagnostics::kTrace) {
+			if (settings->debugLogging) {
+				static int springLogCounter = 0;
+				springLogCounter++;
+				if (springLogCounter % 30 == 0 && (frame.equipBlendFactor > 0.001f && frame.equipBlendFactor < 0.999f)) {
+					const SpringState movementSpring = Core::ReadSpring(frame.springBank, SpringSlot::kMovement);
+					logger::info("[FPInertia] Spring intensity: action={:.3f}, equip={:.3f}, camera={:.3f}, movement={:.3f}",
+						frame.actionBlendFactor, frame.equipBlendFactor, frame.cameraIntensity, frame.movementIntensity);
+					logger::info("[FPInertia] Movement spring: pos=({:.3f},{:.3f},{:.3f}), vel=({:.3f},{:.3f},{:.3f})",
+						movementSpring.positionOffset.x, movementSpring.positionOffset.y, movementSpring.positionOffset.z,
+						movementSpring.positionVelocity.x, movementSpring.positionVelocity.y, movementSpring.positionVelocity.z);
+				}
 			}
 		}
 		
-		// *** UPDATE SPRINT SPRING ***
-		// Applies impulse on sprint transitions, then spring settles
-		UpdateSprintSpring(sprintSpring, primarySettings, isSprinting, wasSprinting,
-			sprintImpulseBlendProgress, sprintImpulseBlendDuration,
-			sprintPendingPosImpulse, sprintPendingRotImpulse, a_delta);
-		
-		// *** UPDATE JUMP SPRING ***
-		// Applies impulse on jump and landing with air time scaling
-		UpdateJumpSpring(jumpSpring, primarySettings, isInAir, wasInAir, didJump, airTime, landingDetected,
-			currentJumpStiffness, currentJumpDamping, a_delta);
-		
-		// Update left hand sprint and jump springs for dual clavicle pivot mode
-		if (useDualClaviclePivot) {
-			// Left hand sprint spring (uses same state tracking as right hand)
-			float sprintBlendProgressLeft = sprintImpulseBlendProgress;  // Share progress but maintain separate spring state
-			float sprintBlendDurationLeft = sprintImpulseBlendDuration;
-			RE::NiPoint3 sprintPosImpulseLeft = sprintPendingPosImpulse;
-			RE::NiPoint3 sprintRotImpulseLeft = sprintPendingRotImpulse;
-			UpdateSprintSpring(sprintSpringLeft, primarySettings, isSprinting, wasSprinting,
-				sprintBlendProgressLeft, sprintBlendDurationLeft,
-				sprintPosImpulseLeft, sprintRotImpulseLeft, a_delta);
-			
-			// Left hand jump spring
-			float jumpStiffnessLeft = currentJumpStiffness;
-			float jumpDampingLeft = currentJumpDamping;
-			UpdateJumpSpring(jumpSpringLeft, primarySettings, isInAir, wasInAir, didJump, airTime, landingDetected,
-				jumpStiffnessLeft, jumpDampingLeft, a_delta);
-		}
-		
-		// *** COMBINE SPRINGS ADDITIVELY ***
-		// Camera (blended by air mult), movement (blended out in air), sprint, and jump inertia all contribute
-		// Movement inertia is blended out while in air to prevent ground-based sway during jumps
-		// Camera inertia is dampened while in air based on cameraInertiaAirMult setting
-		// Both camera and movement inertia are also blended by equipBlendFactor during equip/holster
-		
-		// Check if both camera AND movement are active simultaneously
-		// Apply per-weapon scaling multipliers when both are active, with smooth blend
-		float camMagnitude = std::sqrt(
-			cameraSpring.positionOffset.x * cameraSpring.positionOffset.x +
-			cameraSpring.positionOffset.z * cameraSpring.positionOffset.z +
-			cameraSpring.rotationOffset.x * cameraSpring.rotationOffset.x +
-			cameraSpring.rotationOffset.z * cameraSpring.rotationOffset.z);
-		float movMagnitude = std::sqrt(
-			movementSpring.positionOffset.x * movementSpring.positionOffset.x +
-			movementSpring.positionOffset.y * movementSpring.positionOffset.y +
-			movementSpring.rotationOffset.z * movementSpring.rotationOffset.z);
-		
-		// Calculate smooth blend factors for simultaneous scaling
-		// Blend range: how far above threshold before full scaling applies
-		float activeThreshold = primarySettings.simultaneousThreshold;
-		constexpr float BLEND_RANGE = 1.0f;  // Units above threshold for full blend
-		
-		// Calculate how far above threshold each is (0 = at/below threshold, 1 = fully above blend range)
-		float camAboveThreshold = std::clamp((camMagnitude - activeThreshold) / BLEND_RANGE, 0.0f, 1.0f);
-		float movAboveThreshold = std::clamp((movMagnitude - activeThreshold) / BLEND_RANGE, 0.0f, 1.0f);
-		
-		// Both must be above threshold - use minimum as the limiting factor
-		// This means scaling only applies when BOTH are active, and blends based on the lesser one
-		float simultaneousBlend = camAboveThreshold * movAboveThreshold;
-		
-		// Smoothstep for more natural feel (ease in/out)
-		simultaneousBlend = simultaneousBlend * simultaneousBlend * (3.0f - 2.0f * simultaneousBlend);
-		
-		// Interpolate from 1.0 (no scaling) toward target mult based on blend
-		float camSimultaneousMult = 1.0f + (primarySettings.simultaneousCameraMult - 1.0f) * simultaneousBlend;
-		float movSimultaneousMult = 1.0f + (primarySettings.simultaneousMovementMult - 1.0f) * simultaneousBlend;
-		
-		SpringState combinedState;
-		combinedState.positionOffset = {
-			(cameraSpring.positionOffset.x * cameraAirBlend * equipBlendFactor * camSimultaneousMult) + (movementSpring.positionOffset.x * movementAirBlend * equipBlendFactor * movSimultaneousMult) + sprintSpring.positionOffset.x + jumpSpring.positionOffset.x,
-			(cameraSpring.positionOffset.y * cameraAirBlend * equipBlendFactor * camSimultaneousMult) + (movementSpring.positionOffset.y * movementAirBlend * equipBlendFactor * movSimultaneousMult) + sprintSpring.positionOffset.y + jumpSpring.positionOffset.y,
-			(cameraSpring.positionOffset.z * cameraAirBlend * equipBlendFactor * camSimultaneousMult) + (movementSpring.positionOffset.z * movementAirBlend * equipBlendFactor * movSimultaneousMult) + sprintSpring.positionOffset.z + jumpSpring.positionOffset.z
-		};
-		combinedState.rotationOffset = {
-			(cameraSpring.rotationOffset.x * cameraAirBlend * equipBlendFactor * camSimultaneousMult) + (movementSpring.rotationOffset.x * movementAirBlend * equipBlendFactor * movSimultaneousMult) + sprintSpring.rotationOffset.x + jumpSpring.rotationOffset.x,
-			(cameraSpring.rotationOffset.y * cameraAirBlend * equipBlendFactor * camSimultaneousMult) + (movementSpring.rotationOffset.y * movementAirBlend * equipBlendFactor * movSimultaneousMult) + sprintSpring.rotationOffset.y + jumpSpring.rotationOffset.y,
-			(cameraSpring.rotationOffset.z * cameraAirBlend * equipBlendFactor * camSimultaneousMult) + (movementSpring.rotationOffset.z * movementAirBlend * equipBlendFactor * movSimultaneousMult) + sprintSpring.rotationOffset.z + jumpSpring.rotationOffset.z
-		};
-		
-		// Combine left hand springs for dual clavicle pivot mode
-		SpringState combinedStateLeft;
-		if (useDualClaviclePivot) {
-			combinedStateLeft.positionOffset = {
-				(cameraSpringLeft.positionOffset.x * cameraAirBlend * equipBlendFactor * camSimultaneousMult) + (movementSpringLeft.positionOffset.x * movementAirBlend * equipBlendFactor * movSimultaneousMult) + sprintSpringLeft.positionOffset.x + jumpSpringLeft.positionOffset.x,
-				(cameraSpringLeft.positionOffset.y * cameraAirBlend * equipBlendFactor * camSimultaneousMult) + (movementSpringLeft.positionOffset.y * movementAirBlend * equipBlendFactor * movSimultaneousMult) + sprintSpringLeft.positionOffset.y + jumpSpringLeft.positionOffset.y,
-				(cameraSpringLeft.positionOffset.z * cameraAirBlend * equipBlendFactor * camSimultaneousMult) + (movementSpringLeft.positionOffset.z * movementAirBlend * equipBlendFactor * movSimultaneousMult) + sprintSpringLeft.positionOffset.z + jumpSpringLeft.positionOffset.z
-			};
-			combinedStateLeft.rotationOffset = {
-				(cameraSpringLeft.rotationOffset.x * cameraAirBlend * equipBlendFactor * camSimultaneousMult) + (movementSpringLeft.rotationOffset.x * movementAirBlend * equipBlendFactor * movSimultaneousMult) + sprintSpringLeft.rotationOffset.x + jumpSpringLeft.rotationOffset.x,
-				(cameraSpringLeft.rotationOffset.y * cameraAirBlend * equipBlendFactor * camSimultaneousMult) + (movementSpringLeft.rotationOffset.y * movementAirBlend * equipBlendFactor * movSimultaneousMult) + sprintSpringLeft.rotationOffset.y + jumpSpringLeft.rotationOffset.y,
-				(cameraSpringLeft.rotationOffset.z * cameraAirBlend * equipBlendFactor * camSimultaneousMult) + (movementSpringLeft.rotationOffset.z * movementAirBlend * equipBlendFactor * movSimultaneousMult) + sprintSpringLeft.rotationOffset.z + jumpSpringLeft.rotationOffset.z
-			};
-		}
-		
-		// *** STORE OFFSETS FOR DEFERRED APPLICATION ***
-		// Frame-gen compatible: Store computed offsets for application in UpdateFirstPerson hook
-		// This ensures offsets are applied AFTER the game's animation system updates
-		
-		deferredOffsets.hasOffsets = true;
-		deferredOffsets.useDualClaviclePivot = useDualClaviclePivot;
-		deferredOffsets.combinedState = combinedState;
-		deferredOffsets.combinedStateLeft = combinedStateLeft;
-		deferredOffsets.settings = primarySettings;
-		
 		// Debug logging (offset computation, not application)
 		if (settings->debugLogging && debugFrameCounter == 1) {
 			if (useDualClaviclePivot) {
@@ -1800,13 +1097,14 @@ namespace Inertia
 			}
 		}
 		
-		// Debug logging
-		if (settings->debugLogging) {
-			if (debugFrameCounter % 30 == 0) {  // Log every 30 frames (~0.5 sec at 60fps)
+		// Spring output dump (trace level)
+		if constexpr (Diagnostics::kTrace) {
+			if (settings->debugLogging && debugFrameCounter % 30 == 0) {  // Log every 30 frames (~0.5 sec at 60fps)
+				const SpringState& combinedState = deferredOffsets.combinedState;
 				const char* nodeType = useDualClaviclePivot ? (primarySettings.pivotPoint == 5 ? "BothClaviclesOffset" : "BothClavicles") : (isTwoHanded ? "Spine" : "Root");
 				logger::info("[FPInertia] Node: {} | Delta: {:.4f}s | CamVel: ({:.2f}, {:.2f}, {:.2f}) | PosOff: ({:.3f}, {:.3f}, {:.3f}) | RotOff: ({:.2f}, {:.2f}, {:.2f}) deg",
 					nodeType, a_delta,
-					smoothedCameraVelocity.x, smoothedCameraVelocity.y, smoothedCameraVelocity.z,
+					frame.smoothedCameraVelocity.x, frame.smoothedCameraVelocity.y, frame.smoothedCameraVelocity.z,
 					combinedState.positionOffset.x, combinedState.positionOffset.y, combinedState.positionOffset.z,
 					combinedState.rotationOffset.x * RAD_TO_DEG, combinedState.rotationOffset.y * RAD_TO_DEG, combinedState.rotationOffset.z * RAD_TO_DEG);
 			}
@@ -1817,7 +1115,11 @@ namespace Inertia
 	// Called from UpdateFirstPerson hook which runs after the game's animation system
 	void InertiaManager::OnFirstPersonUpdate(RE::NiAVObject* a_firstPersonObject)
 	{
-		if (!a_firstPersonObject || !deferredOffsets.hasOffsets) {
+		FPI_PERF_SCOPE(kFirstPersonUpdate);
+		FPI_TRACE_ZONE("UpdateFirstPerson hook");
+		Perf::ScopedTicks frameCost(frameCostTicks);
+		
+		if (!a_firstPersonObject) {
 			return;
 		}
 		
@@ -1837,136 +1139,158 @@ namespace Inertia
 			return;
 		}
 		
-		const auto& combinedState = deferredOffsets.combinedState;
-		const auto& combinedStateLeft = deferredOffsets.combinedStateLeft;
-		const auto& primarySettings = deferredOffsets.settings;
-
-		auto* settings = Settings::GetSingleton();
+		// Latest pose Update published (already blended between the last two physics ticks);
+		// each pose is applied once, like the old hasOffsets flag
+		const bool published = poseBuffer.Acquire();
+		if (published) {
+			lastAppliedPose = poseBuffer.Front();
+		}
+		
+		// Late latch: this frame's step happens here, with the camera sampled as late as possible
+		// Worker thread mode: this frame's step was submitted by Update - wait for it, but never
+		// past the deadline; a late worker gets the previous pose reapplied and the miss counted
+		if (lateLatchPending) {
+			if (!StepLateLatch(player)) {
+				return;
+			}
+		} else if (frameWorker.IsPending()) {
+			FPI_TRACE_ZONE("Worker join");
+			const auto deadline = std::chrono::duration<float, std::milli>(Settings::GetSingleton()->workerDeadlineMs);
+			if (frameWorker.TryJoin(std::chrono::duration_cast<std::chrono::nanoseconds>(deadline))) {
+				lastAppliedPose = frameWorker.GetPose();
+				PerfStats::GetSingleton()->RecordStages(frameWorker.GetStageTimes());
+			} else {
+				missedWorkerDeadlines.fetch_add(1, std::memory_order_relaxed);
+			}
+		} else if (!published) {
+			return;
+		}
+		const Core::Pose& pose = lastAppliedPose;
+		if (!pose.hasOffsets) {
+			return;
+		}
+		const Core::Pose::Offset& combinedState = pose.right;
+		const Core::Pose::Offset& combinedStateLeft = pose.left;
 		
 		// Check if offsets are significant enough to apply
 		// Skip entirely if offsets are negligible - this preserves particle effects at idle
 		float posMag = std::sqrt(
-			combinedState.positionOffset.x * combinedState.positionOffset.x +
-			combinedState.positionOffset.y * combinedState.positionOffset.y +
-			combinedState.positionOffset.z * combinedState.positionOffset.z);
+			combinedState.position.x * combinedState.position.x +
+			combinedState.position.y * combinedState.position.y +
+			combinedState.position.z * combinedState.position.z);
 		float rotMag = std::sqrt(
-			combinedState.rotationOffset.x * combinedState.rotationOffset.x +
-			combinedState.rotationOffset.y * combinedState.rotationOffset.y +
-			combinedState.rotationOffset.z * combinedState.rotationOffset.z);
+			combinedState.rotation.x * combinedState.rotation.x +
+			combinedState.rotation.y * combinedState.rotation.y +
+			combinedState.rotation.z * combinedState.rotation.z);
 		
 		constexpr float MIN_OFFSET_THRESHOLD = 0.01f;
 		constexpr float MIN_ROT_THRESHOLD = 0.0001f;
 		
 		if (posMag < MIN_OFFSET_THRESHOLD && rotMag < MIN_ROT_THRESHOLD) {
 			// Offsets are negligible, skip modification to preserve effects
-			deferredOffsets.hasOffsets = false;
 			return;
 		}
 		
+		// Per-frame apply logging: trace level, and its own category on top of bDebugLogging
+		const bool logFrames = Diagnostics::kTrace && Settings::GetSingleton()->debugLogging && Settings::GetSingleton()->debugLogFrames;
+		
 		// Apply inertia to spine/clavicle local transforms only
 		// The engine's Update() will handle propagation (called after this in the hook)
 		// This ensures correct motion vectors since we modify BEFORE the engine's Update()
 
-		if (deferredOffsets.useDualClaviclePivot) {
+		if (pose.useDualClaviclePivot) {
 			// Dual clavicle pivot (4 or 5): Apply to both clavicle nodes independently
 			RE::NiNode* rightClavicleNode = GetClavicleNode(fpNode, Hand::kRight);
 			RE::NiNode* leftClavicleNode = GetClavicleNode(fpNode, Hand::kLeft);
 
 			if (rightClavicleNode) {
-				ApplyOffset(rightClavicleNode, combinedState, primarySettings, Hand::kRight);
+				ApplyOffset(rightClavicleNode, combinedState, pose.pivotPoint, Hand::kRight);
 				lastTargetNode = rightClavicleNode;
 			}
 
 			if (leftClavicleNode) {
-				ApplyOffset(leftClavicleNode, combinedStateLeft, primarySettings, Hand::kLeft);
+				ApplyOffset(leftClavicleNode, combinedStateLeft, pose.pivotPoint, Hand::kLeft);
 			}
 		} else {
 			// Standard pivot: Apply to spine node (or other single node)
 			RE::NiNode* targetNode = GetPivotNode(fpNode, player);
 
 			if (!targetNode) {
-				deferredOffsets.hasOffsets = false;
 				return;
 			}
 
 			lastTargetNode = targetNode;
-			logger::info("[FPInertia] Applying skeleton inertia - Node: '{}', Position: ({:.3f}, {:.3f}, {:.3f}), Rotation: ({:.3f}, {:.3f}, {:.3f})",
+			FPI_LOG_TRACE(logFrames,
+				"[FPInertia] Applying skeleton inertia - Node: '{}', Position: ({:.3f}, {:.3f}, {:.3f}), Rotation: ({:.3f}, {:.3f}, {:.3f})",
 				targetNode->name.c_str(),
-				combinedState.positionOffset.x, combinedState.positionOffset.y, combinedState.positionOffset.z,
-				combinedState.rotationOffset.x, combinedState.rotationOffset.y, combinedState.rotationOffset.z);
-			ApplyOffset(targetNode, combinedState, primarySettings);
+				combinedState.position.x, combinedState.position.y, combinedState.position.z,
+				combinedState.rotation.x, combinedState.rotation.y, combinedState.rotation.z);
+			ApplyOffset(targetNode, combinedState, pose.pivotPoint);
 		}
 		
 		// NO UpdateWorldData/Update calls needed - engine handles all propagation
 		// We modify local transforms BEFORE calling original, engine's Update() runs after
 		// This preserves correct previousWorld for motion vectors (TAA, upscaling, frame gen)
 
-		// Log the final skeleton inertia values for reference
-		logger::info("[FPInertia] FINAL: Skeleton inertia applied - Position: ({:.3f}, {:.3f}, {:.3f}), Rotation: ({:.3f}, {:.3f}, {:.3f})",
-			combinedState.positionOffset.x, combinedState.positionOffset.y, combinedState.positionOffset.z,
-			combinedState.rotationOffset.x, combinedState.rotationOffset.y, combinedState.rotationOffset.z);
+		// Log the final skeleton inertia values for reference (per-frame category only)
+		FPI_LOG_TRACE(logFrames,
+			"[FPInertia] FINAL: Skeleton inertia applied - Position: ({:.3f}, {:.3f}, {:.3f}), Rotation: ({:.3f}, {:.3f}, {:.3f})",
+			combinedState.position.x, combinedState.position.y, combinedState.position.z,
+			combinedState.rotation.x, combinedState.rotation.y, combinedState.rotation.z);
 
 		// Log first successful update
 	static bool loggedFirstUpdate = false;
 		if (!loggedFirstUpdate && lastTargetNode) {
-			const char* nodeType = deferredOffsets.useDualClaviclePivot ?
-				(primarySettings.pivotPoint == 5 ? "BothClaviclesOffset" : "BothClavicles") : "Spine";
+			const char* nodeType = pose.useDualClaviclePivot ?
+				(pose.pivotPoint == 5 ? "BothClaviclesOffset" : "BothClavicles") : "Spine";
 			logger::info("[FPInertia] First FP update hook application! Target: {} ({})",
 				nodeType, lastTargetNode->name.c_str());
 			loggedFirstUpdate = true;
 		}
+	}
+
+	bool InertiaManager::StepLateLatch(RE::PlayerCharacter* a_player)
+	{
+		lateLatchPending = false;
 		
-		// Clear the deferred offsets (they've been applied)
-		deferredOffsets.hasOffsets = false;
+		// Yaw/pitch as of now rather than as of the main update hook
+		Core::FrameInputs& inputs = lateLatchStep.inputs;
+		inputs.camera = { a_player->GetAngleZ(), a_player->GetAngleX(), 0.0f };
+		
+		if (!Core::StepCamera(frame, inputs, lateLatchStep.settings)) {
+			logger::info("[FPInertia] First frame initialized, starting inertia updates");
+			return false;
+		}
+		if (!lateLatchStep.stepSprings) {
+			return false;
+		}
+		
+		Core::StageTimes stageTimes;
+		Core::StepSprings(frame, inputs, lateLatchStep.settings, compiledProfile, deferredOffsets, &stageTimes);
+		PerfStats::GetSingleton()->RecordStages(stageTimes);
+		if (!deferredOffsets.hasOffsets) {
+			return false;
+		}
+		lastAppliedPose = Core::MakePose(deferredOffsets, lateLatchStep.pivotPoint);
+		return true;
 	}
 
 	void InertiaManager::Reset()
 	{
 		// Just reset our state - game's animation system will reset transforms naturally
-		cameraSpring.Reset();
-		movementSpring.Reset();
-		sprintSpring.Reset();
-		smoothedCameraVelocity = { 0.0f, 0.0f, 0.0f };
-		prevCameraVelocity = { 0.0f, 0.0f, 0.0f };
-		initialized = false;
+		frame.ResetSprings();
+		traceResetPending = true;
 		lastTargetNode = nullptr;
-		settlingFactor = 0.0f;
-		timeSinceMovement = 0.0f;
-		actionBlendFactor = 1.0f;
+		frame.settlingFactor = 0.0f;
+		frame.timeSinceMovement = 0.0f;
+		frame.actionBlendFactor = 1.0f;
 		wasInAction = false;
 		
 		// Reset equip blend
-		equipBlendFactor = 0.0f;
+		frame.equipBlendFactor = 0.0f;
 		wasWeaponDrawn = false;
 		
-		// Reset movement tracking
-		smoothedLocalMovement = { 0.0f, 0.0f, 0.0f };
-		
-		// Reset sprint state
-		isSprinting = false;
-		wasSprinting = false;
-		sprintImpulseBlendProgress = 0.0f;
-		sprintImpulseBlendDuration = 0.0f;
-		sprintPendingPosImpulse = {0,0,0};
-		sprintPendingRotImpulse = {0,0,0};
-		
-		// Reset jump state
-		isInAir = false;
-		wasInAir = false;
-		didJump = false;
-		airTime = 0.0f;
-		landingCooldown = 0.0f;
-		movementAirBlend = 1.0f;
-		cameraAirBlend = 1.0f;
-		jumpSpring.Reset();
-		currentJumpStiffness = 40.0f;
-		currentJumpDamping = 3.0f;
-		
-		// Reset left hand springs (for dual clavicle pivot)
-		cameraSpringLeft.Reset();
-		movementSpringLeft.Reset();
-		sprintSpringLeft.Reset();
-		jumpSpringLeft.Reset();
+		// Reset dual wield tracking (left hand springs were reset with the bank above)
 		isDualWieldMode = false;
 		currentDualWieldType = WeaponType::Unarmed;
 		
@@ -1976,58 +1300,28 @@ namespace Inertia
 		// Reset cached values (will be refreshed on next update)
 		cachedWeaponFormID = 0;
 		cachedWeaponSettings = nullptr;
-		cachedSettingsVersion = 0;
+		cachedSnapshotGeneration = 0;
 		cachedSpineNode = nullptr;
 		
-		// Reset deferred offsets
+		// Drop a pending pose so it isn't applied after the reset
 		deferredOffsets.hasOffsets = false;
+		ClearPose();
 	}
 
 	void InertiaManager::OnEnterFirstPerson()
 	{
 		isInFirstPerson = true;
-		cameraSpring.Reset();
-		movementSpring.Reset();
-		sprintSpring.Reset();
-		smoothedCameraVelocity = { 0.0f, 0.0f, 0.0f };
-		prevCameraVelocity = { 0.0f, 0.0f, 0.0f };
-		initialized = false;
+		frame.ResetSprings();
+		traceResetPending = true;
 		lastTargetNode = nullptr;
 		debugFrameCounter = 0;
 		hasLoggedSkeleton = false;  // Reset so we log fresh skeleton on next enter
-		settlingFactor = 0.0f;
-		timeSinceMovement = 0.0f;
-		actionBlendFactor = 1.0f;
+		frame.settlingFactor = 0.0f;
+		frame.timeSinceMovement = 0.0f;
+		frame.actionBlendFactor = 1.0f;
 		wasInAction = false;
 		
-		// Reset movement tracking
-		smoothedLocalMovement = { 0.0f, 0.0f, 0.0f };
-		
-		// Reset sprint state
-		isSprinting = false;
-		wasSprinting = false;
-		sprintImpulseBlendProgress = 0.0f;
-		sprintImpulseBlendDuration = 0.0f;
-		sprintPendingPosImpulse = {0,0,0};
-		sprintPendingRotImpulse = {0,0,0};
-		
-		// Reset jump state
-		isInAir = false;
-		wasInAir = false;
-		didJump = false;
-		airTime = 0.0f;
-		landingCooldown = 0.0f;
-		movementAirBlend = 1.0f;
-		cameraAirBlend = 1.0f;
-		jumpSpring.Reset();
-		currentJumpStiffness = 40.0f;
-		currentJumpDamping = 3.0f;
-		
-		// Reset left hand springs (for dual clavicle pivot)
-		cameraSpringLeft.Reset();
-		movementSpringLeft.Reset();
-		sprintSpringLeft.Reset();
-		jumpSpringLeft.Reset();
+		// Reset dual wield tracking (left hand springs were reset with the bank above)
 		isDualWieldMode = false;
 		currentDualWieldType = WeaponType::Unarmed;
 
@@ -2046,53 +1340,22 @@ namespace Inertia
 		isInFirstPerson = false;
 		
 		// Just reset state - game handles transform cleanup naturally
-		cameraSpring.Reset();
-		movementSpring.Reset();
-		sprintSpring.Reset();
-		smoothedCameraVelocity = { 0.0f, 0.0f, 0.0f };
-		prevCameraVelocity = { 0.0f, 0.0f, 0.0f };
-		initialized = false;
+		frame.ResetSprings();
 		lastTargetNode = nullptr;
 		
-		// Reset movement tracking
-		smoothedLocalMovement = { 0.0f, 0.0f, 0.0f };
-		
-		// Reset sprint state
-		isSprinting = false;
-		wasSprinting = false;
-		sprintImpulseBlendProgress = 0.0f;
-		sprintImpulseBlendDuration = 0.0f;
-		sprintPendingPosImpulse = {0,0,0};
-		sprintPendingRotImpulse = {0,0,0};
-		
-		// Reset jump state
-		isInAir = false;
-		wasInAir = false;
-		didJump = false;
-		airTime = 0.0f;
-		landingCooldown = 0.0f;
-		movementAirBlend = 1.0f;
-		cameraAirBlend = 1.0f;
-		jumpSpring.Reset();
-		currentJumpStiffness = 40.0f;
-		currentJumpDamping = 3.0f;
-		
-		// Reset left hand springs (for dual clavicle pivot)
-		cameraSpringLeft.Reset();
-		movementSpringLeft.Reset();
-		sprintSpringLeft.Reset();
-		jumpSpringLeft.Reset();
+		// Reset dual wield tracking (left hand springs were reset with the bank above)
 		isDualWieldMode = false;
 		currentDualWieldType = WeaponType::Unarmed;
 		
 		// Reset cached values (skeleton may change)
 		cachedWeaponFormID = 0;
 		cachedWeaponSettings = nullptr;
-		cachedSettingsVersion = 0;
+		cachedSnapshotGeneration = 0;
 		cachedSpineNode = nullptr;
 		
 		// Reset deferred offsets
 		deferredOffsets.hasOffsets = false;
+		ClearPose();
 		
 		logger::info("[FPInertia] Exited first person - inertia system deactivated");
 	}
@@ -2304,6 +1567,9 @@ namespace Inertia
 		dwmLowPerk = nullptr;
 		stancesInitialized = false;
 		
+		// The loaded game may run at a different frame rate - don't judge hitches by the old one
+		frameClock.Reset();
+		
 		InitStances();
 	}
 
@@ -2335,33 +1601,40 @@ namespace Inertia
 				// Call original first - this ensures game state is updated before we modify it
 				_originalUpdate();
 				
-				// Rate limit updates to prevent issues with frame generation
-				// Frame gen can cause our hook to be called multiple times per actual frame
-				static auto lastUpdateTime = std::chrono::steady_clock::now();
-				auto currentTime = std::chrono::steady_clock::now();
-				float timeSinceLastUpdate = std::chrono::duration<float>(currentTime - lastUpdateTime).count();
-				
-				// Minimum 5ms between updates (200fps cap) to avoid frame gen issues
-				constexpr float MIN_UPDATE_INTERVAL = 0.005f;
-				if (timeSinceLastUpdate < MIN_UPDATE_INTERVAL) {
-					return; // Skip this update, too soon after the last one
-				}
+				FPI_PERF_SCOPE(kMainUpdate);
+				FPI_TRACE_ZONE("Main update hook");
 				
-				// Use the actual time since last update as delta
-				float delta = timeSinceLastUpdate;
-				lastUpdateTime = currentTime;
+				// Take an INI hot reload the watcher thread has parsed since the last frame
+				SettingsWatcher::GetSingleton()->ApplyPending();
 				
-				// Clamp to reasonable values
-				delta = std::clamp(delta, MIN_UPDATE_INTERVAL, 0.1f);
+				auto* settings = Settings::GetSingleton();
 				
-				// Check for INI hot reload
-				Settings::GetSingleton()->CheckForReload(delta);
+				// Frame time and frame number from the engine: a second call within the same engine
+				// frame (frame generation) is skipped however close together the calls are, and
+				// loading / alt-tab spikes step one typical frame instead of the whole spike
+				auto* graphicsState = RE::BSGraphics::State::GetSingleton();
+				if (!graphicsState) {
+					return;
+				}
+				auto* inertia = InertiaManager::GetSingleton();
+				const FrameClock::Tick tick = inertia->AdvanceFrameClock(graphicsState->frameCount, *g_deltaTimeRealTime);
+				if (!tick.update) {
+					return;
+				}
+				if (tick.hitch && settings->debugLogging) {
+					logger::info("[FPInertia] Frame hitch: {:.1f} ms frame stepped as {:.1f} ms",
+						tick.rawDelta * 1000.0f, tick.delta * 1000.0f);
+				}
+				const float delta = tick.delta;
 				
 				// Update inertia - calculates spring physics and stores deferred offsets
-				InertiaManager::GetSingleton()->Update(delta);
+				inertia->Update(delta);
 			}
 
 			static inline REL::Relocation<decltype(OnUpdate)> _originalUpdate;
+			
+			// Engine frame time in real seconds (not scaled by slow time / kill cams)
+			static inline REL::Relocation<float*> g_deltaTimeRealTime{ RELOCATION_ID(523661, 410200) };
 		};
 		
 		// UpdateFirstPerson hook - applies deferred offsets AFTER animations
@@ -2412,6 +1685,9 @@ namespace Inertia
 		// Allocate trampoline space for both hooks
 		SKSE::GetTrampoline().create(128);
 		
+		// Calibrate the perf timer now (~2ms busy wait) rather than in the first hooked frame
+		logger::info("[FPInertia] Perf timer: {:.4f} ns/tick", Perf::NsPerTick());
+		
 		Hook::MainUpdateHook::Install();
 		Hook::UpdateFirstPersonHook::Install();
 		logger::info("FP Inertia system installed (frame-gen compatible)");
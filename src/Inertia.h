@@ -2,39 +2,14 @@
 
 #include "Settings.h"
 #include "InertiaPresets.h"
+#include "InertiaFrame.h"
+#include "FrameClock.h"
+#include "FrameWorker.h"
+#include "Telemetry.h"
+#include "TripleBuffer.h"
 
 namespace Inertia
 {
-	// Spring state for tracking inertia
-	struct SpringState
-	{
-		// Position offset (local space)
-		RE::NiPoint3 positionOffset{ 0.0f, 0.0f, 0.0f };
-		RE::NiPoint3 positionVelocity{ 0.0f, 0.0f, 0.0f };
-		
-		// Rotation offset (euler angles in radians)
-		RE::NiPoint3 rotationOffset{ 0.0f, 0.0f, 0.0f };
-		RE::NiPoint3 rotationVelocity{ 0.0f, 0.0f, 0.0f };
-		
-		void Reset()
-		{
-			positionOffset = { 0.0f, 0.0f, 0.0f };
-			positionVelocity = { 0.0f, 0.0f, 0.0f };
-			rotationOffset = { 0.0f, 0.0f, 0.0f };
-			rotationVelocity = { 0.0f, 0.0f, 0.0f };
-		}
-	};
-
-	// Combat stance types (from Dynamic Weapon Movesets or Stances NG)
-	enum class Stance : int
-	{
-		Neutral = 0,
-		Low = 1,
-		Mid = 2,
-		High = 3,
-		COUNT = 4  // For array sizing
-	};
-
 	// Hand tracking for dual wielding
 	enum class Hand
 	{
@@ -53,7 +28,12 @@ namespace Inertia
 		}
 
 		void Update(float a_delta);
-		void Reset();
+		
+		// Main update hook: the delta for this engine frame (see FrameClock); reset on save load
+		FrameClock::Tick AdvanceFrameClock(std::uint32_t a_frame, float a_engineDelta) { return frameClock.Advance(a_frame, a_engineDelta); }
+		
+		// Reset the springs and blends; from the menu, takes effect at the start of the next Update()
+		void RequestReset() { resetPending.store(true, std::memory_order_release); }
 		
 		// Called when entering/exiting first person
 		void OnEnterFirstPerson();
@@ -64,6 +44,19 @@ namespace Inertia
 		
 		// Called when a save game is loaded (initializes stance detection)
 		void OnSaveLoaded();
+		
+		// Sleep stats for the menu: spring slot updates skipped per second while at rest
+		float GetAvoidedUpdatesPerSecond() const { return avoidedUpdatesPerSecond.load(std::memory_order_relaxed); }
+		int GetSleepingSlotCount() const { return sleepingSlotCount.load(std::memory_order_relaxed); }
+		
+		// Worker thread stats for the menu: times the hook gave up waiting and reused the last pose
+		std::uint32_t GetMissedWorkerDeadlines() const { return missedWorkerDeadlines.load(std::memory_order_relaxed); }
+		
+		// Per-frame history for the on-screen overlay (copy it with CopyTo from any thread)
+		const Core::TelemetryRing& GetTelemetry() const { return telemetry; }
+		
+		// Derived coefficients and spring stability limits for one weapon's settings
+		static void CompileProfile(const WeaponInertiaSettings& a_weapon, float a_settleDampingMult, CompiledWeaponProfile& a_profile);
 
 	private:
 		InertiaManager() = default;
@@ -73,6 +66,9 @@ namespace Inertia
 		InertiaManager& operator=(const InertiaManager&) = delete;
 		InertiaManager& operator=(InertiaManager&&) = delete;
 
+		// Game thread only - frame may be on loan to the worker until Update's join
+		void Reset();
+		
 		// Get the first person arm/hand node
 		RE::NiNode* GetFirstPersonNode();
 		
@@ -105,29 +101,23 @@ namespace Inertia
 		
 		// Apply inertia to enchantment effects attached to weapons
 		
-		// Update spring physics
-		// Optional stance invert overrides: when true, XOR with base invert settings
-		void UpdateSpring(SpringState& a_state, const WeaponInertiaSettings& a_settings, 
-			const RE::NiPoint3& a_cameraVelocity, float a_delta, float a_multiplier,
-			bool a_stanceInvertCamera = false);
-		
 		// Apply offset to node (a_hand parameter used for pivot 5 side-specific compensation)
-		void ApplyOffset(RE::NiNode* a_node, const SpringState& a_state, 
-			const WeaponInertiaSettings& a_settings, Hand a_hand = Hand::kRight);
+		void ApplyOffset(RE::NiNode* a_node, const Core::Pose::Offset& a_offset, 
+			int a_pivotPoint, Hand a_hand = Hand::kRight);
 		
-		// Calculate camera velocity from rotation changes
-		RE::NiPoint3 CalculateCameraVelocity(float a_delta);
-
-		// Spring states - SEPARATE for camera and movement inertia
-		// These are ADDITIVE - both contribute to final offset
-		SpringState cameraSpring;      // Camera rotation-based inertia (single or right hand)
-		SpringState movementSpring;    // Player movement-based inertia (single or right hand)
+		// Engine frame timing, advanced by the main update hook before Update()
+		FrameClock frameClock;
+		
+		// Physics state carried between frames (spring bank, camera tracking, blends, sprint/jump state)
+		// Update() gathers Core::FrameInputs from the game and steps this through the core
+		// Left hand slots are only staged when pivot is dual clavicle mode (pivot 4 or 5, dual wield types)
+		Core::FrameState frame;
 		
-		// Left hand springs - used when pivot is dual clavicle mode (pivot 4 or 5, dual wield types)
-		SpringState cameraSpringLeft;    // Left hand camera inertia
-		SpringState movementSpringLeft;  // Left hand movement inertia
-		SpringState sprintSpringLeft;    // Left hand sprint inertia
-		SpringState jumpSpringLeft;      // Left hand jump inertia
+		// Sleep stats - slot updates skipped while at rest (frame.avoidedUpdates), reported per second
+		// The results are published for the menu, which can't read frame itself
+		float avoidedStatsTimer{ 0.0f };                     // Length of the current stats window (seconds)
+		std::atomic<float> avoidedUpdatesPerSecond{ 0.0f };  // Result of the last completed window
+		std::atomic<int> sleepingSlotCount{ 0 };             // Slots asleep at the end of that window
 		
 		// Dual wield tracking
 		bool isDualWieldMode{ false };     // True when using dual clavicle pivot (4 or 5)
@@ -136,81 +126,85 @@ namespace Inertia
 		// Master enable state tracking (for spring reset on disable)
 		bool wasInertiaDisabled{ false };
 		
-		// Previous camera rotation for velocity calculation
-		float lastCameraYaw{ 0.0f };
-		float lastCameraPitch{ 0.0f };
-		float lastCameraRoll{ 0.0f };
-		
-		// Smoothed camera velocity
-		RE::NiPoint3 smoothedCameraVelocity{ 0.0f, 0.0f, 0.0f };
-		
 		// State tracking
 		bool isInFirstPerson{ false };
-		bool initialized{ false };
 		
 		// Track which node we're modifying (for debug/logging)
 		RE::NiNode* lastTargetNode{ nullptr };
 		
-		// Settling system - increased damping when camera stops moving
-		float settlingFactor{ 0.0f };      // 0 = full spring, 1 = heavily damped (settling)
-		float timeSinceMovement{ 0.0f };   // How long since camera was moving
-		
-		// Action blending - reduce intensity during attacks/bow draw/spells
-		float actionBlendFactor{ 1.0f };   // 1 = full intensity, 0 = minimum intensity
-		bool wasInAction{ false };         // Track previous action state
-		
-		// Equip/holster blending - smooth transition when drawing/sheathing weapon
-		float equipBlendFactor{ 0.0f };    // 0 = sheathed, 1 = fully drawn
-		bool wasWeaponDrawn{ false };      // Track previous weapon drawn state
-		
-		// Movement-based inertia - uses player input directly
-		RE::NiPoint3 smoothedLocalMovement{ 0.0f, 0.0f, 0.0f };      // Smoothed local movement velocity
-		
-		// Sprint transition inertia state
-		bool isSprinting{ false };
-		bool wasSprinting{ false };
-		float sprintImpulseBlendProgress{ 0.0f };  // Current blend progress (0-1)
-		float sprintImpulseBlendDuration{ 0.0f };  // Total blend duration for current impulse
-		RE::NiPoint3 sprintPendingPosImpulse{ 0.0f, 0.0f, 0.0f };  // Pending position impulse to blend
-		RE::NiPoint3 sprintPendingRotImpulse{ 0.0f, 0.0f, 0.0f };  // Pending rotation impulse to blend
-		SpringState sprintSpring;          // Sprint transition spring state
-		
-		// Jump/landing inertia state
-		bool isInAir{ false };
-		bool wasInAir{ false };
-		bool didJump{ false };             // True if player jumped (vs just falling)
-		float airTime{ 0.0f };             // Time spent in air (for landing impulse scaling)
-		float landingCooldown{ 0.0f };     // Cooldown to prevent multiple landing impulses
-		float movementAirBlend{ 1.0f };    // Blend factor for movement inertia (0 = in air, 1 = grounded)
-		float cameraAirBlend{ 1.0f };      // Blend factor for camera inertia (blends to cameraInertiaAirMult when in air)
-		SpringState jumpSpring;            // Jump/landing spring state
-		float currentJumpStiffness{ 40.0f };  // Current spring stiffness (changes on land)
-		float currentJumpDamping{ 3.0f };     // Current spring damping (changes on land)
-		
-		// Frame-rate independence: previous frame velocity for clamping
-		RE::NiPoint3 prevCameraVelocity{ 0.0f, 0.0f, 0.0f };
+		// Previous action / weapon drawn state (blend factors live in frame)
+		bool wasInAction{ false };
+		bool wasWeaponDrawn{ false };
 		
 		// Current weapon tracking for preset lookup (cached for performance)
 		std::string currentWeaponEditorID;
 		WeaponType currentWeaponType{ WeaponType::Unarmed };
 		
+		// Presets as of this frame (taken at the start of Update; cachedWeaponSettings points into it)
+		std::shared_ptr<const PresetSnapshot> presetSnapshot;
+		
 		// Cached weapon settings (refreshed when weapon changes, not every frame)
 		RE::FormID cachedWeaponFormID{ 0 };          // FormID of currently equipped weapon (0 if none)
+		std::string currentCustomWeaponType;         // Keyword-based type of the equipped weapon (empty if none)
 		const WeaponInertiaSettings* cachedWeaponSettings{ nullptr };  // Cached settings pointer
-		uint32_t cachedSettingsVersion{ 0 };         // Preset version when cache was built
+		uint32_t cachedSnapshotGeneration{ 0 };      // Preset snapshot the cache was resolved in
+		
+		// Derived coefficients for cachedWeaponSettings (built by CompileWeaponProfile)
+		CompiledWeaponProfile compiledProfile;
+		
+		uint32_t compiledProfileId{ 0 };             // Bumped on every rebuild (trace profile id)
+		
+		// Rebuild compiledProfile from cachedWeaponSettings (and the current settleDampingMult)
+		void CompileWeaponProfile();
 		
 		// Cached spine node (set on first-person enter, avoids string searches every frame)
 		RE::NiNode* cachedSpineNode{ nullptr };
 		
 		// Frame-gen compatible deferred application (computed in Update, applied in OnFirstPersonUpdate)
-		struct DeferredOffsets {
-			bool hasOffsets{ false };           // True if offsets are ready to apply
-			bool useDualClaviclePivot{ false }; // Which pivot mode to use
-			SpringState combinedState;          // Right hand / main spine offsets
-			SpringState combinedStateLeft;      // Left hand offsets (for dual clavicle)
-			WeaponInertiaSettings settings;     // Copy of settings to use for application
+		// deferredOffsets is Update's own output; each result is published to poseBuffer as a compact,
+		// already interpolated pose, and the hook takes the latest complete one (never a torn mix)
+		Core::FrameOutput deferredOffsets;
+		TripleBuffer<Core::Pose> poseBuffer;
+		
+		// Publish "nothing to apply" (springs reset) so a pending pose isn't applied afterwards
+		// Game thread only (the buffer's single producer)
+		void ClearPose() { poseBuffer.Publish(Core::Pose{}); }
+		
+		// Set by RequestReset(), taken by Update once frame is back from the worker
+		std::atomic<bool> resetPending{ false };
+		
+		// Worker thread mode (Settings::workerThread): Update submits the spring step to frameWorker
+		// instead of running it, and OnFirstPersonUpdate joins it with a deadline. frame belongs to the
+		// worker from the submit until the join (Update waits for it before touching frame again).
+		// lastAppliedPose is the hook's copy of the last pose it took, reused when the worker is late.
+		FrameWorker frameWorker;
+		Core::Pose lastAppliedPose;
+		std::atomic<std::uint32_t> missedWorkerDeadlines{ 0 };
+		
+		// Late-latch mode (Settings::lateLatch): Update gathers the frame but leaves the camera and
+		// spring step to OnFirstPersonUpdate, which reads the camera angles again right before applying
+		struct LateLatchStep
+		{
+			Core::FrameInputs inputs;
+			Core::CoreSettings settings;
+			std::int32_t pivotPoint{ 0 };
+			bool stepSprings{ false };   // False while the weapon's inertia is disabled (camera only)
 		};
-		DeferredOffsets deferredOffsets;
+		LateLatchStep lateLatchStep;
+		bool lateLatchPending{ false };  // Set by Update, taken by the next OnFirstPersonUpdate
+		
+		// Run the pending late-latch step with fresh camera angles; false if there is nothing to apply
+		bool StepLateLatch(RE::PlayerCharacter* a_player);
+		
+		// On-screen overlay telemetry (Settings::debugOnScreen) and the CSV capture (TelemetryCapture)
+		// share one sample point. Update pushes one sample per frame
+		// for the previous frame, once its step has finished on whichever path ran it; the overlay
+		// copies the ring from the render thread. frameCostTicks totals Update and
+		// OnFirstPersonUpdate since the last sample.
+		Core::TelemetryRing telemetry;
+		double telemetryTime{ 0.0 };
+		float telemetryDelta{ 0.0f };        // Delta of the frame the next sample describes
+		std::uint64_t frameCostTicks{ 0 };
 		
 		// Get target node based on pivot point setting
 		RE::NiNode* GetPivotNode(RE::NiNode* a_fpRoot, RE::PlayerCharacter* a_player);
@@ -221,8 +215,10 @@ namespace Inertia
 		// Helper to check if player is in an action that should reduce inertia
 		bool IsPlayerInAction(RE::PlayerCharacter* a_player);
 		
-		// Calculate local movement velocity (relative to camera facing)
-		RE::NiPoint3 CalculateLocalMovement(RE::PlayerCharacter* a_player, float a_delta);
+		// Input trace (see TraceRecorder) - one record per Update() that gathered inputs
+		bool traceResetPending{ false };  // Springs were reset since the last recorded frame
+		void RecordTraceFrame(RE::PlayerCharacter* a_player, const Core::FrameInputs& a_inputs,
+			const Core::CoreSettings& a_coreSettings, bool a_weaponDrawn, std::uint16_t a_flags);
 		
 		// === STANCE DETECTION ===
 		// Stances NG magic effects (detected at runtime after save load)
@@ -239,8 +235,6 @@ namespace Inertia
 		
 		bool stancesInitialized{ false };
 		bool saveLoaded{ false };  // Only initialize stances after a save is loaded
-		Stance currentStance{ Stance::Neutral };
-		Stance previousStance{ Stance::Neutral };
 		
 		// Initialize Stances NG / Dynamic Weapon Movesets integration (call after save load)
 		void InitStances();
@@ -1,4 +1,9 @@
 #include "InertiaPresets.h"
+#include "Inertia.h"
+#include "PresetIO.h"
+#include "SettingsWatcher.h"
+#include "TraceZones.h"
+#include <format>
 #include <fstream>
 #include <sstream>
 #include <algorithm>
@@ -7,6 +12,23 @@
 
 namespace
 {
+	// Read and parse a JSON preset file (any thread); false if it can't be read or parsed
+	bool ReadJsonFile(const std::filesystem::path& a_path, json& a_json)
+	{
+		FPI_TRACE_ZONE("Read preset file");
+		std::string contents;
+		if (!PresetIO::ReadFile(a_path, contents)) {
+			return false;
+		}
+		try {
+			a_json = json::parse(contents);
+			return true;
+		} catch (const std::exception& e) {
+			logger::error("Error parsing {}: {}", a_path.string(), e.what());
+			return false;
+		}
+	}
+
 	struct WeaponTypeInfo
 	{
 		WeaponType type;
@@ -240,10 +262,63 @@ void InertiaPresets::Init()
 	// Ensure custom weapon types from mappings are in the preset
 	EnsureCustomTypesInPreset();
 	
+	// First snapshot for the game thread
+	PublishSnapshot();
+	
 	logger::info("InertiaPresets initialized with preset '{}', {} weapon types, {} custom types, and {} specific weapons",
 		activePresetName, weaponTypeSettings.size(), customWeaponTypeSettings.size(), specificWeaponSettings.size());
 }
 
+const WeaponInertiaSettings& PresetSnapshot::GetWeaponTypeSettings(WeaponType a_type) const
+{
+	static const WeaponInertiaSettings defaultSettings;
+	
+	auto it = weaponTypeSettings.find(WeaponTypeKey{ a_type });
+	return it != weaponTypeSettings.end() ? it->second : defaultSettings;
+}
+
+const WeaponInertiaSettings& PresetSnapshot::GetWeaponSettings(const std::string& a_editorID, const std::string& a_customType, WeaponType a_type) const
+{
+	// Priority 1: Specific weapon by EditorID
+	if (!a_editorID.empty()) {
+		auto it = specificWeaponSettings.find(SpecificWeaponKey{ a_editorID });
+		if (it != specificWeaponSettings.end()) {
+			return it->second;
+		}
+	}
+	
+	// Priority 2: Custom keyword-based weapon type
+	if (!a_customType.empty()) {
+		auto it = customWeaponTypeSettings.find(a_customType);
+		if (it != customWeaponTypeSettings.end()) {
+			return it->second;
+		}
+	}
+	
+	// Priority 3: Standard weapon type preset
+	return GetWeaponTypeSettings(a_type);
+}
+
+void InertiaPresets::PublishSnapshot()
+{
+	FPI_TRACE_ZONE("Publish preset snapshot");
+	auto next = std::make_shared<PresetSnapshot>();
+	{
+		std::shared_lock lock(presetMutex);
+		next->weaponTypeSettings = weaponTypeSettings;
+		next->specificWeaponSettings = specificWeaponSettings;
+		next->customWeaponTypeSettings = customWeaponTypeSettings;
+	}
+	
+	std::lock_guard lock(snapshotMutex);
+	next->generation = ++snapshotGeneration;
+	retiredSnapshots.push_back(snapshot.exchange(std::move(next), std::memory_order_acq_rel));
+	publishedGeneration.store(snapshotGeneration, std::memory_order_release);
+	
+	// Only the retired list still holds these - the game thread has moved on to a newer snapshot
+	std::erase_if(retiredSnapshots, [](const auto& a_retired) { return a_retired.use_count() == 1; });
+}
+
 void InertiaPresets::InitializeDefaultSettings()
 {
 	auto* settings = Settings::GetSingleton();
@@ -284,6 +359,9 @@ void InertiaPresets::ResetToINIValues()
 	InitializeDefaultSettings();
 	isDirty = true;
 	
+	// Maps were rebuilt - the game thread picks them up from the next snapshot
+	PublishSnapshot();
+	
 	logger::info("Reset all presets to INI values");
 }
 
@@ -362,43 +440,6 @@ const WeaponInertiaSettings& InertiaPresets::GetWeaponSettings(const std::string
 	return defaultSettings;
 }
 
-const WeaponInertiaSettings& InertiaPresets::GetWeaponSettingsWithKeywords(const std::string& a_editorID, RE::TESObjectWEAP* a_weapon, WeaponType a_type) const
-{
-	// Priority 1: Specific weapon by EditorID
-	if (!a_editorID.empty()) {
-		std::shared_lock lock(presetMutex);
-		SpecificWeaponKey specificKey{ a_editorID };
-		auto it = specificWeaponSettings.find(specificKey);
-		if (it != specificWeaponSettings.end()) {
-			return it->second;
-		}
-	}
-	
-	// Priority 2: Custom keyword-based weapon type
-	if (a_weapon && !keywordMappings.empty()) {
-		std::string customType = GetBestKeywordMatch(a_weapon);
-		if (!customType.empty()) {
-			std::shared_lock lock(presetMutex);
-			auto it = customWeaponTypeSettings.find(customType);
-			if (it != customWeaponTypeSettings.end()) {
-				return it->second;
-			}
-		}
-	}
-	
-	// Priority 3: Standard weapon type preset
-	{
-		std::shared_lock lock(presetMutex);
-		WeaponTypeKey typeKey{ a_type };
-		auto it = weaponTypeSettings.find(typeKey);
-		if (it != weaponTypeSettings.end()) {
-			return it->second;
-		}
-	}
-	
-	return defaultSettings;
-}
-
 WeaponInertiaSettings& InertiaPresets::GetWeaponSettingsMutable(const std::string& a_editorID, WeaponType a_type)
 {
 	std::shared_lock lock(presetMutex);
@@ -500,23 +541,26 @@ bool InertiaPresets::HasSpecificWeaponSettings(const std::string& a_editorID) co
 
 void InertiaPresets::RemoveSpecificWeaponSettings(const std::string& a_editorID)
 {
-	std::unique_lock lock(presetMutex);
-	SpecificWeaponKey key{ a_editorID };
-	specificWeaponSettings.erase(key);
-	isDirty = true;
+	{
+		std::unique_lock lock(presetMutex);
+		SpecificWeaponKey key{ a_editorID };
+		specificWeaponSettings.erase(key);
+		isDirty = true;
+	}
+	PublishSnapshot();
 	
 	// Also delete the preset file
-	auto path = GetSpecificWeaponPresetPath(a_editorID);
-	if (std::filesystem::exists(path)) {
-		std::filesystem::remove(path);
-		logger::info("Deleted specific weapon preset: {}", path.string());
-	}
+	PresetIO::GetSingleton()->Run([path = GetSpecificWeaponPresetPath(a_editorID)]() -> PresetIO::Completion {
+		std::error_code ec;
+		if (std::filesystem::remove(path, ec)) {
+			logger::info("Deleted specific weapon preset: {}", path.string());
+		}
+		return {};
+	});
 }
 
-void InertiaPresets::SaveWeaponTypePresets()
+json InertiaPresets::BuildWeaponTypePresetJson() const
 {
-	EnsurePresetFolderExists();
-	
 	json j;
 	
 	std::shared_lock lock(presetMutex);
@@ -535,18 +579,17 @@ void InertiaPresets::SaveWeaponTypePresets()
 		j[typeName]["isCustomType"] = true;  // Mark as custom for identification
 	}
 	
-	lock.unlock();
-	
-	auto path = GetWeaponTypePresetsPath();
-	std::ofstream file(path);
-	if (file.is_open()) {
-		file << j.dump(4);
-		file.close();
-		isDirty = false;
-		logger::info("Saved weapon type presets to: {}", path.string());
-	} else {
-		logger::error("Failed to save weapon type presets to: {}", path.string());
-	}
+	return j;
+}
+
+void InertiaPresets::SaveWeaponTypePresets(bool a_notify)
+{
+	FPI_TRACE_ZONE("Save weapon type presets");
+	// Serialized now, written by the preset I/O thread
+	json j = BuildWeaponTypePresetJson();
+	isDirty = false;
+	PresetIO::GetSingleton()->Write(GetWeaponTypePresetsPath(), j.dump(4),
+		a_notify ? std::format("Saved preset '{}'", activePresetName) : std::string{});
 }
 
 void InertiaPresets::LoadWeaponTypePresets()
@@ -556,23 +599,25 @@ void InertiaPresets::LoadWeaponTypePresets()
 		return;
 	}
 	
-	std::ifstream file(path);
-	if (!file.is_open()) {
+	json j;
+	if (!ReadJsonFile(path, j)) {
 		logger::warn("Could not open weapon type presets: {}", path.string());
 		return;
 	}
 	
+	ApplyWeaponTypePresets(j, path);
+}
+
+void InertiaPresets::ApplyWeaponTypePresets(const json& a_json, const std::filesystem::path& a_path)
+{
+	FPI_TRACE_ZONE("Apply weapon type presets");
 	// Track if preset is missing any new fields (needs re-save to update)
 	bool needsResave = false;
 	
 	try {
-		json j;
-		file >> j;
-		file.close();
-		
 		std::unique_lock lock(presetMutex);
 		
-		for (auto& [key, value] : j.items()) {
+		for (auto& [key, value] : a_json.items()) {
 			// Check for new fields that might be missing from older presets
 			// If any are missing, we'll re-save the preset to include them
 			if (!value.contains("enabled")) {
@@ -599,6 +644,7 @@ void InertiaPresets::LoadWeaponTypePresets()
 				customWeaponTypeSettings[key] = value.get<WeaponInertiaSettings>();
 				logger::info("  Loaded custom type {}: stiffness={:.0f}, damping={:.1f}",
 					key, customWeaponTypeSettings[key].stiffness, customWeaponTypeSettings[key].damping);
+				CheckStability(key, customWeaponTypeSettings[key]);
 			} else {
 				// Load as standard weapon type
 				WeaponType type = ParseWeaponTypeName(key);
@@ -622,10 +668,11 @@ void InertiaPresets::LoadWeaponTypePresets()
 				
 				logger::info("  Loaded {}: stiffness={:.0f}, damping={:.1f}",
 					key, weaponTypeSettings[typeKey].stiffness, weaponTypeSettings[typeKey].damping);
+				CheckStability(key, weaponTypeSettings[typeKey]);
 			}
 		}
 		
-		logger::info("Loaded weapon type presets from: {}", path.string());
+		logger::info("Loaded weapon type presets from: {}", a_path.string());
 		
 		// If any new fields were missing, re-save the preset to include them
 		if (needsResave) {
@@ -638,10 +685,9 @@ void InertiaPresets::LoadWeaponTypePresets()
 	}
 }
 
-void InertiaPresets::SaveSpecificWeaponPreset(const std::string& a_editorID)
+void InertiaPresets::SaveSpecificWeaponPreset(const std::string& a_editorID, bool a_notify)
 {
-	EnsurePresetFolderExists();
-	
+	FPI_TRACE_ZONE("Save weapon preset");
 	std::shared_lock lock(presetMutex);
 	SpecificWeaponKey key{ a_editorID };
 	auto it = specificWeaponSettings.find(key);
@@ -654,15 +700,8 @@ void InertiaPresets::SaveSpecificWeaponPreset(const std::string& a_editorID)
 	j["editorID"] = a_editorID;
 	lock.unlock();
 	
-	auto path = GetSpecificWeaponPresetPath(a_editorID);
-	std::ofstream file(path);
-	if (file.is_open()) {
-		file << j.dump(4);
-		file.close();
-		logger::info("Saved specific weapon preset: {}", path.string());
-	} else {
-		logger::error("Failed to save specific weapon preset: {}", path.string());
-	}
+	PresetIO::GetSingleton()->Write(GetSpecificWeaponPresetPath(a_editorID), j.dump(4),
+		a_notify ? std::format("Saved weapon preset '{}'", a_editorID) : std::string{});
 }
 
 void InertiaPresets::LoadSpecificWeaponPreset(const std::string& a_editorID)
@@ -672,33 +711,62 @@ void InertiaPresets::LoadSpecificWeaponPreset(const std::string& a_editorID)
 		return;
 	}
 	
-	std::ifstream file(path);
-	if (!file.is_open()) {
+	json j;
+	if (!ReadJsonFile(path, j)) {
 		return;
 	}
 	
+	ApplySpecificWeaponPreset(a_editorID, j);
+}
+
+void InertiaPresets::ApplySpecificWeaponPreset(const std::string& a_editorID, const json& a_json)
+{
+	FPI_TRACE_ZONE("Apply weapon preset");
 	try {
-		json j;
-		file >> j;
-		file.close();
-		
 		std::string editorID = a_editorID;
-		if (j.contains("editorID")) {
-			editorID = j["editorID"].get<std::string>();
+		if (a_json.contains("editorID")) {
+			editorID = a_json["editorID"].get<std::string>();
 		}
 		
 		std::unique_lock lock(presetMutex);
 		SpecificWeaponKey key{ editorID };
-		specificWeaponSettings[key] = j.get<WeaponInertiaSettings>();
+		specificWeaponSettings[key] = a_json.get<WeaponInertiaSettings>();
 		
 		logger::info("Loaded specific weapon preset: {}", editorID);
+		CheckStability(editorID, specificWeaponSettings[key]);
 	} catch (const std::exception& e) {
 		logger::error("Error loading specific weapon preset {}: {}", a_editorID, e.what());
 	}
 }
 
+void InertiaPresets::CheckStability(const std::string& a_name, const WeaponInertiaSettings& a_settings) const
+{
+	auto* settings = Settings::GetSingleton();
+	Inertia::CompiledWeaponProfile profile;
+	Inertia::InertiaManager::CompileProfile(a_settings, settings->settleDampingMult, profile);
+	
+	// Longest step the bank integrates: one physics tick, or a hitch-length frame without the fixed timestep
+	const Inertia::Core::TimestepConfig timestep{ settings->fixedTimestep, settings->physicsRateHz, settings->maxPhysicsSteps };
+	const float delta = Inertia::Core::StabilityReferenceDelta(timestep);
+	
+	const int integrators[] = { settings->cameraIntegrator, settings->movementIntegrator, settings->sprintIntegrator, settings->jumpIntegrator };
+	const char* springNames[] = { "camera", "movement", "sprint", "jump" };
+	for (size_t i = 0; i < profile.stability.size(); ++i) {
+		const auto& stability = profile.stability[i];
+		const int integrator = std::clamp(integrators[i], 0, Inertia::SpringBank::kIntegratorCount - 1);
+		const int substeps = Inertia::SpringBank::RequiredSubsteps(delta, stability.maxSubstep[integrator]);
+		if (substeps > Inertia::SpringBank::kMaxSubsteps) {
+			logger::warn("  Preset '{}': {} spring (w={:.1f} rad/s, zeta={:.2f}) needs {} substeps per {:.1f} ms step, budget is {} - "
+				"it can go unstable; lower its stiffness/damping or use the Exact or Implicit Euler integrator",
+				a_name, springNames[i], stability.naturalFrequency, stability.dampingRatio, substeps, delta * 1000.0f,
+				Inertia::SpringBank::kMaxSubsteps);
+		}
+	}
+}
+
 void InertiaPresets::LoadAllPresets()
 {
+	FPI_TRACE_ZONE("Load all presets");
 	// Load weapon type presets
 	LoadWeaponTypePresets();
 	
@@ -716,20 +784,53 @@ void InertiaPresets::LoadAllPresets()
 	}
 }
 
+void InertiaPresets::ReloadAllPresets()
+{
+	// Read and parse everything on the I/O thread, then apply in one go on the menu thread
+	auto typesPath = GetWeaponTypePresetsPath();
+	auto weaponsPath = GetPresetFolderPath() / "Weapons";
+	PresetIO::GetSingleton()->Run([this, name = activePresetName, typesPath, weaponsPath]() -> PresetIO::Completion {
+		json types;
+		if (!ReadJsonFile(typesPath, types)) {
+			return { false, std::format("Could not read preset '{}'", name), {} };
+		}
+		
+		std::vector<std::pair<std::string, json>> weapons;
+		std::error_code ec;
+		for (const auto& entry : std::filesystem::directory_iterator(weaponsPath, ec)) {
+			if (entry.is_regular_file() && entry.path().extension() == ".json") {
+				json j;
+				if (ReadJsonFile(entry.path(), j)) {
+					weapons.emplace_back(entry.path().stem().string(), std::move(j));
+				}
+			}
+		}
+		
+		return { true, std::format("Reloaded preset '{}'", name),
+			[this, typesPath, types = std::move(types), weapons = std::move(weapons)]() {
+				ApplyWeaponTypePresets(types, typesPath);
+				for (const auto& [editorID, j] : weapons) {
+					ApplySpecificWeaponPreset(editorID, j);
+				}
+				PublishSnapshot();
+			} };
+	});
+}
+
 std::vector<std::string> InertiaPresets::GetSavedSpecificWeaponPresets() const
 {
+	// Every file in the Weapons folder is loaded at Init and every new preset is created in
+	// memory first, so the map is the list - no need to scan the folder every menu frame
 	std::vector<std::string> presets;
 	
-	auto weaponsPath = GetPresetFolderPath() / "Weapons";
-	if (!std::filesystem::exists(weaponsPath)) {
-		return presets;
+	std::shared_lock lock(presetMutex);
+	presets.reserve(specificWeaponSettings.size());
+	for (const auto& [key, settings] : specificWeaponSettings) {
+		presets.push_back(key.editorID);
 	}
+	lock.unlock();
 	
-	for (const auto& entry : std::filesystem::directory_iterator(weaponsPath)) {
-		if (entry.is_regular_file() && entry.path().extension() == ".json") {
-			presets.push_back(entry.path().stem().string());
-		}
-	}
+	std::sort(presets.begin(), presets.end());
 	
 	return presets;
 }
@@ -762,13 +863,25 @@ void InertiaPresets::SetActivePreset(const std::string& a_name)
 		return;  // Already active
 	}
 	
-	// Check if preset file exists
-	auto path = GetPresetPath(a_name);
-	if (!std::filesystem::exists(path)) {
-		logger::warn("Preset file does not exist: {}", path.string());
-		return;
-	}
-	
+	// Read and parse on the I/O thread; the switch happens when the menu applies the result
+	PresetIO::GetSingleton()->Run([this, name = a_name, path = GetPresetPath(a_name)]() -> PresetIO::Completion {
+		if (!std::filesystem::exists(path)) {
+			logger::warn("Preset file does not exist: {}", path.string());
+			return { false, std::format("Preset '{}' does not exist", name), {} };
+		}
+		
+		json j;
+		if (!ReadJsonFile(path, j)) {
+			return { false, std::format("Could not read preset '{}'", name), {} };
+		}
+		
+		return { true, std::format("Switched to preset '{}'", name),
+			[this, name, path, j = std::move(j)]() { ActivateLoadedPreset(name, j, path); } };
+	});
+}
+
+void InertiaPresets::ActivateLoadedPreset(const std::string& a_name, const json& a_json, const std::filesystem::path& a_path)
+{
 	// Clear current settings
 	{
 		std::unique_lock lock(presetMutex);
@@ -780,7 +893,7 @@ void InertiaPresets::SetActivePreset(const std::string& a_name)
 	activePresetName = a_name;
 	
 	// Load the new preset
-	LoadWeaponTypePresets();
+	ApplyWeaponTypePresets(a_json, a_path);
 	
 	// If loading failed, initialize with defaults
 	if (weaponTypeSettings.empty()) {
@@ -795,10 +908,10 @@ void InertiaPresets::SetActivePreset(const std::string& a_name)
 	
 	isDirty = false;  // We just loaded, so no unsaved changes
 	
-	// Increment version so InertiaManager knows to refresh its cached settings
-	settingsVersion++;
+	// InertiaManager switches over with the next snapshot
+	PublishSnapshot();
 	
-	logger::info("Switched to preset: {} (version {})", a_name, settingsVersion);
+	logger::info("Switched to preset: {}", a_name);
 }
 
 void InertiaPresets::CreateNewPreset(const std::string& a_name)
@@ -808,13 +921,6 @@ void InertiaPresets::CreateNewPreset(const std::string& a_name)
 		return;
 	}
 	
-	// Check if preset already exists
-	auto path = GetPresetPath(a_name);
-	if (std::filesystem::exists(path)) {
-		logger::warn("Preset already exists: {}", a_name);
-		return;
-	}
-	
 	// Save current settings to the new preset file
 	json j;
 	{
@@ -826,19 +932,52 @@ void InertiaPresets::CreateNewPreset(const std::string& a_name)
 		}
 	}
 	
-	std::ofstream file(path);
-	if (file.is_open()) {
-		file << j.dump(4);
-		file.close();
+	PresetIO::GetSingleton()->Run([this, name = a_name, path = GetPresetPath(a_name), contents = j.dump(4)]() -> PresetIO::Completion {
+		// Check if preset already exists
+		if (std::filesystem::exists(path)) {
+			logger::warn("Preset already exists: {}", name);
+			return { false, std::format("Preset '{}' already exists", name), {} };
+		}
+		
+		if (!PresetIO::WriteFileAtomic(path, contents)) {
+			logger::error("Failed to create preset: {}", path.string());
+			return { false, std::format("Failed to create preset '{}'", name), {} };
+		}
 		logger::info("Created new preset: {}", path.string());
-	} else {
-		logger::error("Failed to create preset: {}", path.string());
-		return;
+		
+		// Switch to the new preset
+		return { true, std::format("Created preset '{}'", name),
+			[this, name]() {
+				activePresetName = name;
+				SaveActivePresetSetting();
+			} };
+	});
+}
+
+void InertiaPresets::CopyWeaponTypeToPreset(const std::string& a_targetPreset, const std::string& a_typeName,
+	bool a_isCustomType, const WeaponInertiaSettings& a_settings)
+{
+	json entry = a_settings;
+	entry["weaponType"] = a_typeName;
+	if (a_isCustomType) {
+		entry["isCustomType"] = true;
 	}
 	
-	// Switch to the new preset
-	activePresetName = a_name;
-	SaveActivePresetSetting();
+	// Read-modify-write of the target file only - the active preset stays loaded as it is
+	PresetIO::GetSingleton()->Run([target = a_targetPreset, typeName = a_typeName, path = GetPresetPath(a_targetPreset), entry = std::move(entry)]() -> PresetIO::Completion {
+		json j;
+		if (!ReadJsonFile(path, j)) {
+			return { false, std::format("Could not read preset '{}'", target), {} };
+		}
+		j[typeName] = entry;
+		
+		if (!PresetIO::WriteFileAtomic(path, j.dump(4))) {
+			logger::error("Failed to save weapon type presets to: {}", path.string());
+			return { false, std::format("Failed to write preset '{}'", target), {} };
+		}
+		logger::info("Copied {} settings to preset {}", typeName, target);
+		return { true, std::format("Copied {} settings to preset '{}'", typeName, target), {} };
+	});
 }
 
 void InertiaPresets::DuplicatePreset(const std::string& a_sourceName, const std::string& a_newName)
@@ -848,25 +987,25 @@ void InertiaPresets::DuplicatePreset(const std::string& a_sourceName, const std:
 		return;
 	}
 	
-	auto sourcePath = GetPresetPath(a_sourceName);
-	auto destPath = GetPresetPath(a_newName);
-	
-	if (!std::filesystem::exists(sourcePath)) {
-		logger::warn("Source preset does not exist: {}", a_sourceName);
-		return;
-	}
-	
-	if (std::filesystem::exists(destPath)) {
-		logger::warn("Destination preset already exists: {}", a_newName);
-		return;
-	}
-	
-	try {
-		std::filesystem::copy_file(sourcePath, destPath);
+	PresetIO::GetSingleton()->Run([a_sourceName, a_newName, sourcePath = GetPresetPath(a_sourceName), destPath = GetPresetPath(a_newName)]() -> PresetIO::Completion {
+		if (!std::filesystem::exists(sourcePath)) {
+			logger::warn("Source preset does not exist: {}", a_sourceName);
+			return { false, std::format("Preset '{}' does not exist", a_sourceName), {} };
+		}
+		
+		if (std::filesystem::exists(destPath)) {
+			logger::warn("Destination preset already exists: {}", a_newName);
+			return { false, std::format("Preset '{}' already exists", a_newName), {} };
+		}
+		
+		std::string contents;
+		if (!PresetIO::ReadFile(sourcePath, contents) || !PresetIO::WriteFileAtomic(destPath, contents)) {
+			logger::error("Failed to duplicate preset {} to {}", a_sourceName, a_newName);
+			return { false, std::format("Failed to duplicate preset '{}'", a_sourceName), {} };
+		}
 		logger::info("Duplicated preset {} to {}", a_sourceName, a_newName);
-	} catch (const std::exception& e) {
-		logger::error("Failed to duplicate preset: {}", e.what());
-	}
+		return { true, std::format("Duplicated preset '{}' to '{}'", a_sourceName, a_newName), {} };
+	});
 }
 
 void InertiaPresets::DeletePreset(const std::string& a_name)
@@ -877,18 +1016,19 @@ void InertiaPresets::DeletePreset(const std::string& a_name)
 		return;
 	}
 	
-	auto path = GetPresetPath(a_name);
-	if (!std::filesystem::exists(path)) {
-		logger::warn("Preset does not exist: {}", a_name);
-		return;
-	}
-	
-	try {
-		std::filesystem::remove(path);
+	PresetIO::GetSingleton()->Run([a_name, path = GetPresetPath(a_name)]() -> PresetIO::Completion {
+		std::error_code ec;
+		if (!std::filesystem::remove(path, ec)) {
+			if (ec) {
+				logger::error("Failed to delete preset: {}", ec.message());
+			} else {
+				logger::warn("Preset does not exist: {}", a_name);
+			}
+			return { false, std::format("Could not delete preset '{}'", a_name), {} };
+		}
 		logger::info("Deleted preset: {}", a_name);
-	} catch (const std::exception& e) {
-		logger::error("Failed to delete preset: {}", e.what());
-	}
+		return { true, std::format("Deleted preset '{}'", a_name), {} };
+	});
 }
 
 void InertiaPresets::RenamePreset(const std::string& a_oldName, const std::string& a_newName)
@@ -898,47 +1038,60 @@ void InertiaPresets::RenamePreset(const std::string& a_oldName, const std::strin
 		return;
 	}
 	
-	auto oldPath = GetPresetPath(a_oldName);
-	auto newPath = GetPresetPath(a_newName);
-	
-	if (!std::filesystem::exists(oldPath)) {
-		logger::warn("Preset does not exist: {}", a_oldName);
-		return;
-	}
-	
-	if (std::filesystem::exists(newPath)) {
-		logger::warn("Preset already exists: {}", a_newName);
-		return;
-	}
-	
-	try {
-		std::filesystem::rename(oldPath, newPath);
+	PresetIO::GetSingleton()->Run([this, a_oldName, a_newName, oldPath = GetPresetPath(a_oldName), newPath = GetPresetPath(a_newName)]() -> PresetIO::Completion {
+		if (!std::filesystem::exists(oldPath)) {
+			logger::warn("Preset does not exist: {}", a_oldName);
+			return { false, std::format("Preset '{}' does not exist", a_oldName), {} };
+		}
 		
-		// If this was the active preset, update the name
-		if (activePresetName == a_oldName) {
-			activePresetName = a_newName;
-			SaveActivePresetSetting();
+		if (std::filesystem::exists(newPath)) {
+			logger::warn("Preset already exists: {}", a_newName);
+			return { false, std::format("Preset '{}' already exists", a_newName), {} };
 		}
 		
+		std::error_code ec;
+		std::filesystem::rename(oldPath, newPath, ec);
+		if (ec) {
+			logger::error("Failed to rename preset: {}", ec.message());
+			return { false, std::format("Failed to rename preset '{}'", a_oldName), {} };
+		}
 		logger::info("Renamed preset {} to {}", a_oldName, a_newName);
-	} catch (const std::exception& e) {
-		logger::error("Failed to rename preset: {}", e.what());
-	}
+		
+		return { true, std::format("Renamed preset '{}' to '{}'", a_oldName, a_newName),
+			[this, a_oldName, a_newName]() {
+				// If this was the active preset, update the name
+				if (activePresetName == a_oldName) {
+					activePresetName = a_newName;
+					SaveActivePresetSetting();
+				}
+			} };
+	});
 }
 
 void InertiaPresets::SaveActivePresetSetting()
 {
-	CSimpleIniA ini;
-	ini.SetUnicode();
-	
-	auto iniPath = L"Data/SKSE/Plugins/FPInertia.ini";
-	ini.LoadFile(iniPath);
-	
-	ini.SetValue("Presets", "sActivePreset", activePresetName.c_str(), 
-		"; The currently active weapon type preset file (without .json extension)");
-	
-	ini.SaveFile(iniPath);
-	logger::info("Saved active preset setting: {}", activePresetName);
+	PresetIO::GetSingleton()->Run([name = activePresetName]() -> PresetIO::Completion {
+		CSimpleIniA ini;
+		ini.SetUnicode();
+		
+		auto iniPath = L"Data/SKSE/Plugins/FPInertia.ini";
+		ini.LoadFile(iniPath);
+		
+		ini.SetValue("Presets", "sActivePreset", name.c_str(), 
+			"; The currently active weapon type preset file (without .json extension)");
+		
+		std::string contents;
+		ini.Save(contents);
+		if (!PresetIO::WriteFileAtomic(iniPath, contents)) {
+			logger::error("Failed to save active preset setting");
+			return { false, "Failed to save the active preset to the INI", {} };
+		}
+		
+		// Our own write - not a change for hot reload to pick up
+		SettingsWatcher::GetSingleton()->SyncFileTime();
+		logger::info("Saved active preset setting: {}", name);
+		return {};
+	});
 }
 
 void InertiaPresets::LoadActivePresetSetting()
@@ -965,6 +1118,7 @@ void InertiaPresets::LoadActivePresetSetting()
 
 void InertiaPresets::LoadKeywordMappings()
 {
+	FPI_TRACE_ZONE("Load keyword mappings");
 	auto mappingsPath = GetKeywordMappingsFolderPath();
 	if (!std::filesystem::exists(mappingsPath)) {
 		logger::info("No keyword mappings folder found");
@@ -1077,6 +1231,7 @@ void InertiaPresets::LoadKeywordMappings()
 
 void InertiaPresets::ResolveKeywordPointers()
 {
+	FPI_TRACE_ZONE("Resolve keywords");
 	int totalResolved = 0;
 	int totalFailed = 0;
 	
@@ -1109,6 +1264,7 @@ void InertiaPresets::ResolveKeywordPointers()
 
 std::string InertiaPresets::GetBestKeywordMatch(RE::TESObjectWEAP* a_weapon) const
 {
+	FPI_TRACE_ZONE("Keyword match");
 	if (!a_weapon) return "";
 	
 	// Get the keyword form interface
@@ -1169,6 +1325,7 @@ void InertiaPresets::EnsureCustomTypesInPreset()
 	// If we added any, save the preset
 	if (addedAny) {
 		lock.unlock();
+		PublishSnapshot();
 		SaveWeaponTypePresets();
 	}
 }
@@ -4,6 +4,8 @@
 #include <filesystem>
 #include <unordered_map>
 #include <shared_mutex>
+#include <atomic>
+#include <memory>
 #include <nlohmann/json.hpp>
 
 using json = nlohmann::json;
@@ -67,6 +69,28 @@ struct SpecificWeaponKeyHash
 void to_json(json& j, const WeaponInertiaSettings& s);
 void from_json(const json& j, WeaponInertiaSettings& s);
 
+// Immutable copy of all preset tables, for the game thread
+//
+// The menu edits the live tables in InertiaPresets and publishes a new snapshot after every change.
+// InertiaManager checks the published generation once per frame and only reloads the snapshot when
+// it changed: loading the atomic shared_ptr takes a short internal lock (it is not lock-free on
+// MSVC), the generation check doesn't. Weapon settings are read from the snapshot with no locks;
+// references into a snapshot stay valid for as long as it is held. Replaced snapshots are freed by
+// the next publish once no frame holds them any more.
+struct PresetSnapshot
+{
+	std::unordered_map<WeaponTypeKey, WeaponInertiaSettings, WeaponTypeKeyHash> weaponTypeSettings;
+	std::unordered_map<SpecificWeaponKey, WeaponInertiaSettings, SpecificWeaponKeyHash> specificWeaponSettings;
+	std::unordered_map<std::string, WeaponInertiaSettings> customWeaponTypeSettings;
+	uint32_t generation{ 0 };  // Different for every published snapshot
+	
+	// Settings for a weapon type (defaults if the preset has none)
+	const WeaponInertiaSettings& GetWeaponTypeSettings(WeaponType a_type) const;
+	
+	// Full priority: specific weapon (a_editorID) -> custom keyword type (a_customType) -> standard type
+	const WeaponInertiaSettings& GetWeaponSettings(const std::string& a_editorID, const std::string& a_customType, WeaponType a_type) const;
+};
+
 class InertiaPresets
 {
 public:
@@ -83,9 +107,6 @@ public:
 	const WeaponInertiaSettings& GetWeaponSettings(const std::string& a_editorID, WeaponType a_type) const;
 	WeaponInertiaSettings& GetWeaponSettingsMutable(const std::string& a_editorID, WeaponType a_type);
 	
-	// Get settings for a weapon with keyword checking (full priority: specific -> keyword -> type)
-	const WeaponInertiaSettings& GetWeaponSettingsWithKeywords(const std::string& a_editorID, RE::TESObjectWEAP* a_weapon, WeaponType a_type) const;
-	
 	// Get settings for a weapon type (fallback)
 	const WeaponInertiaSettings& GetWeaponTypeSettings(WeaponType a_type) const;
 	WeaponInertiaSettings& GetWeaponTypeSettingsMutable(WeaponType a_type);
@@ -105,26 +126,31 @@ public:
 	void RemoveSpecificWeaponSettings(const std::string& a_editorID);
 	
 	// Preset file management
-	void SaveWeaponTypePresets();
-	void LoadWeaponTypePresets();
-	void SaveSpecificWeaponPreset(const std::string& a_editorID);
-	void LoadSpecificWeaponPreset(const std::string& a_editorID);
-	void LoadAllPresets();
+	// Saves and everything the menu calls below are queued on the preset I/O thread (PresetIO);
+	// results that change preset state are applied when the menu drains PresetIO
+	void SaveWeaponTypePresets(bool a_notify = false);  // a_notify: report to the menu when written
+	void LoadWeaponTypePresets();  // Blocking - Init only
+	void SaveSpecificWeaponPreset(const std::string& a_editorID, bool a_notify = false);
+	void LoadSpecificWeaponPreset(const std::string& a_editorID);  // Blocking - Init only
+	void LoadAllPresets();  // Blocking - Init only
+	void ReloadAllPresets();  // Queued re-read of the active preset and all specific weapon presets
 	
 	// Reset presets to INI values (ignores JSON files)
 	void ResetToINIValues();
 	
-	// Get all saved specific weapon preset names
+	// Get all saved specific weapon preset names (sorted)
 	std::vector<std::string> GetSavedSpecificWeaponPresets() const;
 	
 	// Preset profile management (multiple weapon type preset files)
-	std::vector<std::string> GetAvailablePresets() const;  // List JSON files in FPInertia folder (excluding Weapons subfolder)
+	std::vector<std::string> GetAvailablePresets() const;  // List JSON files in FPInertia folder (excluding Weapons subfolder) - blocking, call from a PresetIO job
 	const std::string& GetActivePresetName() const { return activePresetName; }
 	void SetActivePreset(const std::string& a_name);  // Switch to a different preset
 	void CreateNewPreset(const std::string& a_name);  // Create new preset file from current values
 	void DuplicatePreset(const std::string& a_sourceName, const std::string& a_newName);  // Copy a preset
 	void DeletePreset(const std::string& a_name);  // Delete a preset file
 	void RenamePreset(const std::string& a_oldName, const std::string& a_newName);  // Rename a preset
+	void CopyWeaponTypeToPreset(const std::string& a_targetPreset, const std::string& a_typeName,
+		bool a_isCustomType, const WeaponInertiaSettings& a_settings);  // Overwrite one type's entry in another preset file
 	void SaveActivePresetSetting();  // Save active preset name to INI
 	void LoadActivePresetSetting();  // Load active preset name from INI
 	
@@ -139,9 +165,15 @@ public:
 	void MarkDirty() { isDirty = true; }
 	void ClearDirty() { isDirty = false; }
 	
-	// Settings version (incremented when presets change, for cache invalidation)
-	uint32_t GetSettingsVersion() const { return settingsVersion; }
-	void IncrementSettingsVersion() { settingsVersion++; }
+	// Snapshot of the preset tables for the game thread (never null)
+	std::shared_ptr<const PresetSnapshot> AcquireSnapshot() const { return snapshot.load(std::memory_order_acquire); }
+	
+	// Generation of the latest published snapshot - reload it when this differs from the one held
+	uint32_t GetSnapshotGeneration() const { return publishedGeneration.load(std::memory_order_acquire); }
+	
+	// Copy the live tables into a new snapshot and make it current - call after every change to
+	// them (menu edits included), without holding presetMutex
+	void PublishSnapshot();
 	
 	// Weapon type name helpers
 	static const char* GetWeaponTypeName(WeaponType a_type);
@@ -165,6 +197,17 @@ private:
 	InertiaPresets& operator=(const InertiaPresets&) = delete;
 	InertiaPresets& operator=(InertiaPresets&&) = delete;
 
+	// Warn (at load) if a preset's springs need more substeps than the bank's budget with the
+	// selected integrators and timestep, i.e. they can go unstable on long frames
+	void CheckStability(const std::string& a_name, const WeaponInertiaSettings& a_settings) const;
+
+	// Parsed preset files into the maps (the file reads happen in the Load* functions or PresetIO jobs)
+	// The callers publish the snapshot once they're done
+	json BuildWeaponTypePresetJson() const;
+	void ApplyWeaponTypePresets(const json& a_json, const std::filesystem::path& a_path);
+	void ApplySpecificWeaponPreset(const std::string& a_editorID, const json& a_json);
+	void ActivateLoadedPreset(const std::string& a_name, const json& a_json, const std::filesystem::path& a_path);
+
 	// Per-weapon-type settings (the defaults from INI, can be modified in menu)
 	std::unordered_map<WeaponTypeKey, WeaponInertiaSettings, WeaponTypeKeyHash> weaponTypeSettings;
 	
@@ -184,8 +227,12 @@ private:
 	// Track unsaved changes
 	bool isDirty{ false };
 	
-	// Settings version counter (incremented when presets change)
-	uint32_t settingsVersion{ 0 };
+	// Published snapshot, and replaced ones a frame may still hold (freed by PublishSnapshot)
+	std::atomic<std::shared_ptr<const PresetSnapshot>> snapshot{ std::make_shared<const PresetSnapshot>() };
+	std::vector<std::shared_ptr<const PresetSnapshot>> retiredSnapshots;
+	uint32_t snapshotGeneration{ 0 };
+	std::atomic<uint32_t> publishedGeneration{ 0 };  // Stored after the snapshot is swapped in
+	std::mutex snapshotMutex;  // Serializes publishers
 	
 	// Active preset name (without .json extension)
 	std::string activePresetName{ "WeaponTypes" };
@@ -0,0 +1,161 @@
+#include "LogRing.h"
+
+#include <spdlog/pattern_formatter.h>
+
+// What the logger sees: hands messages to the ring, flushes and pattern changes to the writer thread
+class LogRing::Sink final : public spdlog::sinks::sink
+{
+public:
+	explicit Sink(LogRing* a_ring) :
+		ring(a_ring)
+	{}
+
+	void log(const spdlog::details::log_msg& a_msg) override { ring->Push(a_msg); }
+	void flush() override { ring->RequestFlush(); }
+
+	void set_pattern(const std::string& a_pattern) override
+	{
+		ring->SetFormatter(std::make_unique<spdlog::pattern_formatter>(a_pattern));
+	}
+
+	void set_formatter(std::unique_ptr<spdlog::formatter> a_formatter) override
+	{
+		ring->SetFormatter(std::move(a_formatter));
+	}
+
+private:
+	LogRing* ring;
+};
+
+LogRing::LogRing()
+{
+	for (std::size_t i = 0; i < kCapacity; ++i) {
+		slots[i].sequence.store(i, std::memory_order_relaxed);
+	}
+}
+
+void LogRing::Shutdown()
+{
+	if (!writeThread.joinable()) {
+		return;
+	}
+
+	// No lock: the writer may have been terminated holding targetMutex, and it sees stopWrite
+	// within kDrainInterval even if this wake is missed
+	stopWrite.store(true, std::memory_order_relaxed);
+	RequestFlush();
+	writeThread.join();
+
+	// Messages logged after the writer's last pass
+	Drain();
+	target->flush();
+}
+
+std::shared_ptr<spdlog::sinks::sink> LogRing::Start(std::shared_ptr<spdlog::sinks::sink> a_target)
+{
+	target = std::move(a_target);
+	writeThread = std::thread(&LogRing::WriteLoop, this);
+	return std::make_shared<Sink>(this);
+}
+
+bool LogRing::Push(const spdlog::details::log_msg& a_msg)
+{
+	// Claim the next slot; a slot whose sequence lags a whole lap behind is still being read
+	static_assert((kCapacity & (kCapacity - 1)) == 0, "kCapacity must be a power of two");
+	std::size_t pos = writePos.load(std::memory_order_relaxed);
+	Slot* slot = nullptr;
+	for (;;) {
+		slot = &slots[pos & (kCapacity - 1)];
+		const auto lag = static_cast<std::ptrdiff_t>(slot->sequence.load(std::memory_order_acquire) - pos);
+		if (lag == 0) {
+			if (writePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+				break;
+			}
+		} else if (lag < 0) {
+			dropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		} else {
+			pos = writePos.load(std::memory_order_relaxed);
+		}
+	}
+
+	const std::size_t size = a_msg.payload.size();
+	if (size > kMaxMessage) {
+		truncated.fetch_add(1, std::memory_order_relaxed);
+	}
+	slot->level = a_msg.level;
+	slot->time = a_msg.time;
+	slot->threadID = a_msg.thread_id;
+	slot->length = static_cast<std::uint32_t>(std::min(size, kMaxMessage));
+	std::memcpy(slot->message, a_msg.payload.data(), slot->length);
+
+	// Publish to the writer thread, and wake it early every half ring so bursts don't overrun it
+	slot->sequence.store(pos + 1, std::memory_order_release);
+	if ((pos & (kCapacity / 2 - 1)) == kCapacity / 2 - 1) {
+		RequestFlush();
+	}
+	return true;
+}
+
+void LogRing::RequestFlush()
+{
+	// A wake that races the writer going back to sleep is picked up by its next interval
+	wakeRequested.store(true, std::memory_order_relaxed);
+	writeWake.notify_one();
+}
+
+void LogRing::SetFormatter(std::unique_ptr<spdlog::formatter> a_formatter)
+{
+	std::lock_guard lock(targetMutex);
+	if (target) {
+		target->set_formatter(std::move(a_formatter));
+	}
+}
+
+bool LogRing::Drain()
+{
+	bool wrote = false;
+	for (;;) {
+		Slot& slot = slots[readPos & (kCapacity - 1)];
+		if (slot.sequence.load(std::memory_order_acquire) != readPos + 1) {
+			break;
+		}
+
+		spdlog::details::log_msg msg(slot.time, spdlog::source_loc{}, spdlog::string_view_t{}, slot.level,
+			spdlog::string_view_t(slot.message, slot.length));
+		msg.thread_id = slot.threadID;
+		target->log(msg);
+
+		// Hand the slot back to the writers for the next lap
+		slot.sequence.store(readPos + kCapacity, std::memory_order_release);
+		++readPos;
+		wrote = true;
+	}
+
+	const std::uint64_t drops = dropped.load(std::memory_order_relaxed);
+	if (drops != reportedDrops) {
+		const std::string text = fmt::format("Log ring full - {} messages dropped", drops - reportedDrops);
+		target->log(spdlog::details::log_msg(spdlog::log_clock::now(), spdlog::source_loc{}, spdlog::string_view_t{},
+			spdlog::level::warn, text));
+		reportedDrops = drops;
+		wrote = true;
+	}
+	return wrote;
+}
+
+void LogRing::WriteLoop()
+{
+	std::unique_lock lock(targetMutex);
+	for (;;) {
+		writeWake.wait_for(lock, kDrainInterval, [this] {
+			return wakeRequested.load(std::memory_order_relaxed) || stopWrite.load(std::memory_order_relaxed);
+		});
+		wakeRequested.store(false, std::memory_order_relaxed);
+		if (Drain()) {
+			target->flush();
+		}
+		if (stopWrite.load(std::memory_order_relaxed)) {
+			break;
+		}
+	}
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <thread>
+
+// Asynchronous log output
+//
+// Log calls only copy the formatted message into a preallocated ring and return; a background
+// thread applies the pattern and writes the file. Nothing on a logging thread allocates, waits
+// on a lock or touches the disk.
+// - The ring is a bounded lock-free queue (any number of writers, one reader). When it is full
+//   the message is dropped and counted rather than blocking the game; messages longer than a
+//   slot are cut short and counted. Drops are reported in the log once the ring has room again.
+// - The writer thread wakes every kDrainInterval, every half ring, or right away when a warning
+//   or error asks for a flush (flush_on), and flushes the file after every batch it writes.
+class LogRing
+{
+public:
+	static constexpr std::size_t kCapacity = 1024;   // Messages in flight (power of two)
+	static constexpr std::size_t kMaxMessage = 480;  // Longer messages are truncated
+	static constexpr auto kDrainInterval = std::chrono::milliseconds(100);
+
+	static LogRing* GetSingleton()
+	{
+		static LogRing singleton;
+		return &singleton;
+	}
+
+	// Start the writer thread in front of a_target; returns the sink to give the logger
+	std::shared_ptr<spdlog::sinks::sink> Start(std::shared_ptr<spdlog::sinks::sink> a_target);
+
+	// Plugin shutdown - stop and join the writer thread, then write out what is left
+	void Shutdown();
+
+	// Messages lost because the ring was full / cut to kMaxMessage
+	std::uint64_t GetDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+	std::uint64_t GetTruncatedCount() const { return truncated.load(std::memory_order_relaxed); }
+
+private:
+	LogRing();
+	~LogRing() = default;
+	LogRing(const LogRing&) = delete;
+	LogRing(LogRing&&) = delete;
+	LogRing& operator=(const LogRing&) = delete;
+	LogRing& operator=(LogRing&&) = delete;
+
+	class Sink;
+
+	struct Slot
+	{
+		std::atomic<std::size_t> sequence{ 0 };
+		spdlog::level::level_enum level{ spdlog::level::info };
+		spdlog::log_clock::time_point time;
+		std::size_t threadID{ 0 };
+		std::uint32_t length{ 0 };
+		char message[kMaxMessage];
+	};
+
+	// Any thread - false if the ring was full
+	bool Push(const spdlog::details::log_msg& a_msg);
+	void RequestFlush();
+	void SetFormatter(std::unique_ptr<spdlog::formatter> a_formatter);
+
+	// Writer thread (or Shutdown, once it is joined) - write out everything queued; true if anything was written
+	bool Drain();
+	void WriteLoop();
+
+	std::array<Slot, kCapacity> slots;
+	alignas(64) std::atomic<std::size_t> writePos{ 0 };  // Next slot a writer claims
+	alignas(64) std::size_t readPos{ 0 };                // Writer thread only
+	alignas(64) std::atomic<std::uint64_t> dropped{ 0 };
+	std::atomic<std::uint64_t> truncated{ 0 };
+	std::uint64_t reportedDrops{ 0 };                    // Writer thread only
+
+	std::shared_ptr<spdlog::sinks::sink> target;
+	std::thread writeThread;
+	std::mutex targetMutex;           // Guards target (pattern changes vs. the writer thread)
+	std::condition_variable writeWake;
+	std::atomic<bool> wakeRequested{ false };
+	std::atomic<bool> stopWrite{ false };
+};
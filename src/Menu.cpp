@@ -1,5 +1,13 @@
 #include "Menu.h"
 #include "Inertia.h"
+#include "TraceRecorder.h"
+#include "TelemetryCapture.h"
+#include "PresetIO.h"
+#include "SettingsWatcher.h"
+#include "LogRing.h"
+#include "Diagnostics.h"
+#include "PerfStats.h"
+#include "TraceZones.h"
 #include <format>
 
 namespace Menu
@@ -64,6 +72,19 @@ namespace Menu
 		}
 	}
 	
+	// Probed directly rather than through the vendored SKSEMenuFramework.h, which predates HUD
+	// elements; false if the installed framework doesn't export AddHudElement
+	static bool AddHudElement(SKSEMenuFramework::Model::RenderFunction a_render)
+	{
+		using AddHudElementFunction = void (*)(SKSEMenuFramework::Model::RenderFunction);
+		static auto func = SKSEMenuFramework::Internal::GetFunction<AddHudElementFunction>("AddHudElement");
+		if (!func) {
+			return false;
+		}
+		func(a_render);
+		return true;
+	}
+	
 	void Register()
 	{
 		if (!SKSEMenuFramework::IsInstalled()) {
@@ -74,6 +95,12 @@ namespace Menu
 		SKSEMenuFramework::SetSection("FP Inertia");
 		SKSEMenuFramework::AddSectionItem("Settings", Render);
 		
+		// Older framework versions have no HUD elements - the overlay is then a window that takes input
+		if (!AddHudElement(RenderOverlayHud)) {
+			State::overlayWindow = SKSEMenuFramework::AddWindow(RenderOverlayWindow);
+			SyncOverlay();
+		}
+		
 		logger::info("Menu registered with SKSE Menu Framework");
 	}
 	
@@ -86,6 +113,12 @@ namespace Menu
 		return changed;
 	}
 	
+	void MarkEdited()
+	{
+		State::hasUnsavedChanges = true;
+		InertiaPresets::GetSingleton()->PublishSnapshot();
+	}
+	
 	bool CheckboxWithTooltip(const char* label, bool* value, const char* tooltip)
 	{
 		bool changed = ImGui::Checkbox(label, value);
@@ -106,23 +139,36 @@ namespace Menu
 	
 	void RefreshPresetList()
 	{
-		auto* presets = InertiaPresets::GetSingleton();
-		State::cachedPresetList = presets->GetAvailablePresets();
-		
-		// Find current active preset index
-		const auto& activeName = presets->GetActivePresetName();
-		State::selectedPresetIndex = 0;
-		for (size_t i = 0; i < State::cachedPresetList.size(); ++i) {
-			if (State::cachedPresetList[i] == activeName) {
-				State::selectedPresetIndex = static_cast<int>(i);
-				break;
-			}
-		}
+		// The folder is listed on the preset I/O thread, after any queued create/delete
+		PresetIO::GetSingleton()->Run([]() -> PresetIO::Completion {
+			return { true, {}, [list = InertiaPresets::GetSingleton()->GetAvailablePresets()]() mutable {
+				State::cachedPresetList = std::move(list);
+				
+				// Find current active preset index
+				const auto& activeName = InertiaPresets::GetSingleton()->GetActivePresetName();
+				State::selectedPresetIndex = 0;
+				for (size_t i = 0; i < State::cachedPresetList.size(); ++i) {
+					if (State::cachedPresetList[i] == activeName) {
+						State::selectedPresetIndex = static_cast<int>(i);
+						break;
+					}
+				}
+			} };
+		});
 		
 		// Also refresh weapon types list to include any custom types
 		s_weaponTypesNeedRefresh = true;
 	}
 	
+	void ProcessPresetIO()
+	{
+		for (const auto& completion : PresetIO::GetSingleton()->Drain()) {
+			if (!completion.message.empty()) {
+				RE::DebugNotification(std::format("FP Inertia: {}", completion.message).c_str());
+			}
+		}
+	}
+	
 	void __stdcall Render()
 	{
 		// Initialize on first render
@@ -132,6 +178,10 @@ namespace Menu
 			RefreshPresetList();
 		}
 		
+		// Apply finished preset loads and report finished saves
+		ProcessPresetIO();
+		SyncOverlay();
+		
 		DrawHeader();
 		DrawPresetSelector();
 		ImGui::Separator();
@@ -142,6 +192,7 @@ namespace Menu
 		DrawActionBlendSettings();
 		DrawHandsSettings();
 		DrawDebugSettings();
+		DrawPerformanceStats();
 		
 		ImGui::Separator();
 		DrawWeaponTypeSettings();
@@ -200,7 +251,7 @@ namespace Menu
 					ImGui::OpenPopup("Frame Gen Warning");
 				} else {
 					settings->frameGenCompatMode = frameGenMode;
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 			}
 			if (ImGui::IsItemHovered()) {
@@ -220,7 +271,7 @@ namespace Menu
 				
 				if (ImGui::Button("Disable Anyway", ImVec2(120, 0))) {
 					settings->frameGenCompatMode = false;
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 					ImGui::CloseCurrentPopup();
 				}
 				ImGui::SameLine();
@@ -236,7 +287,7 @@ namespace Menu
 			bool highFpsFix = settings->highFramerateFix;
 			if (ImGui::Checkbox("High Framerate Fix", &highFpsFix)) {
 				settings->highFramerateFix = highFpsFix;
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			if (ImGui::IsItemHovered()) {
 				ImGui::SetTooltip("Fixes ghosting at high framerates (140+ FPS) by rate-limiting\noffset application to ~143fps. Enable if you see ghosting\nwithout Frame Generation.");
@@ -249,7 +300,7 @@ namespace Menu
 		
 		// Enabled toggle
 		if (ImGui::Checkbox("Enabled", &settings->enabled)) {
-			State::hasUnsavedChanges = true;
+			MarkEdited();
 		}
 		
 		// Show first-person indicator
@@ -317,11 +368,10 @@ namespace Menu
 					if (ImGui::Selectable(State::cachedPresetList[i].c_str(), isSelected)) {
 						if (State::selectedPresetIndex != i) {
 							// Switch to new preset
+							// Loads in the background; reported when it's applied
 							presets->SetActivePreset(State::cachedPresetList[i]);
 							State::selectedPresetIndex = i;
 							State::hasUnsavedChanges = false;  // Just loaded, no changes
-							RE::DebugNotification(std::format("FP Inertia: Switched to preset '{}'", 
-								State::cachedPresetList[i]).c_str());
 						}
 					}
 					if (isSelected) {
@@ -412,7 +462,6 @@ namespace Menu
 				RefreshPresetList();
 				State::showCreatePresetPopup = false;
 				State::hasUnsavedChanges = false;
-				RE::DebugNotification(std::format("FP Inertia: Created preset '{}'", State::newPresetName).c_str());
 			}
 			if (!validName) {
 				ImGui::EndDisabled();
@@ -474,7 +523,6 @@ namespace Menu
 				RefreshPresetList();
 				deleteIndex = -1;
 				State::showDeletePresetConfirm = false;
-				RE::DebugNotification(std::format("FP Inertia: Deleted preset '{}'", presetToDelete).c_str());
 			}
 			ImGui::PopStyleColor(2);
 			
@@ -506,29 +554,108 @@ namespace Menu
 			
 			if (CheckboxWithTooltip("Enable Position Offset", &settings->enablePosition,
 				"Enable positional movement (weapon moves left/right/up/down based on camera/movement)")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (CheckboxWithTooltip("Enable Rotation Offset", &settings->enableRotation,
 				"Enable rotational movement (weapon tilts/rotates based on camera/movement)")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (CheckboxWithTooltip("Require Weapon Drawn", &settings->requireWeaponDrawn,
 				"Only apply inertia effects when weapon is drawn")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			ImGui::Spacing();
 			
 			if (SliderFloatWithTooltip("Global Intensity", &settings->globalIntensity, 0.0f, 5.0f, "%.2f",
 				"Master multiplier for all inertia effects\n1.0 = normal, 0.5 = half, 2.0 = double")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (SliderFloatWithTooltip("Smoothing Factor", &settings->smoothingFactor, 0.0f, 1.0f, "%.2f",
 				"Camera velocity smoothing (0 = no smoothing, 1 = maximum)\nHigher values reduce jitter but add latency")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
+			}
+
+			ImGui::Spacing();
+
+			ImGui::Text("Spring Integrators:");
+			if (ImGui::IsItemHovered()) {
+				ImGui::SetTooltip("How each spring category is advanced every frame\nSemi-implicit Euler: original integrator\nExact: analytic damped-oscillator solution, accurate at any framerate and stiffness\nVerlet / RK4 / Implicit Euler: higher accuracy or stability\nSubstepped integrators take as many substeps as each spring needs to stay stable (up to 16)");
+			}
+			
+			const char* integratorNames[] = { "Semi-implicit Euler", "Exact", "Velocity Verlet", "RK4", "Implicit Euler" };
+			auto integratorCombo = [&](const char* label, int* value) {
+				int integratorIdx = std::clamp(*value, 0, 4);
+				if (ImGui::BeginCombo(label, integratorNames[integratorIdx])) {
+					for (int i = 0; i < 5; ++i) {
+						bool isSelected = (*value == i);
+						if (ImGui::Selectable(integratorNames[i], isSelected)) {
+							*value = i;
+							MarkEdited();
+						}
+						if (isSelected) {
+							ImGui::SetItemDefaultFocus();
+						}
+					}
+					ImGui::EndCombo();
+				}
+			};
+			integratorCombo("Camera##integrator", &settings->cameraIntegrator);
+			integratorCombo("Movement##integrator", &settings->movementIntegrator);
+			integratorCombo("Sprint##integrator", &settings->sprintIntegrator);
+			integratorCombo("Jump##integrator", &settings->jumpIntegrator);
+
+			ImGui::Spacing();
+
+			if (ImGui::Checkbox("Fixed Timestep", &settings->fixedTimestep)) {
+				MarkEdited();
+			}
+			if (ImGui::IsItemHovered()) {
+				ImGui::SetTooltip("Step springs at a constant rate and interpolate between ticks\nSame feel at any framerate - disable to step once per frame (original)");
+			}
+
+			if (settings->fixedTimestep) {
+				if (SliderIntWithTooltip("Physics Rate", &settings->physicsRateHz, 30, 480, "%d Hz",
+					"Physics ticks per second\n120 suits most setups, 240 for very stiff springs")) {
+					MarkEdited();
+				}
+				if (SliderIntWithTooltip("Max Steps Per Frame", &settings->maxPhysicsSteps, 1, 32, "%d",
+					"Most physics ticks run in one frame\nTime beyond this after a hitch is dropped")) {
+					MarkEdited();
+				}
+			}
+
+			ImGui::Spacing();
+
+			if (CheckboxWithTooltip("Worker Thread", &settings->workerThread,
+				"Step springs on a worker thread while the game animates\nThe result is picked up just before the offsets are applied")) {
+				MarkEdited();
+			}
+
+			if (settings->workerThread) {
+				if (SliderFloatWithTooltip("Worker Deadline", &settings->workerDeadlineMs, 0.1f, 4.0f, "%.1f ms",
+					"Longest wait for the worker before the previous pose is reused")) {
+					MarkEdited();
+				}
+			}
+
+			if (settings->frameGenCompatMode) {
+				ImGui::BeginDisabled();
+			}
+			if (CheckboxWithTooltip("Late Latch", &settings->lateLatch,
+				"Step springs right before the offsets are applied, reading the camera again there\nLowest look-to-arm latency for high refresh rate mouse players\nReplaces the worker thread; unavailable in Frame Gen Compatible Mode")) {
+				MarkEdited();
+			}
+			if (settings->frameGenCompatMode) {
+				ImGui::EndDisabled();
+			}
+
+			if (CheckboxWithTooltip("Exp Map Rotation", &settings->expMapRotation,
+				"Apply rotation offsets as an exponential map instead of Euler angles\nA slightly different rotation - presets feel a little different with it on")) {
+				MarkEdited();
 			}
 		} else {
 			State::generalExpanded = false;
@@ -547,17 +674,17 @@ namespace Menu
 			
 			if (SliderFloatWithTooltip("Settle Delay", &settings->settleDelay, 0.0f, 2.0f, "%.2f sec",
 				"Delay before settling starts after camera stops moving\n0 = immediate settling")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (SliderFloatWithTooltip("Settle Speed", &settings->settleSpeed, 0.5f, 10.0f, "%.1f",
 				"How fast the damping increases once settling begins\nHigher = faster settling")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (SliderFloatWithTooltip("Settle Damping Mult", &settings->settleDampingMult, 1.0f, 10.0f, "%.1fx",
 				"Maximum damping multiplier when fully settled\nHigher = less wobble when stopped")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 		} else {
 			State::settlingExpanded = false;
@@ -576,18 +703,18 @@ namespace Menu
 			
 			if (CheckboxWithTooltip("Enable Movement Inertia (Global)", &settings->movementInertiaEnabled,
 				"Master toggle for movement-based arm sway\nCan also be disabled per-weapon in weapon settings")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (settings->movementInertiaEnabled) {
 				if (SliderFloatWithTooltip("Strength", &settings->movementInertiaStrength, 0.0f, 20.0f, "%.1f",
 					"Global strength multiplier for movement inertia")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				if (SliderFloatWithTooltip("Threshold", &settings->movementInertiaThreshold, 0.0f, 200.0f, "%.0f units/sec",
 					"Minimum movement speed to trigger effect\nLower = more sensitive to small movements")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				ImGui::Spacing();
@@ -595,7 +722,7 @@ namespace Menu
 				
 				if (CheckboxWithTooltip("Enable Forward/Back Inertia", &settings->forwardBackInertia,
 					"Enable arm sway for forward/backward movement\nDefault: OFF (only strafing causes sway)\nPer-weapon multipliers are in weapon settings")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				if (settings->forwardBackInertia) {
@@ -607,7 +734,7 @@ namespace Menu
 				
 				if (CheckboxWithTooltip("Disable Vanilla Sway", &settings->disableVanillaSway,
 					"Disable the game's built-in walk/run arm sway via behavior graph\nUseful if this mod's movement inertia feels doubled")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 			}
 		} else {
@@ -627,29 +754,29 @@ namespace Menu
 			
 			if (CheckboxWithTooltip("Blend During Attack", &settings->blendDuringAttack,
 				"Reduce inertia while performing melee attacks")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (CheckboxWithTooltip("Blend During Bow Draw", &settings->blendDuringBowDraw,
 				"Reduce inertia while drawing/firing bow")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (CheckboxWithTooltip("Blend During Spell Cast", &settings->blendDuringSpellCast,
 				"Reduce inertia while casting spells")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			ImGui::Spacing();
 			
 			if (SliderFloatWithTooltip("Blend Speed", &settings->actionBlendSpeed, 1.0f, 20.0f, "%.1f",
 				"How fast to blend inertia in/out during actions\nHigher = snappier transitions")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (SliderFloatWithTooltip("Minimum Intensity", &settings->actionMinIntensity, 0.0f, 1.0f, "%.2f",
 				"Minimum inertia intensity during actions\n0 = fully disabled during actions, 1 = no reduction")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 		} else {
 			State::actionBlendExpanded = false;
@@ -665,17 +792,17 @@ namespace Menu
 			
 			if (CheckboxWithTooltip("Independent Hands", &settings->independentHands,
 				"Process each hand separately (for future dual-wield support)")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (SliderFloatWithTooltip("Left Hand Multiplier", &settings->leftHandMultiplier, 0.0f, 3.0f, "%.2f",
 				"Intensity multiplier for left hand")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (SliderFloatWithTooltip("Right Hand Multiplier", &settings->rightHandMultiplier, 0.0f, 3.0f, "%.2f",
 				"Intensity multiplier for right hand")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 		} else {
 			State::handsExpanded = false;
@@ -691,24 +818,101 @@ namespace Menu
 			
 			if (CheckboxWithTooltip("Debug Logging", &settings->debugLogging,
 				"Enable detailed debug messages in the log file")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
+			}
+			
+			// Per-frame logging only exists in the diagnostics build
+			if constexpr (Diagnostics::kTrace) {
+				if (settings->debugLogging) {
+					if (CheckboxWithTooltip("Log Every Frame", &settings->debugLogFrames,
+						"Also log the offsets applied every frame (very verbose)")) {
+						MarkEdited();
+					}
+				}
 			}
 			
 			if (CheckboxWithTooltip("Debug On Screen", &settings->debugOnScreen,
-				"Show debug information on screen (not implemented)")) {
-				State::hasUnsavedChanges = true;
+				"Overlay plotting camera speed, spring offsets and energy, blend factors and frame cost\n"
+				"Recorded in memory every frame while enabled - no file logging needed")) {
+				MarkEdited();
+				SyncOverlay();
+			}
+			if (settings->debugOnScreen) {
+				if (SliderFloatWithTooltip("Overlay History", &settings->debugOnScreenSeconds, 1.0f, 15.0f, "%.0f s",
+					"Seconds of history the overlay plots")) {
+					MarkEdited();
+				}
 			}
 			
 			ImGui::Spacing();
 			
 			if (CheckboxWithTooltip("Enable Hot Reload", &settings->enableHotReload,
 				"Automatically reload INI when file changes on disk\nDisabled when using menu (menu changes take priority)")) {
-				State::hasUnsavedChanges = true;
+				SettingsWatcher::GetSingleton()->SetOptions(settings->enableHotReload, settings->hotReloadIntervalSec);
+				MarkEdited();
 			}
 			
 			if (SliderFloatWithTooltip("Hot Reload Interval", &settings->hotReloadIntervalSec, 1.0f, 60.0f, "%.0f sec",
 				"How often to check for INI changes")) {
-				State::hasUnsavedChanges = true;
+				SettingsWatcher::GetSingleton()->SetOptions(settings->enableHotReload, settings->hotReloadIntervalSec);
+				MarkEdited();
+			}
+			
+			ImGui::Spacing();
+			
+			// Spring sleep stats
+			auto* inertia = Inertia::InertiaManager::GetSingleton();
+			ImGui::Text("Sleeping springs: %d / %d", inertia->GetSleepingSlotCount(), Inertia::SpringBank::kSlotCount);
+			ImGui::Text("Avoided updates: %.0f / sec", inertia->GetAvoidedUpdatesPerSecond());
+			if (ImGui::IsItemHovered()) {
+				ImGui::SetTooltip("Spring updates skipped because the spring was settled at rest");
+			}
+			ImGui::Text("Missed worker deadlines: %u", inertia->GetMissedWorkerDeadlines());
+			if (ImGui::IsItemHovered()) {
+				ImGui::SetTooltip("Frames where the worker thread was late and the previous pose was reused");
+			}
+			auto* logRing = LogRing::GetSingleton();
+			ImGui::Text("Log messages dropped: %llu (truncated: %llu)",
+				static_cast<unsigned long long>(logRing->GetDroppedCount()),
+				static_cast<unsigned long long>(logRing->GetTruncatedCount()));
+			if (ImGui::IsItemHovered()) {
+				ImGui::SetTooltip("Messages the log writer couldn't keep up with, and messages cut short");
+			}
+			
+			ImGui::Spacing();
+			
+			// Input trace recording (not saved - starts off every session)
+			auto* recorder = Inertia::TraceRecorder::GetSingleton();
+			bool recordTrace = recorder->IsRequested();
+			if (CheckboxWithTooltip("Record Input Trace", &recordTrace,
+				"Record every frame's inertia inputs and resulting offsets to\nData/SKSE/Plugins/FPInertia/Traces so jitter can be reproduced offline.\nStops when unticked; each recording is a new file.")) {
+				recorder->RequestRecording(recordTrace);
+			}
+			if (recorder->IsRecording()) {
+				ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "[REC]");
+				ImGui::SameLine();
+				ImGui::Text("%s - %u frames, %llu KB", recorder->GetFileName().c_str(), recorder->GetFramesRecorded(),
+					static_cast<unsigned long long>(recorder->GetBytesWritten() / 1024));
+				if (recorder->GetDroppedRecords() > 0) {
+					ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.3f, 1.0f), "Dropped %u records (disk too slow)", recorder->GetDroppedRecords());
+				}
+			}
+			
+			// Telemetry CSV capture (not saved - starts off every session)
+			auto* telemetryCapture = Inertia::TelemetryCapture::GetSingleton();
+			bool captureTelemetry = telemetryCapture->IsRequested();
+			if (CheckboxWithTooltip("Capture Telemetry CSV", &captureTelemetry,
+				"Capture every frame's spring offsets and velocities, blend factors and frame cost in memory.\n"
+				"Written to Data/SKSE/Plugins/FPInertia/Telemetry as a CSV when unticked - for graphing a preset in a spreadsheet.")) {
+				telemetryCapture->RequestCapture(captureTelemetry);
+			}
+			if (telemetryCapture->IsCapturing()) {
+				ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "[REC]");
+				ImGui::SameLine();
+				ImGui::Text("%u / %u frames", telemetryCapture->GetFramesCaptured(), Inertia::TelemetryCapture::GetCapacity());
+				if (telemetryCapture->GetDroppedFrames() > 0) {
+					ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.3f, 1.0f), "Buffer full - %u frames not captured", telemetryCapture->GetDroppedFrames());
+				}
 			}
 			
 			ImGui::Spacing();
@@ -716,7 +920,7 @@ namespace Menu
 			ImGui::Text("Quick Actions:");
 			
 			if (ImGui::Button("Reset Springs")) {
-				Inertia::InertiaManager::GetSingleton()->Reset();
+				Inertia::InertiaManager::GetSingleton()->RequestReset();
 			}
 			if (ImGui::IsItemHovered()) {
 				ImGui::SetTooltip("Reset all spring states to zero (stops any current motion)");
@@ -726,6 +930,201 @@ namespace Menu
 		}
 	}
 	
+	void DrawPerformanceStats()
+	{
+		if (ImGui::CollapsingHeader("Performance", State::performanceExpanded ? ImGuiTreeNodeFlags_DefaultOpen : 0)) {
+			State::performanceExpanded = true;
+			
+			auto* perf = PerfStats::GetSingleton();
+			using Counter = PerfStats::Counter;
+			
+			// Game thread cost per frame: the main update hook plus the first person hook
+			const auto mainUpdate = perf->Get(Counter::kMainUpdate).Summarize();
+			const auto firstPerson = perf->Get(Counter::kFirstPersonUpdate).Summarize();
+			const float frameP99 = static_cast<float>(mainUpdate.p99Us + firstPerson.p99Us);
+			const ImVec4 budgetColor = frameP99 <= State::perfBudgetUs ? ImVec4(0.4f, 1.0f, 0.4f, 1.0f) : ImVec4(1.0f, 0.4f, 0.4f, 1.0f);
+			ImGui::TextColored(budgetColor, "Per frame (p99): %.1f us of %.0f us budget", frameP99, State::perfBudgetUs);
+			SliderFloatWithTooltip("Budget", &State::perfBudgetUs, 10.0f, 1000.0f, "%.0f us",
+				"Target for the main update and first person hooks together (not saved)");
+			
+			if (ImGui::BeginTable("PerfTable", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit)) {
+				ImGui::TableSetupColumn("Section");
+				ImGui::TableSetupColumn("Samples");
+				ImGui::TableSetupColumn("Mean us");
+				ImGui::TableSetupColumn("p50");
+				ImGui::TableSetupColumn("p95");
+				ImGui::TableSetupColumn("p99");
+				ImGui::TableSetupColumn("Max");
+				ImGui::TableHeadersRow();
+				for (std::uint32_t i = 0; i < static_cast<std::uint32_t>(Counter::kTotal); ++i) {
+					const auto counter = static_cast<Counter>(i);
+					const auto summary = perf->Get(counter).Summarize();
+					ImGui::TableNextRow();
+					ImGui::TableNextColumn();
+					ImGui::Text("%s", PerfStats::GetName(counter));
+					ImGui::TableNextColumn();
+					ImGui::Text("%llu", static_cast<unsigned long long>(summary.count));
+					ImGui::TableNextColumn();
+					ImGui::Text("%.2f", summary.meanUs);
+					ImGui::TableNextColumn();
+					ImGui::Text("%.2f", summary.p50Us);
+					ImGui::TableNextColumn();
+					ImGui::Text("%.2f", summary.p95Us);
+					ImGui::TableNextColumn();
+					ImGui::Text("%.2f", summary.p99Us);
+					ImGui::TableNextColumn();
+					ImGui::Text("%.2f", summary.maxUs);
+				}
+				ImGui::EndTable();
+			}
+			
+			ImGui::Text("Weapon settings cache: %llu hits, %llu misses",
+				static_cast<unsigned long long>(perf->GetWeaponCacheHits()),
+				static_cast<unsigned long long>(perf->GetWeaponCacheMisses()));
+			
+			if (ImGui::Button("Reset Counters")) {
+				perf->Reset();
+			}
+			ImGui::SameLine();
+			if (ImGui::Button("Dump to File")) {
+				perf->Dump();
+			}
+			if (ImGui::IsItemHovered()) {
+				ImGui::SetTooltip("Write this table to Data/SKSE/Plugins/FPInertia/Perf");
+			}
+			
+			if constexpr (Inertia::Perf::kZonesEnabled) {
+				ImGui::Separator();
+				ImGui::Text("Trace Capture");
+				if (Inertia::Perf::IsCapturingZones()) {
+					ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "Capturing: %llu zones (%llu dropped)",
+						static_cast<unsigned long long>(Inertia::Perf::GetRecordedZoneCount()),
+						static_cast<unsigned long long>(Inertia::Perf::GetDroppedZoneCount()));
+					if (ImGui::Button("Stop and Save Capture")) {
+						perf->DumpZones();
+					}
+				} else {
+					if (ImGui::Button("Start Capture")) {
+						Inertia::Perf::StartZoneCapture();
+					}
+					if (ImGui::IsItemHovered()) {
+						ImGui::SetTooltip("Record the hook, preset and spring zones on every thread.\n"
+							"Saved as Chrome trace JSON (open in ui.perfetto.dev or chrome://tracing)");
+					}
+				}
+			}
+		} else {
+			State::performanceExpanded = false;
+		}
+	}
+	
+	void SyncOverlay()
+	{
+		if (State::overlayWindow) {
+			State::overlayWindow->IsOpen.store(Settings::GetSingleton()->debugOnScreen, std::memory_order_relaxed);
+		}
+	}
+	
+	void __stdcall RenderOverlayHud()
+	{
+		if (!Settings::GetSingleton()->debugOnScreen) {
+			return;
+		}
+		ImGui::SetNextWindowPos(ImVec2(20.0f, 20.0f), ImGuiCond_FirstUseEver, ImVec2(0.0f, 0.0f));
+		ImGui::SetNextWindowBgAlpha(0.6f);
+		constexpr ImGuiWindowFlags flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoNav |
+			ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoFocusOnAppearing;
+		if (ImGui::Begin("FP Inertia Telemetry##Hud", nullptr, flags)) {
+			DrawTelemetry();
+		}
+		ImGui::End();
+	}
+	
+	void __stdcall RenderOverlayWindow()
+	{
+		bool open = true;
+		ImGui::SetNextWindowSize(ImVec2(380.0f, 0.0f), ImGuiCond_FirstUseEver);
+		ImGui::SetNextWindowBgAlpha(0.8f);
+		if (ImGui::Begin("FP Inertia Telemetry", &open, ImGuiWindowFlags_NoCollapse)) {
+			DrawTelemetry();
+		}
+		ImGui::End();
+		
+		// Closing the window turns the overlay off
+		if (!open) {
+			Settings::GetSingleton()->debugOnScreen = false;
+			MarkEdited();
+			SyncOverlay();
+		}
+	}
+	
+	namespace
+	{
+		using TelemetrySample = Inertia::Core::TelemetrySample;
+		
+		// One series of the samples: a_first is the plotted field in a_samples[0]
+		void PlotTelemetry(const char* a_label, std::span<const TelemetrySample> a_samples, const float* a_first,
+			float a_min, float a_max, const char* a_unit = "")
+		{
+			constexpr int stride = static_cast<int>(sizeof(TelemetrySample));
+			const int count = static_cast<int>(a_samples.size());
+			const float latest = *reinterpret_cast<const float*>(reinterpret_cast<const char*>(a_first) + (count - 1) * stride);
+			const std::string overlay = std::format("{} {:.2f}{}", a_label, latest, a_unit);
+			
+			ImGui::PushID(a_label);
+			ImGui::PlotLines("##Plot", a_first, count, 0, overlay.c_str(), a_min, a_max, ImVec2(340.0f, 36.0f), stride);
+			ImGui::PopID();
+		}
+	}
+	
+	void DrawTelemetry()
+	{
+		// The ring is copied once per render (static - it is too big for the stack); everything below
+		// plots from the copy while the game thread keeps writing
+		static Inertia::Core::TelemetryRing::Copy copy;
+		std::span<const TelemetrySample> samples = Inertia::InertiaManager::GetSingleton()->GetTelemetry().CopyTo(copy);
+		
+		if (!samples.empty()) {
+			const double from = samples.back().time - Settings::GetSingleton()->debugOnScreenSeconds;
+			auto first = std::lower_bound(samples.begin(), samples.end(), from,
+				[](const TelemetrySample& a_sample, double a_time) { return a_sample.time < a_time; });
+			samples = samples.subspan(static_cast<std::size_t>(first - samples.begin()));
+		}
+		if (samples.size() < 2) {
+			ImGui::TextDisabled("Waiting for frames...");
+			return;
+		}
+		
+		const auto& s = samples.front();
+		ImGui::Text("Last %.1f s (%zu frames)", samples.back().time - s.time, samples.size());
+		
+		ImGui::SeparatorText("Camera");
+		PlotTelemetry("Speed", samples, &s.cameraSpeed, 0.0f, FLT_MAX);
+		
+		static constexpr const char* springNames[] = { "Camera", "Movement", "Sprint", "Jump" };
+		ImGui::SeparatorText("Spring Offset");
+		for (std::size_t i = 0; i < s.offset.size(); ++i) {
+			ImGui::PushID(static_cast<int>(i));
+			PlotTelemetry(springNames[i], samples, &s.offset[i], 0.0f, FLT_MAX);
+			ImGui::PopID();
+		}
+		ImGui::SeparatorText("Spring Energy");
+		for (std::size_t i = 0; i < s.energy.size(); ++i) {
+			ImGui::PushID(static_cast<int>(i + s.offset.size()));
+			PlotTelemetry(springNames[i], samples, &s.energy[i], 0.0f, FLT_MAX);
+			ImGui::PopID();
+		}
+		
+		ImGui::SeparatorText("Blends");
+		PlotTelemetry("Equip", samples, &s.equipBlend, 0.0f, 1.0f);
+		PlotTelemetry("Action", samples, &s.actionBlend, 0.0f, 1.0f);
+		PlotTelemetry("Air", samples, &s.airBlend, 0.0f, 1.0f);
+		PlotTelemetry("Settling", samples, &s.settling, 0.0f, 1.0f);
+		
+		ImGui::SeparatorText("Frame Cost");
+		PlotTelemetry("Game thread", samples, &s.costUs, 0.0f, FLT_MAX, " us");
+	}
+	
 	void DrawWeaponTypeSettings()
 	{
 		auto* settings = Settings::GetSingleton();
@@ -821,6 +1220,7 @@ namespace Menu
 						const auto& currentSettings = GetWeaponSettingsForEditingByEntry(entry);
 						auto& specificSettings = presets->GetOrCreateSpecificWeaponSettings(equippedWeaponID, entry.type);
 						specificSettings = currentSettings;
+						presets->PublishSnapshot();
 						presets->SaveSpecificWeaponPreset(equippedWeaponID);
 						RE::DebugNotification(std::format("Updated specific preset for {}", equippedWeaponID).c_str());
 					}
@@ -853,6 +1253,7 @@ namespace Menu
 						const auto& currentSettings = GetWeaponSettingsForEditingByEntry(entry);
 						auto& specificSettings = presets->GetOrCreateSpecificWeaponSettings(equippedWeaponID, weaponType);
 						specificSettings = currentSettings;
+						presets->PublishSnapshot();
 						presets->SaveSpecificWeaponPreset(equippedWeaponID);
 						RE::DebugNotification(std::format("Created specific preset for {}", equippedWeaponID).c_str());
 					}
@@ -1209,26 +1610,11 @@ namespace Menu
 					const auto& sourceEntry = types[State::selectedWeaponTypeIndex];
 					const auto& sourceSettings = GetWeaponSettingsForEditingByEntry(sourceEntry);
 					
-					// Temporarily switch to target preset, copy, then switch back
-					std::string currentPreset = presets->GetActivePresetName();
-					presets->SetActivePreset(targetPreset);
-					
-					// Get target settings and copy
-					auto& targetSettings = GetWeaponSettingsForEditingByEntry(sourceEntry);
-					targetSettings = sourceSettings;  // Copy all settings
-					
-					// Save to the target preset
-					presets->SaveWeaponTypePresets();
-					
-					// Switch back to original preset
-					presets->SetActivePreset(currentPreset);
-					
-					// Show notification
-					RE::DebugNotification(std::format("Copied {} settings to preset '{}'", 
-						State::copySourceWeaponType, targetPreset).c_str());
+					// Rewrite that one entry in the target file; reported when it's written
+					presets->CopyWeaponTypeToPreset(targetPreset, sourceEntry.internalName, sourceEntry.isCustomType, sourceSettings);
 					
-					logger::info("[FPInertia] Copied {} settings from '{}' to '{}'",
-						State::copySourceWeaponType, currentPreset, targetPreset);
+					logger::info("[FPInertia] Copying {} settings from '{}' to '{}'",
+						State::copySourceWeaponType, presets->GetActivePresetName(), targetPreset);
 					
 					State::showCopyToPresetPopup = false;
 					ImGui::CloseCurrentPopup();
@@ -1274,7 +1660,7 @@ namespace Menu
 		// Master Enable/Disable Toggle
 		ImGui::PushStyleColor(ImGuiCol_Text, settings.enabled ? ImVec4(0.4f, 1.0f, 0.4f, 1.0f) : ImVec4(1.0f, 0.4f, 0.4f, 1.0f));
 		if (ImGui::Checkbox("Enable Inertia for This Weapon Type", &settings.enabled)) {
-			State::hasUnsavedChanges = true;
+			MarkEdited();
 		}
 		ImGui::PopStyleColor();
 		if (ImGui::IsItemHovered()) {
@@ -1298,27 +1684,27 @@ namespace Menu
 			
 			if (SliderFloatWithTooltip("Stiffness##cam", &settings.stiffness, 10.0f, 1000.0f, "%.0f",
 				"Spring stiffness - higher = faster return to center\nLighter weapons should have higher values")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (SliderFloatWithTooltip("Damping##cam", &settings.damping, 1.0f, 100.0f, "%.1f",
 				"Damping - reduces oscillation/wobble\nHigher = less bouncy")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (SliderFloatWithTooltip("Max Offset##cam", &settings.maxOffset, 0.0f, 50.0f, "%.1f",
 				"Maximum position offset in units\nLimits how far the weapon can move")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (SliderFloatWithTooltip("Max Rotation##cam", &settings.maxRotation, 0.0f, 90.0f, "%.1f deg",
 				"Maximum rotation offset in degrees")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (SliderFloatWithTooltip("Mass##cam", &settings.mass, 0.1f, 10.0f, "%.2f",
 				"Virtual mass - heavier = more inertia/lag\nDaggers: 0.5, Swords: 1.0, Battleaxes: 2.5")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			ImGui::Spacing();
@@ -1326,27 +1712,27 @@ namespace Menu
 			
 			if (SliderFloatWithTooltip("Pitch Mult##cam", &settings.pitchMultiplier, 0.0f, 5.0f, "%.2f",
 				"Multiplier for pitch ROTATION effect (looking up/down tilt)")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (SliderFloatWithTooltip("Roll Mult##cam", &settings.rollMultiplier, 0.0f, 5.0f, "%.2f",
 				"Multiplier for roll effect (wavy side-to-side motion)\nStaffs benefit from higher values")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (SliderFloatWithTooltip("Global Pitch Mult##cam", &settings.cameraPitchMult, 0.0f, 5.0f, "%.2f",
 				"Global multiplier for ALL pitch effects (position + rotation)")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (CheckboxWithTooltip("Invert Pitch (Up/Down)##cam", &settings.invertCameraPitch,
 				"Invert the pitch (up/down look) camera inertia")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			ImGui::SameLine();
 			if (CheckboxWithTooltip("Invert Yaw (Left/Right)##cam", &settings.invertCameraYaw,
 				"Invert the yaw (left/right look) camera inertia")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			ImGui::TreePop();
@@ -1359,28 +1745,28 @@ namespace Menu
 			// Per-weapon enable
 			if (CheckboxWithTooltip("Enable##mov", &settings.movementInertiaEnabled,
 				"Enable movement inertia for this weapon type\n(Also requires global movement inertia to be enabled)")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (settings.movementInertiaEnabled) {
 				if (SliderFloatWithTooltip("Stiffness##mov", &settings.movementStiffness, 10.0f, 500.0f, "%.0f",
 					"Spring stiffness for movement response")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				if (SliderFloatWithTooltip("Damping##mov", &settings.movementDamping, 1.0f, 50.0f, "%.1f",
 					"Damping for movement spring")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				if (SliderFloatWithTooltip("Max Offset##mov", &settings.movementMaxOffset, 0.0f, 50.0f, "%.1f",
 					"Maximum position offset from strafing")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				if (SliderFloatWithTooltip("Max Rotation##mov", &settings.movementMaxRotation, 0.0f, 90.0f, "%.1f deg",
 					"Maximum rotation from strafing")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				ImGui::Spacing();
@@ -1388,12 +1774,12 @@ namespace Menu
 				
 				if (SliderFloatWithTooltip("Left Mult##mov", &settings.movementLeftMult, 0.0f, 5.0f, "%.2f",
 					"Multiplier when strafing LEFT\nSet different from Right for asymmetric feel")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				if (SliderFloatWithTooltip("Right Mult##mov", &settings.movementRightMult, 0.0f, 5.0f, "%.2f",
 					"Multiplier when strafing RIGHT")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				// Show forward/back multipliers only if global forward/back is enabled
@@ -1404,12 +1790,12 @@ namespace Menu
 					
 					if (SliderFloatWithTooltip("Forward Mult##mov", &settings.movementForwardMult, 0.0f, 5.0f, "%.2f",
 						"Multiplier when moving FORWARD\nMoves arms toward camera")) {
-						State::hasUnsavedChanges = true;
+						MarkEdited();
 					}
 					
 					if (SliderFloatWithTooltip("Backward Mult##mov", &settings.movementBackwardMult, 0.0f, 5.0f, "%.2f",
 						"Multiplier when moving BACKWARD\nMoves arms away from camera")) {
-						State::hasUnsavedChanges = true;
+						MarkEdited();
 					}
 				}
 				
@@ -1417,12 +1803,12 @@ namespace Menu
 				
 				if (CheckboxWithTooltip("Invert Lateral (L/R)##mov", &settings.invertMovementLateral,
 					"Invert the left/right strafe movement inertia")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				ImGui::SameLine();
 				if (CheckboxWithTooltip("Invert Forward/Back##mov", &settings.invertMovementForwardBack,
 					"Invert the forward/backward movement inertia")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 			}
 			
@@ -1436,19 +1822,19 @@ namespace Menu
 			
 			if (SliderFloatWithTooltip("Activation Threshold##simul", &settings.simultaneousThreshold, 0.0f, 5.0f, "%.2f",
 				"How much camera AND movement inertia must BOTH be active\nbefore the scaling multipliers below take effect\n0 = always scale when any activity, higher = need more of both")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			ImGui::Spacing();
 			
 			if (SliderFloatWithTooltip("Camera Scale##simul", &settings.simultaneousCameraMult, 0.0f, 2.0f, "%.2fx",
 				"Scale camera inertia when also moving\n1.00 = full effect, 0.50 = half, 0 = disabled when moving")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (SliderFloatWithTooltip("Movement Scale##simul", &settings.simultaneousMovementMult, 0.0f, 2.0f, "%.2fx",
 				"Scale movement inertia when also looking around\n1.00 = full effect, 0.50 = half, 0 = disabled when looking")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			ImGui::TreePop();
@@ -1460,7 +1846,7 @@ namespace Menu
 			
 			if (CheckboxWithTooltip("Enable##sprint", &settings.sprintInertiaEnabled,
 				"Enable sprint transition momentum\nApplies impulse when starting/stopping sprint,\nthen spring settles naturally")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (settings.sprintInertiaEnabled) {
@@ -1469,23 +1855,23 @@ namespace Menu
 				
 				if (SliderFloatWithTooltip("Y Impulse (Depth)##sprint", &settings.sprintImpulseY, 0.0f, 50.0f, "%.1f",
 					"Forward/back impulse on sprint transition\nStart: arms lag behind, Stop: arms overshoot forward")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				if (SliderFloatWithTooltip("Z Impulse (Height)##sprint", &settings.sprintImpulseZ, 0.0f, 30.0f, "%.1f",
 					"Vertical impulse on sprint transition\nStart: slight dip, Stop: slight rise")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				if (SliderFloatWithTooltip("Rotation Impulse##sprint", &settings.sprintRotImpulse, 0.0f, 45.0f, "%.1f deg",
 					"Rotation impulse on sprint transition\nStart: tilt forward, Stop: tilt back")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				ImGui::Spacing();
 				if (SliderFloatWithTooltip("Impulse Blend Time##sprint", &settings.sprintImpulseBlendTime, 0.0f, 1.0f, "%.2f sec",
 					"Time to blend into impulse\n0 = instant (snappy), higher = more gradual")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				ImGui::Spacing();
@@ -1493,12 +1879,12 @@ namespace Menu
 				
 				if (SliderFloatWithTooltip("Stiffness##sprint", &settings.sprintStiffness, 10.0f, 500.0f, "%.0f",
 					"Spring stiffness for settling\nHigher = faster return to neutral")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				if (SliderFloatWithTooltip("Damping##sprint", &settings.sprintDamping, 1.0f, 50.0f, "%.1f",
 					"Damping for sprint spring\nHigher = less oscillation/bounce")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 			}
 			
@@ -1511,14 +1897,14 @@ namespace Menu
 			
 			if (CheckboxWithTooltip("Enable##jump", &settings.jumpInertiaEnabled,
 				"Enable jump/landing momentum\nArms dip on takeoff, compress on landing")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			ImGui::Spacing();
 			
 			if (SliderFloatWithTooltip("Camera Inertia Air Mult##air", &settings.cameraInertiaAirMult, 0.0f, 1.0f, "%.2f",
 				"Camera inertia multiplier while airborne\n0 = no camera inertia in air\n1 = full camera inertia in air")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			if (settings.jumpInertiaEnabled) {
@@ -1527,17 +1913,17 @@ namespace Menu
 				
 				if (SliderFloatWithTooltip("Jump Y Impulse##jump", &settings.jumpImpulseY, 0.0f, 30.0f, "%.1f",
 					"Forward/back impulse when jumping\nArms lag behind as you push off")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				if (SliderFloatWithTooltip("Jump Z Impulse##jump", &settings.jumpImpulseZ, 0.0f, 30.0f, "%.1f",
 					"Vertical impulse when jumping\nArms dip down as you push off")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				if (SliderFloatWithTooltip("Jump Rotation##jump", &settings.jumpRotImpulse, 0.0f, 30.0f, "%.1f deg",
 					"Rotation impulse when jumping")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				ImGui::Spacing();
@@ -1546,17 +1932,17 @@ namespace Menu
 				
 				if (SliderFloatWithTooltip("Fall Y Impulse##fall", &settings.fallImpulseY, 0.0f, 30.0f, "%.1f",
 					"Forward/back impulse when falling off ledge\nGentler than jump - just arms following momentum")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				if (SliderFloatWithTooltip("Fall Z Impulse##fall", &settings.fallImpulseZ, 0.0f, 30.0f, "%.1f",
 					"Vertical impulse when falling off ledge\nSlighter than jump - no push-off motion")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				if (SliderFloatWithTooltip("Fall Rotation##fall", &settings.fallRotImpulse, 0.0f, 30.0f, "%.1f deg",
 					"Rotation impulse when falling off ledge")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				ImGui::Spacing();
@@ -1564,12 +1950,12 @@ namespace Menu
 				
 				if (SliderFloatWithTooltip("Airborne Stiffness##jump", &settings.jumpStiffness, 10.0f, 200.0f, "%.0f",
 					"Spring stiffness while in the air\nLow = floaty, retains motion longer")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				if (SliderFloatWithTooltip("Airborne Damping##jump", &settings.jumpDamping, 1.0f, 20.0f, "%.1f",
 					"Damping while in the air\nLow = more bounce/oscillation in air")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				ImGui::Spacing();
@@ -1577,34 +1963,34 @@ namespace Menu
 				
 				if (SliderFloatWithTooltip("Land Y Impulse##land", &settings.landImpulseY, 0.0f, 30.0f, "%.1f",
 					"Forward/back impulse on landing")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				if (SliderFloatWithTooltip("Land Z Impulse##land", &settings.landImpulseZ, 0.0f, 50.0f, "%.1f",
 					"Vertical impulse on landing\nArms compress down on impact")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				if (SliderFloatWithTooltip("Land Rotation##land", &settings.landRotImpulse, 0.0f, 30.0f, "%.1f deg",
 					"Rotation impulse on landing")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				if (SliderFloatWithTooltip("Land Stiffness##land", &settings.landStiffness, 20.0f, 500.0f, "%.0f",
 					"Spring stiffness on landing\nHigh = quick recovery from impact")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				if (SliderFloatWithTooltip("Land Damping##land", &settings.landDamping, 2.0f, 50.0f, "%.1f",
 					"Damping on landing\nHigh = less bounce after landing")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 				
 				ImGui::Spacing();
 				
 				if (SliderFloatWithTooltip("Air Time Scale##air", &settings.airTimeImpulseScale, 0.0f, 5.0f, "%.2f",
 					"How much air time affects landing impulse\n0 = no scaling, higher = bigger impact from longer falls")) {
-					State::hasUnsavedChanges = true;
+					MarkEdited();
 				}
 			}
 			
@@ -1631,7 +2017,7 @@ namespace Menu
 					bool isSelected = (settings.pivotPoint == i);
 					if (ImGui::Selectable(pivotNames[i], isSelected)) {
 						settings.pivotPoint = i;
-						State::hasUnsavedChanges = true;
+						MarkEdited();
 					}
 					if (ImGui::IsItemHovered()) {
 						ImGui::SetTooltip("%s", pivotTooltips[i]);
@@ -1666,18 +2052,18 @@ namespace Menu
 			ImGui::PushItemWidth(120.0f);
 			if (SliderFloatWithTooltip("Mult##stanceNeutral", &settings.stanceMultipliers[0], 0.0f, 5.0f, "%.2f",
 				"Intensity multiplier when no stance is active\n0 = no inertia, 1 = normal, 2 = double")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			ImGui::PopItemWidth();
 			ImGui::SameLine();
 			if (CheckboxWithTooltip("Inv Cam##stanceNeutralCam", &settings.stanceInvertCamera[0],
 				"Invert camera inertia when in Neutral stance\n(XORs with base invert setting)")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			ImGui::SameLine();
 			if (CheckboxWithTooltip("Inv Mov##stanceNeutralMov", &settings.stanceInvertMovement[0],
 				"Invert movement inertia when in Neutral stance\n(XORs with base invert setting)")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 
 			// Low stance
@@ -1685,18 +2071,18 @@ namespace Menu
 			ImGui::PushItemWidth(120.0f);
 			if (SliderFloatWithTooltip("Mult##stanceLow", &settings.stanceMultipliers[1], 0.0f, 5.0f, "%.2f",
 				"Intensity multiplier when in Low stance\n0 = no inertia, 1 = normal, 2 = double")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			ImGui::PopItemWidth();
 			ImGui::SameLine();
 			if (CheckboxWithTooltip("Inv Cam##stanceLowCam", &settings.stanceInvertCamera[1],
 				"Invert camera inertia when in Low stance\n(XORs with base invert setting)")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			ImGui::SameLine();
 			if (CheckboxWithTooltip("Inv Mov##stanceLowMov", &settings.stanceInvertMovement[1],
 				"Invert movement inertia when in Low stance\n(XORs with base invert setting)")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 
 			// Mid stance
@@ -1704,18 +2090,18 @@ namespace Menu
 			ImGui::PushItemWidth(120.0f);
 			if (SliderFloatWithTooltip("Mult##stanceMid", &settings.stanceMultipliers[2], 0.0f, 5.0f, "%.2f",
 				"Intensity multiplier when in Mid stance\n0 = no inertia, 1 = normal, 2 = double")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			ImGui::PopItemWidth();
 			ImGui::SameLine();
 			if (CheckboxWithTooltip("Inv Cam##stanceMidCam", &settings.stanceInvertCamera[2],
 				"Invert camera inertia when in Mid stance\n(XORs with base invert setting)")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			ImGui::SameLine();
 			if (CheckboxWithTooltip("Inv Mov##stanceMidMov", &settings.stanceInvertMovement[2],
 				"Invert movement inertia when in Mid stance\n(XORs with base invert setting)")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 
 			// High stance
@@ -1723,18 +2109,18 @@ namespace Menu
 			ImGui::PushItemWidth(120.0f);
 			if (SliderFloatWithTooltip("Mult##stanceHigh", &settings.stanceMultipliers[3], 0.0f, 5.0f, "%.2f",
 				"Intensity multiplier when in High stance\n0 = no inertia, 1 = normal, 2 = double")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			ImGui::PopItemWidth();
 			ImGui::SameLine();
 			if (CheckboxWithTooltip("Inv Cam##stanceHighCam", &settings.stanceInvertCamera[3],
 				"Invert camera inertia when in High stance\n(XORs with base invert setting)")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			ImGui::SameLine();
 			if (CheckboxWithTooltip("Inv Mov##stanceHighMov", &settings.stanceInvertMovement[3],
 				"Invert movement inertia when in High stance\n(XORs with base invert setting)")) {
-				State::hasUnsavedChanges = true;
+				MarkEdited();
 			}
 			
 			ImGui::TreePop();
@@ -1799,7 +2185,7 @@ namespace Menu
 				settings.stanceInvertCamera[i] = false;
 				settings.stanceInvertMovement[i] = false;
 			}
-			State::hasUnsavedChanges = true;
+			MarkEdited();
 		}
 		if (ImGui::IsItemHovered()) {
 			ImGui::SetTooltip("Reset this weapon type to default values");
@@ -1862,7 +2248,7 @@ namespace Menu
 							// Create the preset (copies from weapon type settings)
 							presets->GetOrCreateSpecificWeaponSettings(weaponID, weaponType);
 							presets->SaveSpecificWeaponPreset(weaponID);
-							State::hasUnsavedChanges = true;
+							MarkEdited();
 						}
 						if (ImGui::IsItemHovered()) {
 							ImGui::SetTooltip("Create a custom preset for this specific weapon, copied from its weapon type defaults");
@@ -1889,7 +2275,7 @@ namespace Menu
 					if (!presets->HasSpecificWeaponSettings(State::newWeaponEditorID)) {
 						presets->GetOrCreateSpecificWeaponSettings(State::newWeaponEditorID, WeaponType::Unarmed);
 						presets->SaveSpecificWeaponPreset(State::newWeaponEditorID);
-						State::hasUnsavedChanges = true;
+						MarkEdited();
 					}
 				}
 			}
@@ -1942,7 +2328,7 @@ namespace Menu
 						
 						// Save button for this preset
 						if (ImGui::Button("Save This Preset")) {
-							presets->SaveSpecificWeaponPreset(selectedEditorID);
+							presets->SaveSpecificWeaponPreset(selectedEditorID, true);
 						}
 						if (ImGui::IsItemHovered()) {
 							ImGui::SetTooltip("Save changes to this specific weapon preset");
@@ -2002,7 +2388,7 @@ namespace Menu
 			settings->Load();
 			// Reset presets to INI values (ignores JSON files)
 			presets->ResetToINIValues();
-			State::hasUnsavedChanges = true;
+			MarkEdited();
 			RE::DebugNotification("FP Inertia: Settings reset to INI defaults");
 		}
 		if (ImGui::IsItemHovered()) {
@@ -2019,10 +2405,9 @@ namespace Menu
 		// Save weapon type presets to JSON
 		std::string saveButtonLabel = std::format("Save to '{}.json'", presets->GetActivePresetName());
 		if (ImGui::Button(saveButtonLabel.c_str())) {
-			presets->SaveWeaponTypePresets();
+			presets->SaveWeaponTypePresets(true);
 			presets->ClearDirty();
 			State::hasUnsavedChanges = false;
-			RE::DebugNotification(std::format("FP Inertia: Saved preset '{}'", presets->GetActivePresetName()).c_str());
 		}
 		if (ImGui::IsItemHovered()) {
 			ImGui::SetTooltip("Save current weapon type settings to:\nData/SKSE/Plugins/FPInertia/%s.json", 
@@ -2034,10 +2419,9 @@ namespace Menu
 		// Reload presets from JSON
 		std::string reloadButtonLabel = std::format("Reload '{}.json'", presets->GetActivePresetName());
 		if (ImGui::Button(reloadButtonLabel.c_str())) {
-			presets->LoadAllPresets();
+			presets->ReloadAllPresets();
 			presets->ClearDirty();
 			State::hasUnsavedChanges = false;
-			RE::DebugNotification(std::format("FP Inertia: Reloaded preset '{}'", presets->GetActivePresetName()).c_str());
 		}
 		if (ImGui::IsItemHovered()) {
 			ImGui::SetTooltip("Reload weapon type settings from:\nData/SKSE/Plugins/FPInertia/%s.json", 
@@ -13,6 +13,12 @@ namespace Menu
 	// Main render callback for SKSE Menu Framework
 	void __stdcall Render();
 	
+	// Telemetry overlay (Settings::debugOnScreen): a HUD element when the framework supports them,
+	// otherwise a window. SyncOverlay opens/closes the window to match the setting.
+	void __stdcall RenderOverlayHud();
+	void __stdcall RenderOverlayWindow();
+	void SyncOverlay();
+	
 	// Internal state for menu
 	namespace State
 	{
@@ -38,6 +44,9 @@ namespace Menu
 		inline bool actionBlendExpanded{ false };
 		inline bool handsExpanded{ false };
 		inline bool debugExpanded{ false };
+		inline bool performanceExpanded{ false };
+		inline float perfBudgetUs{ 100.0f };  // Per-frame target the Performance section checks against (not saved)
+		inline SKSEMenuFramework::Model::WindowInterface* overlayWindow{ nullptr };  // Null when the overlay is a HUD element
 		inline bool weaponSettingsExpanded{ true };
 		inline bool specificWeaponExpanded{ false };
 		
@@ -87,14 +96,22 @@ namespace Menu
 	void DrawActionBlendSettings();
 	void DrawHandsSettings();
 	void DrawDebugSettings();
+	void DrawPerformanceStats();
+	void DrawTelemetry();
 	void DrawWeaponTypeSettings();
 	void DrawSpecificWeaponSettings();
 	void DrawWeaponInertiaEditor(WeaponInertiaSettings& settings, const char* label);
 	void DrawSaveLoadButtons();
 	
-	// Refresh cached preset list
+	// Refresh cached preset list (listed in the background, updated by ProcessPresetIO)
 	void RefreshPresetList();
 	
+	// Apply finished preset I/O and show its notifications (every menu frame)
+	void ProcessPresetIO();
+	
+	// Flag unsaved changes and publish a new preset snapshot (the game thread rebuilds its spring coefficients)
+	void MarkEdited();
+	
 	// Helper for sliders with tooltips
 	bool SliderFloatWithTooltip(const char* label, float* value, float min, float max, const char* format, const char* tooltip);
 	bool CheckboxWithTooltip(const char* label, bool* value, const char* tooltip);
@@ -0,0 +1,121 @@
+#include "PerfStats.h"
+#include "PresetIO.h"
+#include "TraceZones.h"
+
+#include <format>
+
+namespace
+{
+	std::filesystem::path GetPerfFolderPath()
+	{
+		return std::filesystem::path("Data/SKSE/Plugins/FPInertia/Perf");
+	}
+}
+
+const char* PerfStats::GetName(Counter a_counter)
+{
+	switch (a_counter) {
+	case Counter::kMainUpdate:
+		return "Main update hook";
+	case Counter::kUpdate:
+		return "Update";
+	case Counter::kWeaponSettings:
+		return "Weapon settings lookup";
+	case Counter::kSpringState:
+		return "Spring state / wake";
+	case Counter::kCameraSpring:
+		return "Camera spring";
+	case Counter::kMovementSpring:
+		return "Movement spring";
+	case Counter::kSprintSpring:
+		return "Sprint spring";
+	case Counter::kJumpSpring:
+		return "Jump spring";
+	case Counter::kIntegrate:
+		return "Integrate";
+	case Counter::kCombine:
+		return "Combine";
+	case Counter::kPivotNode:
+		return "Pivot node lookup";
+	case Counter::kClavicleNode:
+		return "Clavicle node lookup";
+	case Counter::kFirstPersonUpdate:
+		return "First person update hook";
+	default:
+		return "Unknown";
+	}
+}
+
+void PerfStats::RecordStages(const Inertia::Core::StageTimes& a_times)
+{
+	using Stage = Inertia::Core::StageTimes::Stage;
+	auto record = [this](Counter a_counter, const Stage& a_stage) {
+		if (a_stage.laps > 0) {
+			Get(a_counter).Record(static_cast<std::uint64_t>(a_stage.ns));
+		}
+	};
+	record(Counter::kSpringState, a_times.state);
+	record(Counter::kCameraSpring, a_times.camera);
+	record(Counter::kMovementSpring, a_times.movement);
+	record(Counter::kSprintSpring, a_times.sprint);
+	record(Counter::kJumpSpring, a_times.jump);
+	record(Counter::kIntegrate, a_times.integrate);
+	record(Counter::kCombine, a_times.combine);
+}
+
+void PerfStats::CountWeaponLookup(bool a_cacheHit)
+{
+	(a_cacheHit ? weaponCacheHits : weaponCacheMisses).fetch_add(1, std::memory_order_relaxed);
+}
+
+void PerfStats::Reset()
+{
+	for (auto& histogram : histograms) {
+		histogram.Reset();
+	}
+	weaponCacheHits.store(0, std::memory_order_relaxed);
+	weaponCacheMisses.store(0, std::memory_order_relaxed);
+}
+
+void PerfStats::Dump()
+{
+	// Table built here (menu thread), written on the I/O thread
+	std::string text = std::format("{:<28}{:>10}{:>10}{:>10}{:>10}{:>10}{:>10}\n",
+		"Section (us)", "Samples", "Mean", "p50", "p95", "p99", "Max");
+	for (std::uint32_t i = 0; i < static_cast<std::uint32_t>(Counter::kTotal); ++i) {
+		const auto counter = static_cast<Counter>(i);
+		const auto summary = Get(counter).Summarize();
+		text += std::format("{:<28}{:>10}{:>10.2f}{:>10.2f}{:>10.2f}{:>10.2f}{:>10.2f}\n",
+			GetName(counter), summary.count, summary.meanUs, summary.p50Us, summary.p95Us, summary.p99Us, summary.maxUs);
+	}
+	text += std::format("\nWeapon settings cache: {} hits, {} misses\n", GetWeaponCacheHits(), GetWeaponCacheMisses());
+
+	auto path = PresetIO::MakeTimestampedPath(GetPerfFolderPath(), ".txt");
+	PresetIO::GetSingleton()->Run([path, text = std::move(text)]() {
+		std::error_code ec;
+		std::filesystem::create_directories(path.parent_path(), ec);
+		if (!PresetIO::WriteFileAtomic(path, text)) {
+			return PresetIO::Completion{ false, "Could not write performance counters", {} };
+		}
+		logger::info("Performance counters written to {}", path.string());
+		return PresetIO::Completion{ true, std::format("Performance counters written to {}", path.filename().string()), {} };
+	});
+}
+
+void PerfStats::DumpZones()
+{
+	Inertia::Perf::StopZoneCapture();
+	auto path = PresetIO::MakeTimestampedPath(GetPerfFolderPath(), ".json");
+
+	// The JSON (several MB for a long capture) is built on the I/O thread too
+	PresetIO::GetSingleton()->Run([path]() {
+		std::error_code ec;
+		std::filesystem::create_directories(path.parent_path(), ec);
+		if (!PresetIO::WriteFileAtomic(path, Inertia::Perf::ZonesToChromeJson())) {
+			return PresetIO::Completion{ false, "Could not write trace capture", {} };
+		}
+		logger::info("Trace capture ({} zones, {} dropped) written to {}", Inertia::Perf::GetRecordedZoneCount(),
+			Inertia::Perf::GetDroppedZoneCount(), path.string());
+		return PresetIO::Completion{ true, std::format("Trace capture written to {}", path.filename().string()), {} };
+	});
+}
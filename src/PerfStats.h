@@ -0,0 +1,75 @@
+#pragma once
+
+#include "InertiaFrame.h"
+#include "PerfHistogram.h"
+
+#include <atomic>
+
+// What FPInertia costs per frame, for the menu's Performance section
+//
+// One histogram per instrumented section (timed with the TSC, recorded lock-free), plus the
+// weapon settings cache hit rate. Always on: a sample is two timestamp reads and a few relaxed
+// atomic adds. Dump() writes the current table to Data/SKSE/Plugins/FPInertia/Perf.
+class PerfStats
+{
+public:
+	enum class Counter : std::uint32_t
+	{
+		kMainUpdate,        // MainUpdateHook::OnUpdate after the original call (whole plugin side)
+		kUpdate,            // InertiaManager::Update
+		kWeaponSettings,    // GetCurrentWeaponSettings (cache hits and misses)
+		kSpringState,       // StepSprings stages (one sample per frame each, both hands together)
+		kCameraSpring,
+		kMovementSpring,
+		kSprintSpring,
+		kJumpSpring,
+		kIntegrate,
+		kCombine,
+		kPivotNode,         // GetPivotNode
+		kClavicleNode,      // GetClavicleNode
+		kFirstPersonUpdate, // InertiaManager::OnFirstPersonUpdate
+
+		kTotal
+	};
+
+	static PerfStats* GetSingleton()
+	{
+		static PerfStats singleton;
+		return &singleton;
+	}
+
+	Inertia::Perf::Histogram& Get(Counter a_counter) { return histograms[static_cast<std::size_t>(a_counter)]; }
+	static const char* GetName(Counter a_counter);
+
+	// One sample per spring stage that ran in a_times (a StepSprings call's timings)
+	void RecordStages(const Inertia::Core::StageTimes& a_times);
+
+	// GetCurrentWeaponSettings outcome: the cached settings were still valid, or were looked up again
+	void CountWeaponLookup(bool a_cacheHit);
+	std::uint64_t GetWeaponCacheHits() const { return weaponCacheHits.load(std::memory_order_relaxed); }
+	std::uint64_t GetWeaponCacheMisses() const { return weaponCacheMisses.load(std::memory_order_relaxed); }
+
+	void Reset();
+
+	// Queue a text dump of every counter; the result is reported like a preset save
+	void Dump();
+
+	// Stop the trace zone capture and queue it as Chrome trace JSON (diagnostics build only)
+	void DumpZones();
+
+private:
+	PerfStats() = default;
+	~PerfStats() = default;
+	PerfStats(const PerfStats&) = delete;
+	PerfStats(PerfStats&&) = delete;
+	PerfStats& operator=(const PerfStats&) = delete;
+	PerfStats& operator=(PerfStats&&) = delete;
+
+	std::array<Inertia::Perf::Histogram, static_cast<std::size_t>(Counter::kTotal)> histograms;
+	std::atomic<std::uint64_t> weaponCacheHits{ 0 };
+	std::atomic<std::uint64_t> weaponCacheMisses{ 0 };
+};
+
+// Time the rest of the enclosing scope into PerfStats counter a_counter
+#define FPI_PERF_SCOPE(a_counter) \
+	::Inertia::Perf::ScopedTimer perfTimer##a_counter { ::PerfStats::GetSingleton()->Get(::PerfStats::Counter::a_counter) }
@@ -0,0 +1,182 @@
+#include "PresetIO.h"
+#include "TraceZones.h"
+
+#include <ctime>
+#include <format>
+#include <fstream>
+#include <sstream>
+
+void PresetIO::Shutdown()
+{
+	{
+		std::lock_guard lock(queueMutex);
+		if (!workThread.joinable()) {
+			return;
+		}
+		stopWork = true;
+	}
+	queueWake.notify_one();
+	workThread.join();
+
+	// Only left over if the thread was terminated first (process exit); run it here, in order
+	for (auto& task : queue) {
+		Execute(task);
+	}
+	queue.clear();
+}
+
+void PresetIO::Write(const std::filesystem::path& a_path, std::string a_contents, std::string a_message)
+{
+	{
+		std::lock_guard lock(queueMutex);
+		// Only writes queued after the last job can be merged; merging past a job would move
+		// this write ahead of it (e.g. ahead of a queued delete of the same file)
+		for (auto task = queue.rbegin(); task != queue.rend() && !task->job; ++task) {
+			if (task->path == a_path) {
+				// Not written yet - the newer contents replace it in its place in the queue
+				task->contents = std::move(a_contents);
+				task->message = std::move(a_message);
+				return;
+			}
+		}
+	}
+	Enqueue({ a_path, std::move(a_contents), std::move(a_message), {} });
+}
+
+void PresetIO::Run(Job a_job)
+{
+	Enqueue({ {}, {}, {}, std::move(a_job) });
+}
+
+void PresetIO::Enqueue(Task a_task)
+{
+	{
+		std::lock_guard lock(queueMutex);
+		if (stopWork) {
+			// After Shutdown - nothing left to hand it to, so do it here
+			Execute(a_task);
+			return;
+		}
+		queue.push_back(std::move(a_task));
+		// Started on first use; it lives for the rest of the session
+		if (!workThread.joinable()) {
+			workThread = std::thread(&PresetIO::WorkLoop, this);
+		}
+	}
+	queueWake.notify_one();
+}
+
+std::vector<PresetIO::Completion> PresetIO::Drain()
+{
+	std::vector<Completion> finished;
+	{
+		std::lock_guard lock(queueMutex);
+		finished.swap(completions);
+	}
+	for (auto& completion : finished) {
+		if (completion.apply) {
+			completion.apply();
+		}
+	}
+	return finished;
+}
+
+bool PresetIO::IsBusy() const
+{
+	std::lock_guard lock(queueMutex);
+	return working || !queue.empty();
+}
+
+void PresetIO::WorkLoop()
+{
+	Inertia::Perf::SetZoneThreadName("FPInertia preset I/O");
+	std::unique_lock lock(queueMutex);
+	while (true) {
+		queueWake.wait(lock, [this] { return !queue.empty() || stopWork; });
+		if (queue.empty()) {
+			break;
+		}
+		Task task = std::move(queue.front());
+		queue.pop_front();
+		working = true;
+
+		lock.unlock();
+		Completion completion = Execute(task);
+		lock.lock();
+
+		working = false;
+		if (!completion.message.empty() || completion.apply) {
+			completions.push_back(std::move(completion));
+		}
+	}
+}
+
+PresetIO::Completion PresetIO::Execute(Task& a_task)
+{
+	FPI_TRACE_ZONE("Preset I/O task");
+	if (a_task.job) {
+		try {
+			return a_task.job();
+		} catch (const std::exception& e) {
+			logger::error("Preset I/O failed: {}", e.what());
+			return { false, "Preset file operation failed", {} };
+		}
+	}
+
+	if (!WriteFileAtomic(a_task.path, a_task.contents)) {
+		logger::error("Failed to write preset file: {}", a_task.path.string());
+		return { false, std::format("Failed to write {}", a_task.path.filename().string()), {} };
+	}
+	logger::info("Wrote preset file: {}", a_task.path.string());
+	return { true, std::move(a_task.message), {} };
+}
+
+bool PresetIO::WriteFileAtomic(const std::filesystem::path& a_path, const std::string& a_contents)
+{
+	FPI_TRACE_ZONE("Write file");
+	auto tempPath = a_path;
+	tempPath += ".tmp";
+	{
+		std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+		if (!file.is_open()) {
+			return false;
+		}
+		file.write(a_contents.data(), static_cast<std::streamsize>(a_contents.size()));
+		file.close();
+		if (file.fail()) {
+			std::error_code ec;
+			std::filesystem::remove(tempPath, ec);
+			return false;
+		}
+	}
+
+	// Replaces the target in one step - readers see the old file or the new one, never a partial one
+	std::error_code ec;
+	std::filesystem::rename(tempPath, a_path, ec);
+	if (ec) {
+		std::filesystem::remove(tempPath, ec);
+		return false;
+	}
+	return true;
+}
+
+bool PresetIO::ReadFile(const std::filesystem::path& a_path, std::string& a_contents)
+{
+	std::ifstream file(a_path, std::ios::binary);
+	if (!file.is_open()) {
+		return false;
+	}
+	std::ostringstream buffer;
+	buffer << file.rdbuf();
+	a_contents = buffer.str();
+	return true;
+}
+
+std::filesystem::path PresetIO::MakeTimestampedPath(const std::filesystem::path& a_folder, std::string_view a_extension)
+{
+	std::time_t now = std::time(nullptr);
+	std::tm local{};
+	localtime_s(&local, &now);
+	return a_folder / std::format("FPInertia_{:04}{:02}{:02}-{:02}{:02}{:02}{}",
+		local.tm_year + 1900, local.tm_mon + 1, local.tm_mday, local.tm_hour, local.tm_min, local.tm_sec, a_extension);
+}
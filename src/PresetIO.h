@@ -0,0 +1,87 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <thread>
+
+// Background reader/writer for preset files
+//
+// The menu queues preset saves, loads and file operations here instead of touching the disk
+// itself; one thread works through the queue in order, so a read always sees the writes queued
+// before it.
+// - Writes go to "<file>.tmp" and are renamed over the target, so a crash or full disk mid-write
+//   never leaves a truncated preset. A write to a file that is still queued, with no job queued
+//   after it, replaces the queued contents instead of writing the file twice.
+// - Jobs do their disk work on the I/O thread and return a Completion. Its apply step runs on the
+//   thread that calls Drain() (the menu), the only place preset state may be changed from.
+class PresetIO
+{
+public:
+	struct Completion
+	{
+		bool success{ true };
+		std::string message;            // Shown to the user; empty for silent completions
+		std::function<void()> apply;    // Run by Drain() on the menu thread (optional)
+	};
+
+	using Job = std::function<Completion()>;
+
+	static PresetIO* GetSingleton()
+	{
+		static PresetIO singleton;
+		return &singleton;
+	}
+
+	// Queue a write of a_contents to a_path; a_message is reported when it lands
+	void Write(const std::filesystem::path& a_path, std::string a_contents, std::string a_message = {});
+
+	// Queue disk work (reads, copies, deletes) to run on the I/O thread
+	void Run(Job a_job);
+
+	// Menu thread - run the apply step of everything that finished and return them for notifications
+	std::vector<Completion> Drain();
+
+	// True while anything is queued or being written
+	bool IsBusy() const;
+
+	// Plugin shutdown - finish everything queued, then stop and join the I/O thread
+	void Shutdown();
+
+	// Write a_contents to a_path through a temp file and a rename; usable from any job
+	static bool WriteFileAtomic(const std::filesystem::path& a_path, const std::string& a_contents);
+
+	// Read a whole file into a_contents; false if it doesn't exist or can't be opened
+	static bool ReadFile(const std::filesystem::path& a_path, std::string& a_contents);
+
+	// a_folder/FPInertia_YYYYMMDD-HHMMSS<a_extension>, by local time (dumps, traces, captures)
+	static std::filesystem::path MakeTimestampedPath(const std::filesystem::path& a_folder, std::string_view a_extension);
+
+private:
+	PresetIO() = default;
+	~PresetIO() = default;
+	PresetIO(const PresetIO&) = delete;
+	PresetIO(PresetIO&&) = delete;
+	PresetIO& operator=(const PresetIO&) = delete;
+	PresetIO& operator=(PresetIO&&) = delete;
+
+	struct Task
+	{
+		std::filesystem::path path;  // Writes only
+		std::string contents;
+		std::string message;
+		Job job;                     // Set for jobs, empty for writes
+	};
+
+	void Enqueue(Task a_task);
+	void WorkLoop();
+	static Completion Execute(Task& a_task);
+
+	std::thread workThread;
+	mutable std::mutex queueMutex;       // Guards everything below
+	std::condition_variable queueWake;
+	std::deque<Task> queue;
+	bool working{ false };               // The I/O thread holds a task outside the queue
+	bool stopWork{ false };              // Exit once the queue is empty
+	std::vector<Completion> completions;
+};
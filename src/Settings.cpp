@@ -1,4 +1,6 @@
 #include "Settings.h"
+#include "PresetIO.h"
+#include "SettingsWatcher.h"
 
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
@@ -260,18 +262,34 @@ void Settings::Load()
 	ini.SetUnicode();
 	ini.LoadFile(path);
 
+	// If any new fields were missing, save the INI to include them
+	if (Parse(ini)) {
+		logger::info("Re-saving INI to update with new fields...");
+		Save();
+	}
+
+	// What was just read is not a change for the hot-reload watcher to pick up
+	auto* watcher = SettingsWatcher::GetSingleton();
+	watcher->SyncFileTime();
+	watcher->SetOptions(enableHotReload, hotReloadIntervalSec);
+
+	LogSummary();
+}
+
+bool Settings::Parse(CSimpleIniA& a_ini)
+{
 	// General settings
-	enabled = ini.GetBoolValue("General", "bEnabled", true);
-	enablePosition = ini.GetBoolValue("General", "bEnablePosition", true);
-	enableRotation = ini.GetBoolValue("General", "bEnableRotation", true);
-	requireWeaponDrawn = ini.GetBoolValue("General", "bRequireWeaponDrawn", true);
-	globalIntensity = static_cast<float>(ini.GetDoubleValue("General", "fGlobalIntensity", 1.0));
-	smoothingFactor = static_cast<float>(ini.GetDoubleValue("General", "fSmoothingFactor", 0.5));
+	enabled = a_ini.GetBoolValue("General", "bEnabled", true);
+	enablePosition = a_ini.GetBoolValue("General", "bEnablePosition", true);
+	enableRotation = a_ini.GetBoolValue("General", "bEnableRotation", true);
+	requireWeaponDrawn = a_ini.GetBoolValue("General", "bRequireWeaponDrawn", true);
+	globalIntensity = static_cast<float>(a_ini.GetDoubleValue("General", "fGlobalIntensity", 1.0));
+	smoothingFactor = static_cast<float>(a_ini.GetDoubleValue("General", "fSmoothingFactor", 0.5));
 	
 	// Settling behavior
-	settleDelay = static_cast<float>(ini.GetDoubleValue("Settling", "fSettleDelay", 0.3));
-	settleSpeed = static_cast<float>(ini.GetDoubleValue("Settling", "fSettleSpeed", 2.0));
-	settleDampingMult = static_cast<float>(ini.GetDoubleValue("Settling", "fSettleDampingMult", 3.0));
+	settleDelay = static_cast<float>(a_ini.GetDoubleValue("Settling", "fSettleDelay", 0.3));
+	settleSpeed = static_cast<float>(a_ini.GetDoubleValue("Settling", "fSettleSpeed", 2.0));
+	settleDampingMult = static_cast<float>(a_ini.GetDoubleValue("Settling", "fSettleDampingMult", 3.0));
 	
 	// Clamp settling values
 	settleDelay = std::clamp(settleDelay, 0.0f, 2.0f);
@@ -279,45 +297,48 @@ void Settings::Load()
 	settleDampingMult = std::clamp(settleDampingMult, 1.0f, 10.0f);
 	
 	// Movement inertia global settings (per-weapon settings override spring params)
-	movementInertiaEnabled = ini.GetBoolValue("MovementInertia", "bEnabled", true);
-	movementInertiaStrength = static_cast<float>(ini.GetDoubleValue("MovementInertia", "fStrength", 3.0));
-	movementInertiaThreshold = static_cast<float>(ini.GetDoubleValue("MovementInertia", "fThreshold", 30.0));
-	forwardBackInertia = ini.GetBoolValue("MovementInertia", "bForwardBackInertia", false);
-	disableVanillaSway = ini.GetBoolValue("MovementInertia", "bDisableVanillaSway", false);
+	movementInertiaEnabled = a_ini.GetBoolValue("MovementInertia", "bEnabled", true);
+	movementInertiaStrength = static_cast<float>(a_ini.GetDoubleValue("MovementInertia", "fStrength", 3.0));
+	movementInertiaThreshold = static_cast<float>(a_ini.GetDoubleValue("MovementInertia", "fThreshold", 30.0));
+	forwardBackInertia = a_ini.GetBoolValue("MovementInertia", "bForwardBackInertia", false);
+	disableVanillaSway = a_ini.GetBoolValue("MovementInertia", "bDisableVanillaSway", false);
 	
 	// Clamp movement inertia global values
 	movementInertiaStrength = std::clamp(movementInertiaStrength, 0.0f, 20.0f);
 	movementInertiaThreshold = std::clamp(movementInertiaThreshold, 0.0f, 200.0f);
 	
 	// Action blending
-	blendDuringAttack = ini.GetBoolValue("ActionBlend", "bBlendDuringAttack", true);
-	blendDuringBowDraw = ini.GetBoolValue("ActionBlend", "bBlendDuringBowDraw", true);
-	blendDuringSpellCast = ini.GetBoolValue("ActionBlend", "bBlendDuringSpellCast", true);
-	actionBlendSpeed = static_cast<float>(ini.GetDoubleValue("ActionBlend", "fActionBlendSpeed", 5.0));
-	actionMinIntensity = static_cast<float>(ini.GetDoubleValue("ActionBlend", "fActionMinIntensity", 0.2));
+	blendDuringAttack = a_ini.GetBoolValue("ActionBlend", "bBlendDuringAttack", true);
+	blendDuringBowDraw = a_ini.GetBoolValue("ActionBlend", "bBlendDuringBowDraw", true);
+	blendDuringSpellCast = a_ini.GetBoolValue("ActionBlend", "bBlendDuringSpellCast", true);
+	actionBlendSpeed = static_cast<float>(a_ini.GetDoubleValue("ActionBlend", "fActionBlendSpeed", 5.0));
+	actionMinIntensity = static_cast<float>(a_ini.GetDoubleValue("ActionBlend", "fActionMinIntensity", 0.2));
 	
 	// Clamp action blend values
 	actionBlendSpeed = std::clamp(actionBlendSpeed, 1.0f, 20.0f);
 	actionMinIntensity = std::clamp(actionMinIntensity, 0.0f, 1.0f);
 	
 	// Hand settings
-	independentHands = ini.GetBoolValue("Hands", "bIndependentHands", true);
-	leftHandMultiplier = static_cast<float>(ini.GetDoubleValue("Hands", "fLeftHandMultiplier", 1.0));
-	rightHandMultiplier = static_cast<float>(ini.GetDoubleValue("Hands", "fRightHandMultiplier", 1.0));
+	independentHands = a_ini.GetBoolValue("Hands", "bIndependentHands", true);
+	leftHandMultiplier = static_cast<float>(a_ini.GetDoubleValue("Hands", "fLeftHandMultiplier", 1.0));
+	rightHandMultiplier = static_cast<float>(a_ini.GetDoubleValue("Hands", "fRightHandMultiplier", 1.0));
 	
 	// Debug settings
-	debugLogging = ini.GetBoolValue("Debug", "bDebugLogging", false);
-	debugOnScreen = ini.GetBoolValue("Debug", "bDebugOnScreen", false);
+	debugLogging = a_ini.GetBoolValue("Debug", "bDebugLogging", false);
+	debugLogFrames = a_ini.GetBoolValue("Debug", "bDebugLogFrames", false);
+	debugOnScreen = a_ini.GetBoolValue("Debug", "bDebugOnScreen", false);
+	debugOnScreenSeconds = static_cast<float>(a_ini.GetDoubleValue("Debug", "fDebugOnScreenSeconds", 5.0));
+	debugOnScreenSeconds = std::clamp(debugOnScreenSeconds, 1.0f, 15.0f);
 	
 	// Hot reload settings
-	enableHotReload = ini.GetBoolValue("Debug", "bEnableHotReload", true);
-	hotReloadIntervalSec = static_cast<float>(ini.GetDoubleValue("Debug", "fHotReloadInterval", 5.0));
+	enableHotReload = a_ini.GetBoolValue("Debug", "bEnableHotReload", true);
+	hotReloadIntervalSec = static_cast<float>(a_ini.GetDoubleValue("Debug", "fHotReloadInterval", 5.0));
 	hotReloadIntervalSec = std::clamp(hotReloadIntervalSec, 1.0f, 60.0f);
 	
 	// Frame Generation Compatibility
 	// Note: DetectCommunityShaders() should be called separately at plugin load time
 	// Here we just load the user preference, which may be overridden by auto-detection
-	bool iniFrameGenMode = ini.GetBoolValue("FrameGenCompat", "bEnabled", false);
+	bool iniFrameGenMode = a_ini.GetBoolValue("FrameGenCompat", "bEnabled", false);
 	
 	// If CommunityShaders was detected, force-enable; otherwise use INI value
 	if (!communityShadersDetected) {
@@ -325,19 +346,40 @@ void Settings::Load()
 	}
 	
 	// High Framerate Fix - rate limits offset application to ~143fps
-	highFramerateFix = ini.GetBoolValue("FrameGenCompat", "bHighFramerateFix", false);
+	highFramerateFix = a_ini.GetBoolValue("FrameGenCompat", "bHighFramerateFix", false);
 	
 	// Stances Integration
 	// Note: stancesInstalled is detected at runtime, not loaded from INI
-	enableStanceSupport = ini.GetBoolValue("Stances", "bEnableStanceSupport", true);
+	enableStanceSupport = a_ini.GetBoolValue("Stances", "bEnableStanceSupport", true);
+	
+	// Spring integrators (iMode is the shared default for any category not set explicitly)
+	int defaultIntegrator = static_cast<int>(a_ini.GetLongValue("Integrator", "iMode", 0));
+	cameraIntegrator = static_cast<int>(a_ini.GetLongValue("Integrator", "iCamera", defaultIntegrator));
+	movementIntegrator = static_cast<int>(a_ini.GetLongValue("Integrator", "iMovement", defaultIntegrator));
+	sprintIntegrator = static_cast<int>(a_ini.GetLongValue("Integrator", "iSprint", defaultIntegrator));
+	jumpIntegrator = static_cast<int>(a_ini.GetLongValue("Integrator", "iJump", defaultIntegrator));
+	cameraIntegrator = std::clamp(cameraIntegrator, 0, 4);
+	movementIntegrator = std::clamp(movementIntegrator, 0, 4);
+	sprintIntegrator = std::clamp(sprintIntegrator, 0, 4);
+	jumpIntegrator = std::clamp(jumpIntegrator, 0, 4);
+	
+	// Fixed timestep physics
+	fixedTimestep = a_ini.GetBoolValue("FixedTimestep", "bEnabled", true);
+	physicsRateHz = static_cast<int>(a_ini.GetLongValue("FixedTimestep", "iPhysicsRate", 120));
+	maxPhysicsSteps = static_cast<int>(a_ini.GetLongValue("FixedTimestep", "iMaxStepsPerFrame", 8));
+	physicsRateHz = std::clamp(physicsRateHz, 30, 480);
+	maxPhysicsSteps = std::clamp(maxPhysicsSteps, 1, 32);
+	
+	// Worker thread
+	workerThread = a_ini.GetBoolValue("Threading", "bWorkerThread", false);
+	workerDeadlineMs = static_cast<float>(a_ini.GetDoubleValue("Threading", "fWorkerDeadlineMs", 1.0));
+	workerDeadlineMs = std::clamp(workerDeadlineMs, 0.1f, 4.0f);
+	
+	// Late latch
+	lateLatch = a_ini.GetBoolValue("LateLatch", "bEnabled", false);
+	
+	expMapRotation = a_ini.GetBoolValue("General", "bExpMapRotation", false);
 	
-	// Store file modification time for hot reload
-	try {
-		lastModifiedTime = std::filesystem::last_write_time(path);
-	} catch (...) {
-		// File might not exist, ignore
-	}
-
 	// Clamp general values
 	globalIntensity = std::clamp(globalIntensity, 0.0f, 5.0f);
 	smoothingFactor = std::clamp(smoothingFactor, 0.0f, 1.0f);
@@ -478,8 +520,8 @@ void Settings::Load()
 
 	// Check if any new fields are missing from the INI (need to write them)
 	bool iniNeedsUpdate = false;
-	auto checkNewField = [&ini, &iniNeedsUpdate](const char* section, const char* key) {
-		if (ini.GetValue(section, key) == nullptr) {
+	auto checkNewField = [&a_ini, &iniNeedsUpdate](const char* section, const char* key) {
+		if (a_ini.GetValue(section, key) == nullptr) {
 			iniNeedsUpdate = true;
 			logger::info("  INI section [{}] missing '{}' - will update INI", section, key);
 		}
@@ -499,29 +541,28 @@ void Settings::Load()
 	}
 	
 	// Load per-weapon settings from INI
-	unarmed.Load(ini, "Unarmed");
-	oneHandSword.Load(ini, "OneHandSword");
-	oneHandDagger.Load(ini, "OneHandDagger");
-	oneHandAxe.Load(ini, "OneHandAxe");
-	oneHandMace.Load(ini, "OneHandMace");
-	twoHandSword.Load(ini, "TwoHandSword");
-	twoHandAxe.Load(ini, "TwoHandAxe");
-	bow.Load(ini, "Bow");
-	staff.Load(ini, "Staff");
-	crossbow.Load(ini, "Crossbow");
-	shield.Load(ini, "Shield");
-	spell.Load(ini, "Spell");
+	unarmed.Load(a_ini, "Unarmed");
+	oneHandSword.Load(a_ini, "OneHandSword");
+	oneHandDagger.Load(a_ini, "OneHandDagger");
+	oneHandAxe.Load(a_ini, "OneHandAxe");
+	oneHandMace.Load(a_ini, "OneHandMace");
+	twoHandSword.Load(a_ini, "TwoHandSword");
+	twoHandAxe.Load(a_ini, "TwoHandAxe");
+	bow.Load(a_ini, "Bow");
+	staff.Load(a_ini, "Staff");
+	crossbow.Load(a_ini, "Crossbow");
+	shield.Load(a_ini, "Shield");
+	spell.Load(a_ini, "Spell");
 	// Dual wield types
-	dualWieldWeapons.Load(ini, "DualWieldWeapons");
-	dualWieldMagic.Load(ini, "DualWieldMagic");
-	spellAndWeapon.Load(ini, "SpellAndWeapon");
-	
-	// If any new fields were missing, save the INI to include them
-	if (iniNeedsUpdate) {
-		logger::info("Re-saving INI to update with new fields...");
-		Save();
-	}
+	dualWieldWeapons.Load(a_ini, "DualWieldWeapons");
+	dualWieldMagic.Load(a_ini, "DualWieldMagic");
+	spellAndWeapon.Load(a_ini, "SpellAndWeapon");
+
+	return iniNeedsUpdate;
+}
 
+void Settings::LogSummary() const
+{
 	logger::info("Settings loaded:");
 	logger::info("  Enabled: {}", enabled);
 	logger::info("  Enable Position: {}", enablePosition);
@@ -532,7 +573,14 @@ void Settings::Load()
 	logger::info("  Movement Inertia: {} (strength={:.2f}, threshold={:.1f})", 
 		movementInertiaEnabled, movementInertiaStrength, movementInertiaThreshold);
 	logger::info("  Per-weapon settings: pivot, invert, movement spring - loaded for each weapon type");
+	logger::info("  Spring Integrators: camera={}, movement={}, sprint={}, jump={}",
+		cameraIntegrator, movementIntegrator, sprintIntegrator, jumpIntegrator);
+	logger::info("  Fixed Timestep: {} (rate={}Hz, maxSteps={})", fixedTimestep, physicsRateHz, maxPhysicsSteps);
+	logger::info("  Worker Thread: {} (deadline={:.2f}ms)", workerThread, workerDeadlineMs);
+	logger::info("  Late Latch: {}", lateLatch);
+	logger::info("  Exp Map Rotation: {}", expMapRotation);
 	logger::info("  Debug Logging: {}", debugLogging);
+	logger::info("  Debug On Screen: {} ({:.0f}s)", debugOnScreen, debugOnScreenSeconds);
 }
 
 const WeaponInertiaSettings& Settings::GetWeaponSettings(RE::WEAPON_TYPE a_type) const
@@ -667,32 +715,18 @@ WeaponInertiaSettings& Settings::GetWeaponSettingsMutable(WeaponType a_type)
 	}
 }
 
-void Settings::CheckForReload(float a_deltaTime)
+void Settings::AdoptReload(const Settings& a_reloaded)
 {
-	if (!enableHotReload) {
-		return;
-	}
-	
-	timeSinceLastCheck += a_deltaTime;
-	
-	if (timeSinceLastCheck < hotReloadIntervalSec) {
-		return;
-	}
-	
-	timeSinceLastCheck = 0.0f;
-	
-	constexpr auto path = L"Data/SKSE/Plugins/FPInertia.ini";
-	
-	try {
-		auto currentModTime = std::filesystem::last_write_time(path);
-		
-		if (currentModTime != lastModifiedTime) {
-			logger::info("INI file changed, reloading settings...");
-			Load();
-			logger::info("Settings reloaded successfully");
-		}
-	} catch (...) {
-		// File access error, ignore
+	// Detected at runtime, not read from the INI
+	const bool csDetected = communityShadersDetected;
+	const bool stancesInstalled = stancesNGInstalled;
+
+	*this = a_reloaded;
+
+	communityShadersDetected = csDetected;
+	stancesNGInstalled = stancesInstalled;
+	if (communityShadersDetected) {
+		frameGenCompatMode = true;
 	}
 }
 
@@ -756,7 +790,13 @@ void Settings::Save()
 	
 	// Debug settings
 	ini.SetBoolValue("Debug", "bDebugLogging", debugLogging);
-	ini.SetBoolValue("Debug", "bDebugOnScreen", debugOnScreen);
+	ini.SetBoolValue("Debug", "bDebugLogFrames", debugLogFrames,
+		"; Also log the offsets applied every frame (very verbose, needs bDebugLogging)\n"
+		"; Diagnostics builds only - release builds compile per-frame logging out");
+	ini.SetBoolValue("Debug", "bDebugOnScreen", debugOnScreen,
+		"; Overlay plotting camera speed, spring offsets/energy, blends and frame cost (needs SKSE Menu Framework)");
+	ini.SetDoubleValue("Debug", "fDebugOnScreenSeconds", debugOnScreenSeconds,
+		"; Seconds of history the overlay shows (1-15)");
 	ini.SetBoolValue("Debug", "bEnableHotReload", enableHotReload);
 	ini.SetDoubleValue("Debug", "fHotReloadInterval", hotReloadIntervalSec);
 	
@@ -772,6 +812,42 @@ void Settings::Save()
 		"; When a stance mod is detected, stance multipliers in each weapon section will be applied\n"
 		"; fStanceMultNeutral/Low/Mid/High in each weapon section multiplies all inertia values for that stance");
 	
+	// Spring integrators
+	ini.SetLongValue("Integrator", "iCamera", cameraIntegrator,
+		"; How each spring category is advanced every frame\n"
+		"; 0 = Semi-implicit Euler (original behaviour)\n"
+		"; 1 = Exact damped-oscillator solution, one evaluation per frame at any framerate\n"
+		"; 2 = Velocity Verlet, 3 = RK4, 4 = Implicit Euler\n"
+		"; Substepped integrators take as many substeps as each spring needs to stay stable (up to 16)");
+	ini.SetLongValue("Integrator", "iMovement", movementIntegrator);
+	ini.SetLongValue("Integrator", "iSprint", sprintIntegrator);
+	ini.SetLongValue("Integrator", "iJump", jumpIntegrator);
+	
+	// Fixed timestep physics
+	ini.SetBoolValue("FixedTimestep", "bEnabled", fixedTimestep,
+		"; Step springs at a constant rate and interpolate between ticks when applying\n"
+		"; Gives the same feel at any framerate");
+	ini.SetLongValue("FixedTimestep", "iPhysicsRate", physicsRateHz,
+		"; Physics ticks per second (30-480)");
+	ini.SetLongValue("FixedTimestep", "iMaxStepsPerFrame", maxPhysicsSteps,
+		"; Max ticks per frame - time beyond this after a hitch is dropped (1-32)");
+	
+	// Worker thread
+	ini.SetBoolValue("Threading", "bWorkerThread", workerThread,
+		"; Step springs on a worker thread while the game animates, and wait for the\n"
+		"; result just before the offsets are applied");
+	ini.SetDoubleValue("Threading", "fWorkerDeadlineMs", workerDeadlineMs,
+		"; Longest wait for the worker (ms) - on a miss the previous pose is reused (0.1-4)");
+	
+	// Late latch
+	ini.SetBoolValue("LateLatch", "bEnabled", lateLatch,
+		"; Step springs right before the offsets are applied, with the camera angles read again there\n"
+		"; Lowest look-to-arm latency; ignored in frame gen compatible mode");
+	
+	ini.SetBoolValue("General", "bExpMapRotation", expMapRotation,
+		"; Apply rotation offsets as an exponential map instead of Euler angles\n"
+		"; A slightly different rotation - presets feel a little different with it on");
+	
 	// Per-weapon settings
 	unarmed.Save(ini, "Unarmed");
 	oneHandSword.Save(ini, "OneHandSword");
@@ -790,19 +866,35 @@ void Settings::Save()
 	dualWieldMagic.Save(ini, "DualWieldMagic");
 	spellAndWeapon.Save(ini, "SpellAndWeapon");
 	
-	// Save to file
-	SI_Error rc = ini.SaveFile(path);
-	if (rc < 0) {
-		logger::error("Failed to save settings to INI file");
-	} else {
+	// Written by the preset I/O thread, in order with the active preset writes to the same file
+	std::string contents;
+	ini.Save(contents);
+	PresetIO::GetSingleton()->Run([path, contents = std::move(contents)]() -> PresetIO::Completion {
+		CSimpleIniA merged;
+		merged.SetUnicode();
+		merged.LoadData(contents);
+		
+		// The active preset is InertiaPresets' key - keep whatever the file has by now
+		CSimpleIniA current;
+		current.SetUnicode();
+		if (current.LoadFile(path) == SI_OK) {
+			if (const char* activePreset = current.GetValue("Presets", "sActivePreset")) {
+				merged.SetValue("Presets", "sActivePreset", activePreset,
+					"; The currently active weapon type preset file (without .json extension)");
+			}
+		}
+		
+		std::string output;
+		merged.Save(output);
+		if (!PresetIO::WriteFileAtomic(path, output)) {
+			logger::error("Failed to save settings to INI file");
+			return { false, "Failed to save settings to the INI", {} };
+		}
 		logger::info("Settings saved to INI file");
 		
 		// Update modification time to prevent hot-reload from immediately reloading
-		try {
-			lastModifiedTime = std::filesystem::last_write_time(path);
-		} catch (...) {
-			// Ignore
-		}
-	}
+		SettingsWatcher::GetSingleton()->SyncFileTime();
+		return {};
+	});
 }
 
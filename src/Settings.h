@@ -116,8 +116,7 @@ public:
 	}
 
 	void Load();
-	void Save();  // Save current settings to INI file
-	void CheckForReload(float a_deltaTime);  // Call periodically to check for INI changes
+	void Save();  // Save current settings to INI file (queued on the preset I/O thread)
 	void DetectCommunityShaders();  // Check if Community Shaders is installed
 	
 	// Get settings for a specific weapon type
@@ -169,9 +168,35 @@ public:
 	bool stancesNGInstalled{ false };     // Auto-detected: Stances NG or Dynamic Weapon Movesets installed
 	bool enableStanceSupport{ true };     // Enable stance detection and multipliers
 
+	// Spring integration per category
+	// 0 = Semi-implicit Euler, 1 = Exact (analytic), 2 = Velocity Verlet, 3 = RK4, 4 = Implicit Euler
+	int cameraIntegrator{ 0 };
+	int movementIntegrator{ 0 };
+	int sprintIntegrator{ 0 };
+	int jumpIntegrator{ 0 };
+
+	// Fixed timestep physics
+	bool fixedTimestep{ true };           // Step springs at physicsRateHz and interpolate when applying
+	int  physicsRateHz{ 120 };            // Physics ticks per second (30-480)
+	int  maxPhysicsSteps{ 8 };            // Max ticks per frame before the backlog is dropped (1-32)
+
+	// Worker thread (opt-in): springs step while the game animates, joined in the UpdateFirstPerson hook
+	bool  workerThread{ false };
+	float workerDeadlineMs{ 1.0f };       // Longest the hook waits for the worker before reusing the last pose (0.1-4)
+
+	// Exp map rotation (opt-in): apply rotation offsets as an exponential map instead of Euler XYZ
+	// angles; a slightly different rotation, so presets feel a little different
+	bool expMapRotation{ false };
+
+	// Late latch (opt-in): step camera and springs in the UpdateFirstPerson hook with fresh camera angles
+	// Ignored in frame gen compatible mode, which keeps the two-hook path
+	bool lateLatch{ false };
+
 	// Debug settings
 	bool debugLogging{ false };
-	bool debugOnScreen{ false };
+	bool debugLogFrames{ false };         // Also log every applied pose (needs debugLogging; diagnostics build only)
+	bool debugOnScreen{ false };           // Telemetry overlay: springs, blends and frame cost over time
+	float debugOnScreenSeconds{ 5.0f };   // How much history the overlay plots (1-15)
 	
 	// Hot reload settings
 	bool  enableHotReload{ true };        // Check for INI changes while game is running
@@ -202,10 +227,17 @@ private:
 	Settings(Settings&&) = delete;
 	~Settings() = default;
 
-	Settings& operator=(const Settings&) = delete;
+	// Only the hot-reload watcher copies settings wholesale (see AdoptReload)
+	Settings& operator=(const Settings&) = default;
 	Settings& operator=(Settings&&) = delete;
 
-	// Private hot-reload tracking
-	std::filesystem::file_time_type lastModifiedTime{};
-	float timeSinceLastCheck{ 0.0f };
+	// The hot-reload watcher parses into its own Settings off the game thread
+	friend class SettingsWatcher;
+
+	// Read every INI value into this object; returns true if the INI is missing newer fields
+	bool Parse(CSimpleIniA& a_ini);
+	void LogSummary() const;
+
+	// Game thread - take everything read from the INI, keeping what was detected at runtime
+	void AdoptReload(const Settings& a_reloaded);
 };
@@ -0,0 +1,105 @@
+#include "SettingsWatcher.h"
+#include "Menu.h"
+
+namespace
+{
+	constexpr auto kIniPath = L"Data/SKSE/Plugins/FPInertia.ini";
+}
+
+SettingsWatcher::~SettingsWatcher()
+{
+	// The watch thread was joined by Stop() at shutdown
+	delete pending.exchange(nullptr, std::memory_order_acq_rel);
+}
+
+void SettingsWatcher::Start()
+{
+	if (watchThread.joinable()) {
+		return;
+	}
+	{
+		std::lock_guard lock(watchMutex);
+		stopWatch = false;
+	}
+	watchThread = std::thread(&SettingsWatcher::WatchLoop, this);
+}
+
+void SettingsWatcher::Stop()
+{
+	{
+		std::lock_guard lock(watchMutex);
+		stopWatch = true;
+	}
+	watchWake.notify_one();
+	if (watchThread.joinable()) {
+		watchThread.join();
+	}
+}
+
+void SettingsWatcher::SyncFileTime()
+{
+	std::error_code ec;
+	auto modified = std::filesystem::last_write_time(kIniPath, ec);
+	if (ec) {
+		return;  // File might not exist, ignore
+	}
+	std::lock_guard lock(watchMutex);
+	lastModifiedTime = modified;
+}
+
+void SettingsWatcher::SetOptions(bool a_enabled, float a_intervalSec)
+{
+	watchEnabled.store(a_enabled, std::memory_order_relaxed);
+	watchIntervalSec.store(a_intervalSec, std::memory_order_relaxed);
+}
+
+void SettingsWatcher::ApplyPending()
+{
+	Settings* reloaded = pending.exchange(nullptr, std::memory_order_acq_rel);
+	if (!reloaded) {
+		return;
+	}
+	auto* settings = Settings::GetSingleton();
+	settings->AdoptReload(*reloaded);
+	delete reloaded;
+	SetOptions(settings->enableHotReload, settings->hotReloadIntervalSec);
+	Menu::SyncOverlay();
+	logger::info("Settings reloaded successfully");
+}
+
+void SettingsWatcher::WatchLoop()
+{
+	std::unique_lock lock(watchMutex);
+	while (!stopWatch) {
+		// Interval and toggle are re-read every round so menu changes apply without a restart
+		const auto interval = std::chrono::duration<float>(watchIntervalSec.load(std::memory_order_relaxed));
+		watchWake.wait_for(lock, interval, [this] { return stopWatch; });
+		if (stopWatch || !watchEnabled.load(std::memory_order_relaxed)) {
+			continue;
+		}
+
+		std::error_code ec;
+		auto modified = std::filesystem::last_write_time(kIniPath, ec);
+		if (ec || modified == lastModifiedTime) {
+			continue;  // File access error, or unchanged
+		}
+		lastModifiedTime = modified;
+
+		// Parse without the lock so Save() / Load() on other threads never wait for the file
+		lock.unlock();
+		logger::info("INI file changed, reloading settings...");
+
+		CSimpleIniA ini;
+		ini.SetUnicode();
+		ini.LoadFile(kIniPath);
+
+		auto* reloaded = new Settings();
+		reloaded->Parse(ini);
+		reloaded->LogSummary();
+
+		// A reload the game thread hasn't picked up yet is superseded by this one
+		delete pending.exchange(reloaded, std::memory_order_acq_rel);
+
+		lock.lock();
+	}
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Settings.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <thread>
+
+// Watches FPInertia.ini for hot reload on a background thread
+//
+// Every hotReloadIntervalSec the thread checks the file's modification time; when it changed, it
+// parses the whole INI into a fresh Settings and publishes it. The game thread only picks up the
+// published object at frame start (ApplyPending), so no file access or parsing happens in a frame.
+class SettingsWatcher
+{
+public:
+	static SettingsWatcher* GetSingleton()
+	{
+		static SettingsWatcher singleton;
+		return &singleton;
+	}
+
+	void Start();  // After the first Settings::Load()
+	void Stop();   // Also the plugin shutdown path: stops and joins the watch thread
+
+	// Game thread, once per frame before anything reads settings
+	void ApplyPending();
+
+	// The INI was just written or read by us - don't reload it as an outside change
+	void SyncFileTime();
+
+	// Toggle and interval the watch thread uses (from Settings::enableHotReload and
+	// hotReloadIntervalSec); pushed whenever those change, since the thread can't read Settings
+	void SetOptions(bool a_enabled, float a_intervalSec);
+
+private:
+	SettingsWatcher() = default;
+	~SettingsWatcher();
+	SettingsWatcher(const SettingsWatcher&) = delete;
+	SettingsWatcher(SettingsWatcher&&) = delete;
+	SettingsWatcher& operator=(const SettingsWatcher&) = delete;
+	SettingsWatcher& operator=(SettingsWatcher&&) = delete;
+
+	void WatchLoop();
+
+	std::thread watchThread;
+	std::mutex watchMutex;                // Guards lastModifiedTime and stopWatch
+	std::condition_variable watchWake;
+	std::filesystem::file_time_type lastModifiedTime{};
+	bool stopWatch{ false };
+	std::atomic<bool> watchEnabled{ true };
+	std::atomic<float> watchIntervalSec{ 5.0f };
+
+	// Parsed by the watch thread, owned by whoever exchanges it out
+	std::atomic<Settings*> pending{ nullptr };
+};
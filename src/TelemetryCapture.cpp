@@ -0,0 +1,154 @@
+#include "TelemetryCapture.h"
+#include "PresetIO.h"
+
+#include <format>
+#include <sstream>
+
+#include <rapidcsv.h>
+
+namespace Inertia
+{
+	namespace
+	{
+		std::filesystem::path GetTelemetryFolderPath()
+		{
+			return std::filesystem::path("Data/SKSE/Plugins/FPInertia/Telemetry");
+		}
+
+		// Per right hand spring, in SpringCategory order
+		constexpr const char* kSpringPrefixes[] = { "camera", "movement", "sprint", "jump" };
+		constexpr SpringSlot kSpringSlots[] = { SpringSlot::kCamera, SpringSlot::kMovement, SpringSlot::kSprint, SpringSlot::kJump };
+		constexpr std::size_t kFrameColumns = 12;   // time .. settling
+		constexpr std::size_t kSpringColumns = 12;  // Position/rotation offset and velocity, xyz each
+
+		std::vector<std::string> MakeColumnNames()
+		{
+			std::vector<std::string> names = {
+				"time", "delta", "costUs",
+				"cameraSpeed", "cameraVelX", "cameraVelY", "cameraVelZ",
+				"equipBlend", "actionBlend", "movementAirBlend", "cameraAirBlend", "settling"
+			};
+			for (const char* spring : kSpringPrefixes) {
+				for (const char* value : { "PosX", "PosY", "PosZ", "PosVelX", "PosVelY", "PosVelZ",
+						 "RotX", "RotY", "RotZ", "RotVelX", "RotVelY", "RotVelZ" }) {
+					names.push_back(std::string(spring) + value);
+				}
+			}
+			return names;
+		}
+
+		// Filled in the same order as MakeColumnNames
+		class RowWriter
+		{
+		public:
+			explicit RowWriter(float* a_row) :
+				next(a_row)
+			{}
+
+			void Add(float a_value) { *next++ = a_value; }
+
+			void Add(const Vec3& a_value)
+			{
+				Add(a_value.x);
+				Add(a_value.y);
+				Add(a_value.z);
+			}
+
+		private:
+			float* next;
+		};
+	}
+
+	bool TelemetryCapture::Sync()
+	{
+		const bool want = requested.load(std::memory_order_acquire);
+		const bool active = capturing.load(std::memory_order_relaxed);
+		if (want && !active) {
+			Start();
+		} else if (!want && active) {
+			Stop();
+		}
+		return capturing.load(std::memory_order_relaxed);
+	}
+
+	void TelemetryCapture::Start()
+	{
+		// The whole capture's memory up front - Record never allocates. Not zero-filled (7.5 MB on
+		// the game thread): every row is written before it is read
+		rows = std::make_unique_for_overwrite<Row[]>(kMaxFrames);
+		captureTime = 0.0f;
+		framesCaptured.store(0, std::memory_order_relaxed);
+		droppedFrames.store(0, std::memory_order_relaxed);
+		capturing.store(true, std::memory_order_release);
+		logger::info("[FPInertia] Telemetry capture started");
+	}
+
+	void TelemetryCapture::Stop()
+	{
+		capturing.store(false, std::memory_order_release);
+		const std::uint32_t count = framesCaptured.load(std::memory_order_relaxed);
+		const std::uint32_t dropped = droppedFrames.load(std::memory_order_relaxed);
+		logger::info("[FPInertia] Telemetry capture stopped ({} frames, {} dropped)", count, dropped);
+		if (count == 0) {
+			rows.reset();
+			return;
+		}
+
+		auto path = PresetIO::MakeTimestampedPath(GetTelemetryFolderPath(), ".csv");
+
+		// The buffer goes with the job; the next capture allocates a fresh one
+		std::shared_ptr<Row[]> captured(std::move(rows));
+		PresetIO::GetSingleton()->Run([path, captured, count]() {
+			const auto names = MakeColumnNames();
+			rapidcsv::Document doc(std::string(), rapidcsv::LabelParams(0, -1));
+			for (std::size_t column = 0; column < names.size(); ++column) {
+				doc.SetColumnName(column, names[column]);
+			}
+			for (std::uint32_t i = 0; i < count; ++i) {
+				doc.SetRow<float>(i, std::vector<float>(captured[i].begin(), captured[i].end()));
+			}
+
+			std::ostringstream csv;
+			doc.Save(csv);
+			std::error_code ec;
+			std::filesystem::create_directories(path.parent_path(), ec);
+			if (!PresetIO::WriteFileAtomic(path, csv.str())) {
+				return PresetIO::Completion{ false, "Could not write telemetry capture", {} };
+			}
+			logger::info("Telemetry capture written to {}", path.string());
+			return PresetIO::Completion{ true, std::format("Telemetry written to {}", path.filename().string()), {} };
+		});
+	}
+
+	void TelemetryCapture::Record(const Core::FrameState& a_state, float a_delta, float a_costUs)
+	{
+		static_assert(kColumnCount == kFrameColumns + std::size(kSpringSlots) * kSpringColumns);
+		
+		const std::uint32_t index = framesCaptured.load(std::memory_order_relaxed);
+		if (index >= kMaxFrames) {
+			droppedFrames.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		RowWriter row(rows[index].data());
+		row.Add(captureTime);
+		row.Add(a_delta);
+		row.Add(a_costUs);
+		row.Add(a_state.cameraSpeed);
+		row.Add(a_state.smoothedCameraVelocity);
+		row.Add(a_state.equipBlendFactor);
+		row.Add(a_state.actionBlendFactor);
+		row.Add(a_state.movementAirBlend);
+		row.Add(a_state.cameraAirBlend);
+		row.Add(a_state.settlingFactor);
+		for (SpringSlot slot : kSpringSlots) {
+			row.Add(a_state.springBank.GetPositionOffset(slot));
+			row.Add(a_state.springBank.GetPositionVelocity(slot));
+			row.Add(a_state.springBank.GetRotationOffset(slot));
+			row.Add(a_state.springBank.GetRotationVelocity(slot));
+		}
+
+		captureTime += a_delta;
+		framesCaptured.store(index + 1, std::memory_order_relaxed);
+	}
+}
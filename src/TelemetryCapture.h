@@ -0,0 +1,72 @@
+#pragma once
+
+#include "InertiaFrame.h"
+
+#include <array>
+#include <atomic>
+#include <memory>
+
+namespace Inertia
+{
+	// Captures per-frame spring state to a CSV under Data/SKSE/Plugins/FPInertia/Telemetry, for
+	// graphing a preset's response in a spreadsheet
+	//
+	// One row per frame: time, frame delta and plugin cost, camera velocity, the blend factors, and
+	// position/rotation offset and velocity of each right hand spring. The game thread fills a
+	// buffer preallocated when the capture starts (no I/O, no allocation per frame); when the capture
+	// stops the buffer is handed to the preset I/O thread, which writes it with rapidcsv. Frames past
+	// the buffer's capacity are counted and dropped.
+	// Capturing is requested from the menu and started/stopped on the game thread by Update().
+	class TelemetryCapture
+	{
+	public:
+		static TelemetryCapture* GetSingleton()
+		{
+			static TelemetryCapture singleton;
+			return &singleton;
+		}
+
+		// Menu side - takes effect on the next Update()
+		void RequestCapture(bool a_capture) { requested.store(a_capture, std::memory_order_release); }
+		bool IsRequested() const { return requested.load(std::memory_order_acquire); }
+
+		// Game thread - start/stop to match the request; returns true while capturing
+		bool Sync();
+		bool IsCapturing() const { return capturing.load(std::memory_order_acquire); }
+
+		// Game thread, only while capturing: one frame of a_state after its step
+		void Record(const Core::FrameState& a_state, float a_delta, float a_costUs);
+
+		// Stats for the menu (any thread)
+		std::uint32_t GetFramesCaptured() const { return framesCaptured.load(std::memory_order_relaxed); }
+		std::uint32_t GetDroppedFrames() const { return droppedFrames.load(std::memory_order_relaxed); }
+		static constexpr std::uint32_t GetCapacity() { return kMaxFrames; }
+
+	private:
+		TelemetryCapture() = default;
+		~TelemetryCapture() = default;
+		TelemetryCapture(const TelemetryCapture&) = delete;
+		TelemetryCapture(TelemetryCapture&&) = delete;
+		TelemetryCapture& operator=(const TelemetryCapture&) = delete;
+		TelemetryCapture& operator=(TelemetryCapture&&) = delete;
+
+		// One float per CSV column (see kColumnNames in the .cpp)
+		static constexpr std::size_t kColumnCount = 60;
+		using Row = std::array<float, kColumnCount>;
+
+		// 7.5 MB: about 9 minutes at 60 fps, 4 at 144
+		static constexpr std::uint32_t kMaxFrames = 1u << 15;
+
+		void Start();
+		void Stop();
+
+		std::unique_ptr<Row[]> rows;
+		float captureTime{ 0.0f };  // Seconds since the capture started (game thread)
+
+		std::atomic<bool> requested{ false };
+		std::atomic<bool> capturing{ false };
+
+		std::atomic<std::uint32_t> framesCaptured{ 0 };
+		std::atomic<std::uint32_t> droppedFrames{ 0 };
+	};
+}
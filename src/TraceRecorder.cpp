@@ -0,0 +1,250 @@
+#include "TraceRecorder.h"
+#include "PresetIO.h"
+
+#include <cstring>
+
+namespace Inertia
+{
+	void TraceRecorder::Shutdown()
+	{
+		{
+			std::lock_guard lock(flushMutex);
+			if (!flushThread.joinable()) {
+				return;
+			}
+			stopFlush = true;
+		}
+		recording.store(false, std::memory_order_release);
+		flushWake.notify_one();
+		flushThread.join();
+
+		// Only still open if the thread was terminated first (process exit)
+		if (file) {
+			FlushPending();
+			CloseFile();
+		}
+	}
+
+	std::filesystem::path TraceRecorder::GetTraceFolderPath() const
+	{
+		return std::filesystem::path("Data/SKSE/Plugins/FPInertia/Traces");
+	}
+
+	std::string TraceRecorder::GetFileName() const
+	{
+		std::lock_guard lock(filePathMutex);
+		return filePath.filename().string();
+	}
+
+	void TraceRecorder::RequestRecording(bool a_record)
+	{
+		if (a_record) {
+			// First request: the ring and the flush thread live for the rest of the session
+			std::lock_guard lock(flushMutex);
+			if (stopFlush) {
+				return;  // After Shutdown
+			}
+			if (!flushThread.joinable()) {
+				ring = std::make_unique<std::byte[]>(kRingCapacity);
+				flushThread = std::thread(&TraceRecorder::FlushLoop, this);
+			}
+		}
+		requested.store(a_record, std::memory_order_release);
+	}
+
+	bool TraceRecorder::Sync()
+	{
+		if (openFailed.exchange(false, std::memory_order_acq_rel)) {
+			recording.store(false, std::memory_order_release);
+			requested.store(false, std::memory_order_release);
+		}
+
+		const bool want = requested.load(std::memory_order_acquire);
+		const bool active = recording.load(std::memory_order_relaxed);
+		if (want && !active) {
+			// The ring is reused only once the last recording's file has been closed
+			if (!fileBusy.load(std::memory_order_acquire)) {
+				Start();
+			}
+		} else if (!want && active) {
+			Stop();
+		}
+		return recording.load(std::memory_order_relaxed);
+	}
+
+	void TraceRecorder::Start()
+	{
+		// Records pushed before the file is open wait in the ring
+		head.store(0, std::memory_order_relaxed);
+		tail.store(0, std::memory_order_relaxed);
+		framesRecorded.store(0, std::memory_order_relaxed);
+		droppedRecords.store(0, std::memory_order_relaxed);
+		bytesWritten.store(0, std::memory_order_relaxed);
+		hasRecordedState = false;
+		hasRecordedSettings = false;
+		hasRecordedProfile = false;
+
+		fileBusy.store(true, std::memory_order_relaxed);
+		recording.store(true, std::memory_order_release);
+		{
+			std::lock_guard lock(flushMutex);
+			openRequested = true;
+		}
+		flushWake.notify_one();
+	}
+
+	void TraceRecorder::Stop()
+	{
+		recording.store(false, std::memory_order_release);
+
+		// The flush thread drains the ring once more, then closes the file
+		{
+			std::lock_guard lock(flushMutex);
+			closeRequested = true;
+		}
+		flushWake.notify_one();
+	}
+
+	void TraceRecorder::OpenFile()
+	{
+		auto folder = GetTraceFolderPath();
+		std::error_code ec;
+		std::filesystem::create_directories(folder, ec);
+
+		// One file per recording, named by local time
+		auto path = PresetIO::MakeTimestampedPath(folder, Trace::kExtension);
+
+		file = std::fopen(path.string().c_str(), "wb");
+		if (!file) {
+			logger::error("[FPInertia] Trace: could not create {}", path.string());
+			fileBusy.store(false, std::memory_order_release);
+			openFailed.store(true, std::memory_order_release);
+			return;
+		}
+
+		const Trace::FileHeader header = Trace::MakeHeader();
+		std::fwrite(&header, sizeof(header), 1, file);
+		bytesWritten.fetch_add(sizeof(header), std::memory_order_relaxed);
+		{
+			std::lock_guard lock(filePathMutex);
+			filePath = path;
+		}
+		logger::info("[FPInertia] Trace: recording to {}", path.string());
+	}
+
+	void TraceRecorder::CloseFile()
+	{
+		std::fclose(file);
+		file = nullptr;
+		logger::info("[FPInertia] Trace: stopped, {} frames, {} KB, {} records dropped",
+			GetFramesRecorded(), GetBytesWritten() / 1024, GetDroppedRecords());
+		fileBusy.store(false, std::memory_order_release);
+	}
+
+	bool TraceRecorder::Push(Trace::RecordType a_type, const void* a_payload, std::size_t a_size)
+	{
+		const std::size_t total = 1 + a_size;
+		const std::size_t writePos = head.load(std::memory_order_relaxed);
+		const std::size_t readPos = tail.load(std::memory_order_acquire);
+		if (kRingCapacity - (writePos - readPos) < total) {
+			droppedRecords.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		// Type byte, then the payload in at most two pieces around the end of the ring
+		std::byte* base = ring.get();
+		std::size_t offset = writePos % kRingCapacity;
+		base[offset] = static_cast<std::byte>(a_type);
+		offset = (offset + 1) % kRingCapacity;
+
+		const auto* src = static_cast<const std::byte*>(a_payload);
+		const std::size_t first = (std::min)(a_size, kRingCapacity - offset);
+		std::memcpy(base + offset, src, first);
+		std::memcpy(base, src + first, a_size - first);
+
+		head.store(writePos + total, std::memory_order_release);
+		return true;
+	}
+
+	void TraceRecorder::RecordState(const Core::FrameState& a_state)
+	{
+		hasRecordedState = Push(Trace::RecordType::kState, &a_state, sizeof(a_state));
+	}
+
+	void TraceRecorder::RecordSettings(const Core::CoreSettings& a_settings)
+	{
+		if (hasRecordedSettings && recordedSettings == a_settings) {
+			return;
+		}
+		if (Push(Trace::RecordType::kSettings, &a_settings, sizeof(a_settings))) {
+			recordedSettings = a_settings;
+			hasRecordedSettings = true;
+		}
+	}
+
+	void TraceRecorder::RecordProfile(const Trace::ProfileRecord& a_profile)
+	{
+		if (Push(Trace::RecordType::kProfile, &a_profile, sizeof(a_profile))) {
+			recordedProfileId = a_profile.id;
+			hasRecordedProfile = true;
+		}
+	}
+
+	void TraceRecorder::RecordFrame(const Trace::FrameRecord& a_frame)
+	{
+		if (Push(Trace::RecordType::kFrame, &a_frame, sizeof(a_frame))) {
+			framesRecorded.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	void TraceRecorder::FlushLoop()
+	{
+		while (true) {
+			bool open;
+			bool close;
+			bool stopping;
+			{
+				std::unique_lock lock(flushMutex);
+				auto woken = [this] { return openRequested || closeRequested || stopFlush; };
+				if (file) {
+					flushWake.wait_for(lock, kFlushInterval, woken);
+				} else {
+					flushWake.wait(lock, woken);
+				}
+				open = std::exchange(openRequested, false);
+				close = std::exchange(closeRequested, false);
+				stopping = stopFlush;
+			}
+			// A recording stopped right after it started still gets its file
+			if (open) {
+				OpenFile();
+			}
+			FlushPending();
+			if ((close || stopping) && file) {
+				CloseFile();
+			}
+			if (stopping) {
+				break;
+			}
+		}
+	}
+
+	void TraceRecorder::FlushPending()
+	{
+		const std::size_t writePos = head.load(std::memory_order_acquire);
+		const std::size_t readPos = tail.load(std::memory_order_relaxed);
+		if (writePos == readPos || !file) {
+			return;
+		}
+
+		const std::size_t size = writePos - readPos;
+		const std::size_t offset = readPos % kRingCapacity;
+		const std::size_t first = (std::min)(size, kRingCapacity - offset);
+		std::fwrite(ring.get() + offset, 1, first, file);
+		std::fwrite(ring.get(), 1, size - first, file);
+		std::fflush(file);
+
+		tail.store(writePos, std::memory_order_release);
+		bytesWritten.fetch_add(size, std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "InputTrace.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <thread>
+
+namespace Inertia
+{
+	// Records InertiaManager::Update's per-frame inputs and deferred offsets to a binary trace
+	// (see core/InputTrace.h) under Data/SKSE/Plugins/FPInertia/Traces.
+	//
+	// The game thread copies each record into a preallocated ring buffer; a background thread
+	// opens the file, flushes the ring to it and closes it, so starting and stopping a recording
+	// never touches the disk in a frame. Records that don't fit (disk stalled) are dropped and
+	// counted. Recording is requested from the menu and started/stopped on the game thread by
+	// Update(); the ring and the flush thread are created by the first request.
+	class TraceRecorder
+	{
+	public:
+		static TraceRecorder* GetSingleton()
+		{
+			static TraceRecorder singleton;
+			return &singleton;
+		}
+
+		// Menu side - takes effect on the next Update()
+		void RequestRecording(bool a_record);
+		bool IsRequested() const { return requested.load(std::memory_order_acquire); }
+
+		// Game thread - start/stop to match the request; returns true while recording
+		bool Sync();
+		bool IsRecording() const { return recording.load(std::memory_order_acquire); }
+
+		// Game thread, only while recording
+		// The state snapshot is written once, before the first frame of each recording
+		// Settings are only written when they differ from the last settings record
+		bool NeedsState() const { return !hasRecordedState; }
+		void RecordState(const Core::FrameState& a_state);
+		void RecordSettings(const Core::CoreSettings& a_settings);
+		bool NeedsProfile(std::uint32_t a_id) const { return !hasRecordedProfile || recordedProfileId != a_id; }
+		void RecordProfile(const Trace::ProfileRecord& a_profile);
+		void RecordFrame(const Trace::FrameRecord& a_frame);
+
+		// Stats for the menu (any thread)
+		std::uint32_t GetFramesRecorded() const { return framesRecorded.load(std::memory_order_relaxed); }
+		std::uint32_t GetDroppedRecords() const { return droppedRecords.load(std::memory_order_relaxed); }
+		std::uint64_t GetBytesWritten() const { return bytesWritten.load(std::memory_order_relaxed); }
+		std::string GetFileName() const;
+
+		// Plugin shutdown - close the recording, if any, then stop and join the flush thread
+		void Shutdown();
+
+	private:
+		TraceRecorder() = default;
+		~TraceRecorder() = default;
+		TraceRecorder(const TraceRecorder&) = delete;
+		TraceRecorder(TraceRecorder&&) = delete;
+		TraceRecorder& operator=(const TraceRecorder&) = delete;
+		TraceRecorder& operator=(TraceRecorder&&) = delete;
+
+		// 4 MB holds ~25 s of frames at 240 fps even if the disk stalls completely
+		static constexpr std::size_t kRingCapacity = 4u << 20;
+		static constexpr auto kFlushInterval = 100ms;
+
+		// Game thread - hand the file open/close to the flush thread
+		void Start();
+		void Stop();
+
+		// Copy one record into the ring (type byte + payload); false if it didn't fit
+		bool Push(Trace::RecordType a_type, const void* a_payload, std::size_t a_size);
+
+		// Flush thread
+		void FlushLoop();
+		void OpenFile();
+		void CloseFile();
+		void FlushPending();
+
+		std::filesystem::path GetTraceFolderPath() const;
+
+		std::unique_ptr<std::byte[]> ring;
+		std::atomic<std::size_t> head{ 0 };  // Total bytes pushed (game thread writes)
+		std::atomic<std::size_t> tail{ 0 };  // Total bytes flushed (flush thread writes)
+
+		std::thread flushThread;
+		std::mutex flushMutex;               // Guards the thread start and the three requests below
+		std::condition_variable flushWake;
+		bool openRequested{ false };
+		bool closeRequested{ false };
+		bool stopFlush{ false };
+		std::FILE* file{ nullptr };          // Flush thread
+		std::filesystem::path filePath;
+		mutable std::mutex filePathMutex;
+
+		std::atomic<bool> requested{ false };
+		std::atomic<bool> recording{ false };
+		std::atomic<bool> fileBusy{ false };    // From Start until the flush thread has closed the file
+		std::atomic<bool> openFailed{ false };  // Set by the flush thread, taken by Sync
+
+		std::atomic<std::uint32_t> framesRecorded{ 0 };
+		std::atomic<std::uint32_t> droppedRecords{ 0 };
+		std::atomic<std::uint64_t> bytesWritten{ 0 };
+
+		// What the current trace already holds (game thread)
+		bool hasRecordedState{ false };
+		Core::CoreSettings recordedSettings;
+		bool hasRecordedSettings{ false };
+		std::uint32_t recordedProfileId{ 0 };
+		bool hasRecordedProfile{ false };
+	};
+}
@@ -1,7 +1,13 @@
 #include "Inertia.h"
 #include "Settings.h"
+#include "SettingsWatcher.h"
 #include "Menu.h"
 #include "InertiaPresets.h"
+#include "LogRing.h"
+#include "PresetIO.h"
+#include "TraceRecorder.h"
+
+#include <cstdlib>
 
 namespace Plugin
 {
@@ -20,17 +26,39 @@ namespace
 		}
 
 		*path /= fmt::format("{}.log"sv, Plugin::NAME);
-		auto sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(path->string(), true);
+		auto file = std::make_shared<spdlog::sinks::basic_file_sink_st>(path->string(), true);
 
-		const auto level = spdlog::level::trace;
+		// The file is written by LogRing's thread; log calls only queue the message
+		auto sink = LogRing::GetSingleton()->Start(std::move(file));
 
 		auto log = std::make_shared<spdlog::logger>("global log"s, std::move(sink));
-		log->set_level(level);
-		log->flush_on(level);
+		log->set_level(spdlog::level::trace);
+		log->flush_on(spdlog::level::warn);
 
 		spdlog::set_default_logger(std::move(log));
 		spdlog::set_pattern("[%H:%M:%S:%e] %v"s);
 	}
+
+	// Stop and join every background thread, then write out what they left. The log goes last so
+	// the others' final messages reach the file.
+	void Shutdown()
+	{
+		SettingsWatcher::GetSingleton()->Stop();
+		Inertia::TraceRecorder::GetSingleton()->Shutdown();
+		PresetIO::GetSingleton()->Shutdown();
+		LogRing::GetSingleton()->Shutdown();
+	}
+
+	void RegisterShutdown()
+	{
+		// SKSE sends no shutdown message, so this runs from the plugin's exit handlers. Creating the
+		// singletons first makes it run before their destructors (reverse order of registration).
+		SettingsWatcher::GetSingleton();
+		Inertia::TraceRecorder::GetSingleton();
+		PresetIO::GetSingleton();
+		LogRing::GetSingleton();
+		std::atexit(Shutdown);
+	}
 }
 
 void MessageHandler(SKSE::MessagingInterface::Message* a_msg)
@@ -38,9 +66,11 @@ void MessageHandler(SKSE::MessagingInterface::Message* a_msg)
 	switch (a_msg->type) {
 	case SKSE::MessagingInterface::kDataLoaded:
 		logger::info("Data loaded, initializing...");
+		Inertia::Perf::SetZoneThreadName("Main thread");
 		// Detect Community Shaders first (affects frame gen compat mode auto-enable)
 		Settings::GetSingleton()->DetectCommunityShaders();
 		Settings::GetSingleton()->Load();
+		SettingsWatcher::GetSingleton()->Start();
 		InertiaPresets::GetSingleton()->Init();
 		Inertia::Install();
 		Menu::Register();
@@ -93,6 +123,7 @@ extern "C" DLLEXPORT bool SKSEAPI SKSEPlugin_Load(const SKSE::LoadInterface* a_s
 {
 	InitializeLog();
 	logger::info("{} v{}"sv, Plugin::NAME, Plugin::VERSION.string());
+	RegisterShutdown();
 
 	SKSE::Init(a_skse);
 